@@ -615,6 +615,7 @@ int main(int argc, char** argv) {
   size_t numY_objs = default_num_objs;
   size_t numZ_objs = default_num_objs;
   size_t maxIter = 10;
+  std::string mapper = "block";
 
   std::string name(argv[0]);
 
@@ -634,15 +635,21 @@ int main(int argc, char** argv) {
       numY_objs = (size_t) strtol(argv[2], nullptr, 10);
       numZ_objs = (size_t) strtol(argv[3], nullptr, 10);
     }
-    else if (argc == 5) {
+    else if (argc == 5 or argc == 6) {
       numX_objs = (size_t) strtol(argv[1], nullptr, 10);
       numY_objs = (size_t) strtol(argv[2], nullptr, 10);
       numZ_objs = (size_t) strtol(argv[3], nullptr, 10);
       maxIter = (size_t) strtol(argv[4], nullptr, 10);
+      if (argc == 6) {
+        mapper = argv[5];
+      }
     }
-    else {
+    if (
+      (argc < 4 or argc > 6) or
+      (mapper != "block" and mapper != "hilbert" and mapper != "morton")
+    ) {
       fmt::print(
-        stderr, "usage: {} <num-objects-X-direction> <num-objects-Y-direction> <num-objects-Z-direction> <maxiter>\n",
+        stderr, "usage: {} <num-objects-X-direction> <num-objects-Y-direction> <num-objects-Z-direction> <maxiter> [block|hilbert|morton]\n",
         name
       );
       return 1;
@@ -664,6 +671,7 @@ int main(int argc, char** argv) {
       numZ_objs, default_nrow_object, default_nrow_object, numZ_objs * default_nrow_object * default_nrow_object
     );
     fmt::print(stdout, " - Maximum number of iterations {}\n", maxIter);
+    fmt::print(stdout, " - Object mapping {}\n", mapper);
     fmt::print(stdout, " - Convergence tolerance {}\n", default_tol);
     fmt::print(stdout, "\n");
   }
@@ -680,11 +688,22 @@ int main(int argc, char** argv) {
     static_cast<BaseIndexType>(numZ_objs)
   );
 
-  // Need 3D partioning
-  auto col_proxy = vt::makeCollection<LinearPb3DJacobi>()
-    .bounds(range)
-    .bulkInsert()
-    .wait();
+  // Need 3D partioning: a block map, or a space-filling curve that keeps
+  // neighboring objects on the same node and adjacent in memory
+  auto const curve = mapper == "hilbert" ?
+    vt::mapping::SpaceFillingCurve::Hilbert :
+    vt::mapping::SpaceFillingCurve::Morton;
+  using CurveMapper = vt::mapping::SpaceFillingMapper<vt::Index3D>;
+  auto col_proxy = mapper == "block" ?
+    vt::makeCollection<LinearPb3DJacobi>()
+      .bounds(range)
+      .bulkInsert()
+      .wait() :
+    vt::makeCollection<LinearPb3DJacobi>()
+      .bounds(range)
+      .bulkInsert()
+      .mapperObjGroupConstruct<CurveMapper>(range, curve)
+      .wait();
 
   vt::runInEpochCollective([col_proxy, grp_proxy, numX_objs, numY_objs, numZ_objs, maxIter] {
     col_proxy.broadcastCollective<LinearPb3DJacobi::LPMsg, &LinearPb3DJacobi::init>(
@@ -692,6 +711,8 @@ int main(int argc, char** argv) {
     );
   });
 
+  auto const start_time = vt::timing::getCurrentTime();
+
   while (!isWorkDone(grp_proxy)) {
     vt::runInEpochCollective([col_proxy] {
       col_proxy.broadcastCollective<
@@ -701,6 +722,13 @@ int main(int argc, char** argv) {
     vt::thePhase()->nextPhaseCollective();
   }
 
+  if (this_node == 0) {
+    fmt::print(
+      stdout, " - Time to solution ({} mapping) {} seconds\n", mapper,
+      vt::timing::getCurrentTime() - start_time
+    );
+  }
+
   vt::finalize();
 
   return 0;
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+#
+# Compare two sets of perf test results written with --vt_perf_gen_json.
+#
+# Usage: compare_perf.py <baseline.json|dir> <current.json|dir> [--threshold 0.05]
+#
+# Timers are matched by test, timer name and node. A timer regresses when its
+# mean grew by more than the threshold (relative) *and* by more than two
+# baseline standard deviations, so noisy timers are not flagged. Exits with a
+# non-zero status when any timer regressed.
+
+import argparse
+import json
+import os
+import sys
+
+
+def load(path):
+    files = [path]
+    if os.path.isdir(path):
+        files = sorted(
+            os.path.join(path, f) for f in os.listdir(path)
+            if f.endswith(".json")
+        )
+    timers = {}
+    for f in files:
+        with open(f) as fd:
+            doc = json.load(fd)
+        for t in doc.get("timers", []):
+            timers[(doc["test"], t["name"], t["node"])] = t
+    return timers
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.05)
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    cur = load(args.current)
+
+    regressions = 0
+    fmt = "{:<28} {:<32} {:>4} {:>12} {:>12} {:>9}  {}"
+    print(fmt.format("test", "timer", "node", "base(ms)", "cur(ms)", "change", ""))
+    for key in sorted(base.keys() & cur.keys()):
+        b, c = base[key], cur[key]
+        delta = c["mean"] - b["mean"]
+        rel = delta / b["mean"] if b["mean"] > 0 else 0.0
+        regressed = rel > args.threshold and delta > 2.0 * b["stdev"]
+        improved = -rel > args.threshold and -delta > 2.0 * b["stdev"]
+        regressions += int(regressed)
+        status = "REGRESSED" if regressed else ("improved" if improved else "")
+        print(fmt.format(
+            key[0], key[1], key[2], "{:.3f}".format(b["mean"]),
+            "{:.3f}".format(c["mean"]), "{:+.1f}%".format(rel * 100.0), status
+        ))
+
+    for key in sorted(base.keys() - cur.keys()):
+        print("missing from current: {} {} node {}".format(*key))
+
+    print("\n{} regression(s)".format(regressions))
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -72,6 +72,17 @@ private:
     Op()(m1->getVal(), m2->getConstVal());
   }
 public:
+  /**
+   * \brief The combine handler for a reduction with operator \c Op
+   *
+   * Away from the root, \c msg is the accumulator with one contribution
+   * linked behind it: \c Op folds that contribution into \c msg in place.
+   * The reducer calls this pairwise and directly, so \c Op must be a pure
+   * function of the two values. At the root, the result is delivered to the
+   * callback or to \c ActOp.
+   *
+   * \param[in] msg the accumulator, or the result at the root
+   */
   template <typename MsgT, typename Op, typename ActOp>
   static void msgHandler(MsgT* msg);
 };
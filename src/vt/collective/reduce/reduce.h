@@ -132,6 +132,12 @@ struct Reduce : virtual collective::tree::Tree {
   /**
    * \brief Reduce a message up the tree, possibly delayed through a pending send
    *
+   * The handler \c f is the combine handler. Away from the root it is called
+   * once per contribution with exactly two linked messages and must fold the
+   * second into the first; it is invoked directly, outside of any task
+   * context, so it must not send messages. At the root it is run as a task
+   * with \c isRoot() set to deliver the result.
+   *
    * \param[in] root the root node where the final handler provides the result
    * \param[in] msg the message to reduce on this node
    * \param[in] id the reduction stamp (optional), provided if out-of-order
@@ -339,6 +345,21 @@ struct Reduce : virtual collective::tree::Tree {
     MsgT* msg, bool const local, ReduceNumType num_contrib = -1
   );
 
+  /**
+   * \internal \brief Eagerly fold a new contribution into the accumulator
+   * message for its stamp by invoking the combine handler on the pair
+   *
+   * The combine handler is called directly, without a runnable, so it must
+   * be a pure pairwise combine when the accumulator is not the root: fold
+   * the one linked message into the first and return, without sending
+   * messages or depending on the epoch or task context.
+   *
+   * \param[in] state the reduce state for the stamp
+   * \param[in] msg the message to fold into the accumulator
+   */
+  template <typename MsgT>
+  void reduceFoldMsg(ReduceState& state, MsgT* msg);
+
   /**
    * \internal \brief Combine and send up the tree if ready
    *
@@ -377,7 +398,7 @@ struct Reduce : virtual collective::tree::Tree {
 
 private:
   detail::ReduceScope scope_;   /**< The reduce scope for this reducer */
-  ReduceStateHolder state_;     /**< Reduce state, holds messages, etc. */
+  ReduceStateHolder state_;     /**< Reduce state, holds accumulators, etc. */
   detail::StrongSeq next_seq_;  /**< The next reduce stamp */
 };
 
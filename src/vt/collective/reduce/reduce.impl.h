@@ -177,97 +177,96 @@ void Reduce::reduceAddMsg(
   }
 
   auto& state = state_.find(lookup);
-  auto msg_ptr = promoteMsg(msg);
 
-  // Run-time cast with lasting type info to ReduceMsg for holder
-  state.msgs.push_back(msg_ptr.template to<ReduceMsg>());
   if (num_contrib != -1) {
     state.num_contrib_ = num_contrib;
   }
   if (local) {
     state.num_local_contrib_++;
   }
+  state.num_recv_++;
   state.combine_handler_ = msg->combine_handler_;
   state.reduce_root_ = msg->reduce_root_;
+
+  if (state.accum_ == nullptr) {
+    // Run-time cast with lasting type info to ReduceMsg for holder
+    state.accum_ = promoteMsg(msg).template to<ReduceMsg>();
+  } else if (local) {
+    // The accumulator's callback is the one triggered at the root, so keep
+    // this node's own contribution as the accumulator: a local callback is
+    // only valid on the node that created it
+    auto prev = state.accum_.template to<MsgT>();
+    state.accum_ = promoteMsg(msg).template to<ReduceMsg>();
+    reduceFoldMsg<MsgT>(state, prev.get());
+  } else {
+    reduceFoldMsg<MsgT>(state, msg);
+  }
+
   vt_debug_print(
     verbose, reduce,
-    "reduceAddMsg: scope={}, stamp={}, msg={}, contrib={}, msgs.size()={}, "
+    "reduceAddMsg: scope={}, stamp={}, msg={}, contrib={}, num_recv={}, "
     "ref={}\n",
     scope_.str(), detail::stringizeStamp(lookup), print_ptr(msg),
-    state.num_contrib_, state.msgs.size(), envelopeGetRef(msg->env)
+    state.num_contrib_, state.num_recv_, envelopeGetRef(msg->env)
   );
 }
 
+template <typename MsgT>
+void Reduce::reduceFoldMsg(ReduceState& state, MsgT* msg) {
+  auto accum = static_cast<MsgT*>(state.accum_.get());
+
+  // Link the new contribution behind the accumulator so the combine handler
+  // folds exactly this pair; the incoming message is released by the caller
+  accum->next_ = msg;
+  accum->count_ = 2;
+  accum->is_root_ = false;
+  msg->next_ = nullptr;
+  msg->count_ = 1;
+
+  vt_debug_print(
+    verbose, reduce,
+    "reduceFoldMsg: scope={}, stamp={}, accum={}, msg={}\n",
+    scope_.str(), detail::stringizeStamp(msg->stamp()), print_ptr(accum),
+    print_ptr(msg)
+  );
+
+  /*
+   *  Call the combine handler directly on the pair: a non-root combine only
+   *  applies the reduction operator to message data, so it needs none of the
+   *  context (epoch, tracing, LB stats) that a runnable would set up
+   */
+  auto const& func = auto_registry::getAutoHandler(state.combine_handler_);
+  func->dispatch(accum, nullptr);
+
+  accum->next_ = nullptr;
+  accum->count_ = 1;
+}
+
 template <typename MsgT>
 void Reduce::startReduce(detail::ReduceStamp id, bool use_num_contrib) {
   auto lookup = id;
   auto& state = state_.find(lookup);
 
-  std::size_t nmsgs = state.msgs.size();
+  auto const nrecv = state.num_recv_;
   auto const contrib =
     use_num_contrib ? state.num_contrib_ : state.num_local_contrib_;
-  std::size_t total = getNumChildren() + contrib;
-  bool ready = nmsgs == total;
+  auto const total = static_cast<ReduceNumType>(getNumChildren()) + contrib;
+  bool ready = nrecv == total;
 
   vt_debug_print(
     normal, reduce,
-    "startReduce: scope={}, stamp={}, msg={}, children={}, "
-    "contrib_={}, local_contrib_={}, nmsgs={}, ready={}\n",
-    scope_.str(), detail::stringizeStamp(id), state.msgs.size(),
-    getNumChildren(), state.num_contrib_, state.num_local_contrib_, nmsgs, ready
+    "startReduce: scope={}, stamp={}, children={}, "
+    "contrib_={}, local_contrib_={}, num_recv={}, ready={}\n",
+    scope_.str(), detail::stringizeStamp(id), getNumChildren(),
+    state.num_contrib_, state.num_local_contrib_, nrecv, ready
   );
 
   if (ready) {
-    // Combine messages
-    if (state.msgs.size() > 1) {
-      auto size = state.msgs.size();
-      for (decltype(size) i = 0; i < size; i++) {
-        bool const has_next = i+1 < size;
-        // Collection is of MsgPtr<ReduceMsg>
-        auto typed_msg = static_cast<MsgT*>(state.msgs[i].get());
-        if (has_next) {
-          typed_msg->next_ = static_cast<MsgT*>(state.msgs[i+1].get());
-        } else {
-          typed_msg->next_ = nullptr;
-        }
-        typed_msg->count_ = size - i;
-        typed_msg->is_root_ = false;
-
-        vt_debug_print(
-          verbose, reduce,
-          "scope={}, stamp={}: i={} next={} has_next={} count={} msgs.size()={} "
-          "ref={}\n",
-          scope_.str(), detail::stringizeStamp(id),
-          i, print_ptr(typed_msg->next_), has_next, typed_msg->count_,
-          size, envelopeGetRef(typed_msg->env)
-        );
-      }
-
-      vt_debug_print(
-        verbose, reduce,
-        "scope={}, stamp={}, msgs.size()={}\n",
-        scope_.str(), detail::stringizeStamp(id), size
-      );
-
-      /*
-       *  Invoke user handler to run the functor that combines messages,
-       *  applying the reduction operator
-       */
-      auto const& handler = state.combine_handler_;
-      auto const& from_node = theContext()->getFromNodeCurrentTask();
-
-      // this needs to run inline.. threaded not allowed for reduction
-      // combination
-      runnable::makeRunnable(state.msgs[0], false, handler, from_node)
-        .withTDEpochFromMsg()
-        .run();
-    }
-
-    // Send to parent
-    // Collection is of MsgPtr<ReduceMsg>, re-type and drop collection owner.
-    auto msg = state.msgs[0];
-    MsgPtr<MsgT> typed_msg = msg.template to<MsgT>();
-    state.msgs.clear();
+    // All contributions have already been folded into the accumulator.
+    // Re-type and drop the state's ownership before sending to the parent
+    MsgPtr<MsgT> typed_msg = state.accum_.template to<MsgT>();
+    state.accum_ = nullptr;
+    state.num_recv_ = 0;
     state.num_contrib_ = 1;
     NodeType const root = state.reduce_root_;
 
@@ -284,6 +283,7 @@ void Reduce::startReduce(detail::ReduceStamp id, bool use_num_contrib) {
           scope_.str(), detail::stringizeStamp(id), root, this_node
         );
 
+        theMsg()->markAsSystemMessage(typed_msg);
         theMsg()->sendMsg<MsgT,ReduceManager::reduceRootRecv<MsgT>>(root, typed_msg);
       } else {
         vt_debug_print(
@@ -302,6 +302,7 @@ void Reduce::startReduce(detail::ReduceStamp id, bool use_num_contrib) {
         scope_.str(), detail::stringizeStamp(id), parent
       );
 
+      theMsg()->markAsSystemMessage(typed_msg);
       theMsg()->sendMsg<MsgT,ReduceManager::reduceUpHan<MsgT>>(parent, typed_msg);
     }
   }
@@ -48,20 +48,29 @@
 #include "vt/collective/reduce/reduce_msg.h"
 #include "vt/messaging/message.h"
 
-#include <vector>
 #include <cstdint>
 
 namespace vt { namespace collective { namespace reduce {
 
+/**
+ * \struct ReduceState
+ *
+ * \brief The state for a single reduction stamp on this node.
+ *
+ * Contributions (local or from children in the spanning tree) are eagerly
+ * folded into a single accumulator message as they arrive, so only one
+ * message per stamp is held live regardless of the number of contributors.
+ */
 struct ReduceState {
   using ReduceNumType = int32_t;
-  using ReduceVecType = std::vector<MsgSharedPtr<ReduceMsg>>;
+  using ReduceAccumType = MsgSharedPtr<ReduceMsg>;
 
   explicit ReduceState(ReduceNumType in_num_contrib)
     : num_contrib_(in_num_contrib)
   { }
 
-  ReduceVecType msgs               = {};
+  ReduceAccumType accum_           = nullptr;
+  ReduceNumType num_recv_          = 0;
   ReduceNumType num_contrib_       = 1;
   ReduceNumType num_local_contrib_ = 0;
   HandlerType combine_handler_     = uninitialized_handler;
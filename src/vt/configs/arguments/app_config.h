@@ -91,6 +91,19 @@ struct AppConfig {
   int32_t vt_sched_num_progress = 2;
   int32_t vt_sched_progress_han = 0;
   double vt_sched_progress_sec  = 0.0;
+  int32_t vt_sched_timer_tick_us = 100;
+  bool vt_sched_adaptive_poll = false;
+  int32_t vt_sched_poll_max_backoff = 64;
+  bool vt_sched_idle_block = false;
+  int32_t vt_sched_idle_spin_us = 1000;
+  int32_t vt_sched_idle_block_us = 1000;
+  int32_t vt_sched_weight_system = 16;
+  int32_t vt_sched_weight_user = 8;
+  int32_t vt_sched_weight_background = 1;
+  bool vt_sched_latency_hist = false;
+  bool vt_sched_queue_latency = false;
+  bool vt_sched_progress_tune = false;
+  int32_t vt_sched_progress_tune_max = 64;
   bool vt_no_sigint    = false;
   bool vt_no_sigsegv   = false;
   bool vt_no_sigbus    = false;
@@ -142,6 +155,8 @@ struct AppConfig {
   std::string vt_lb_name      = "NoLB";
   std::string vt_lb_args      = "";
   int32_t vt_lb_interval      = 1;
+  bool vt_lb_adaptive         = false;
+  int32_t vt_lb_adaptive_horizon = 10;
   bool vt_lb_keep_last_elm    = false;
   bool vt_lb_stats            = false;
   bool vt_lb_stats_compress   = true;
@@ -157,6 +172,7 @@ struct AppConfig {
   bool vt_epoch_graph_terse    = false;
   bool vt_term_rooted_use_ds   = false;
   bool vt_term_rooted_use_wave = false;
+  bool vt_term_no_coalesce     = false;
   int64_t vt_hang_freq         = 1024;
 
 #if (vt_diagnostics_runtime != 0)
@@ -168,17 +184,32 @@ struct AppConfig {
   std::string vt_diag_summary_csv_file = "";
   std::string vt_diag_summary_file = "vtdiag.txt";
   bool vt_diag_csv_base_units = false;
+  bool vt_diag_export = false;
+  std::string vt_diag_export_file = "vtdiag_series";
+  int64_t vt_diag_export_period = 0;
+  std::size_t vt_diag_export_capacity = 4096;
+  bool vt_diag_export_binary = false;
+  int32_t vt_diag_export_reduce = 0;
 
   bool vt_pause = false;
   bool vt_no_assert_fail = false;
   bool vt_throw_on_abort = false;
   std::size_t vt_max_mpi_send_size = 1ull << 30;
+  bool vt_group_scan_construct = false;
+  bool vt_compact_envelope = false;
+  std::size_t vt_compact_envelope_max_size = 256;
 
 #if (vt_feature_fcontext != 0)
   bool vt_ult_disable = false;
   std::size_t vt_ult_stack_size = (1 << 21) - 64;
+  std::size_t vt_ult_stack_pool_max = 64;
+  std::size_t vt_ult_stack_pool_hot = 8;
 #endif
 
+  bool vt_coll_parallel_deliver = false;
+  int32_t vt_coll_parallel_min_elms = 64;
+  bool vt_coll_parallel_construct = false;
+
   std::string vt_debug_level = "terse";
   uint64_t vt_debug_level_val = 0;
 
@@ -259,6 +290,19 @@ struct AppConfig {
       | vt_sched_num_progress
       | vt_sched_progress_han
       | vt_sched_progress_sec
+      | vt_sched_timer_tick_us
+      | vt_sched_adaptive_poll
+      | vt_sched_poll_max_backoff
+      | vt_sched_idle_block
+      | vt_sched_idle_spin_us
+      | vt_sched_idle_block_us
+      | vt_sched_weight_system
+      | vt_sched_weight_user
+      | vt_sched_weight_background
+      | vt_sched_latency_hist
+      | vt_sched_queue_latency
+      | vt_sched_progress_tune
+      | vt_sched_progress_tune_max
 
       | vt_no_sigint
       | vt_no_sigsegv
@@ -307,6 +351,8 @@ struct AppConfig {
       | vt_lb_name
       | vt_lb_args
       | vt_lb_interval
+      | vt_lb_adaptive
+      | vt_lb_adaptive_horizon
       | vt_lb_stats
       | vt_lb_stats_compress
       | vt_lb_stats_dir
@@ -321,6 +367,7 @@ struct AppConfig {
       | vt_epoch_graph_terse
       | vt_term_rooted_use_ds
       | vt_term_rooted_use_wave
+      | vt_term_no_coalesce
       | vt_hang_freq
 
       | vt_diag_enable
@@ -328,11 +375,24 @@ struct AppConfig {
       | vt_diag_summary_csv_file
       | vt_diag_summary_file
       | vt_diag_csv_base_units
+      | vt_diag_export
+      | vt_diag_export_file
+      | vt_diag_export_period
+      | vt_diag_export_capacity
+      | vt_diag_export_binary
+      | vt_diag_export_reduce
 
       | vt_pause
       | vt_no_assert_fail
       | vt_throw_on_abort
       | vt_max_mpi_send_size
+      | vt_group_scan_construct
+      | vt_compact_envelope
+      | vt_compact_envelope_max_size
+
+      | vt_coll_parallel_deliver
+      | vt_coll_parallel_min_elms
+      | vt_coll_parallel_construct
 
       | vt_debug_level
       | vt_debug_level_val
@@ -350,6 +350,8 @@ void ArgConfig::addLbArgs(CLI::App& app) {
   auto lb_name       = "Name of the load balancer to use";
   auto lb_interval   = "Load balancing interval";
   auto lb_keep_last_elm = "Do not migrate last element in collection";
+  auto lb_adaptive   = "Only run the LB when the predicted gain exceeds its measured cost";
+  auto lb_adaptive_h = "Number of phases over which the adaptive LB gain is predicted";
   auto lb_stats      = "Enable load balancing statistics";
   auto lb_stats_comp = "Compress load balancing statistics output with brotli";
   auto lb_stats_dir  = "Load balancing statistics output directory";
@@ -358,6 +360,7 @@ void ArgConfig::addLbArgs(CLI::App& app) {
   auto lb_stats_file_in = "Load balancing statistics input file name";
   auto lbn = "NoLB";
   auto lbi = 1;
+  auto lbh = 10;
   auto lbf = "";
   auto lbd = "vt_lb_stats";
   auto lbs = "stats";
@@ -371,6 +374,8 @@ void ArgConfig::addLbArgs(CLI::App& app) {
   auto v1 = app.add_option("--vt_lb_args",       config_.vt_lb_args,        lb_args,      lba);
   auto w  = app.add_option("--vt_lb_interval",   config_.vt_lb_interval,    lb_interval,  lbi);
   auto wl = app.add_flag("--vt_lb_keep_last_elm", config_.vt_lb_keep_last_elm, lb_keep_last_elm);
+  auto wa = app.add_flag("--vt_lb_adaptive",     config_.vt_lb_adaptive,    lb_adaptive);
+  auto wh = app.add_option("--vt_lb_adaptive_horizon", config_.vt_lb_adaptive_horizon, lb_adaptive_h, lbh);
   auto ww = app.add_flag("--vt_lb_stats",        config_.vt_lb_stats,       lb_stats);
   auto xz = app.add_flag("--vt_lb_stats_compress", config_.vt_lb_stats_compress, lb_stats_comp);
   auto wx = app.add_option("--vt_lb_stats_dir",  config_.vt_lb_stats_dir,   lb_stats_dir, lbd);
@@ -387,6 +392,8 @@ void ArgConfig::addLbArgs(CLI::App& app) {
   v1->group(debugLB);
   w->group(debugLB);
   wl->group(debugLB);
+  wa->group(debugLB);
+  wh->group(debugLB);
   ww->group(debugLB);
   wx->group(debugLB);
   wy->group(debugLB);
@@ -410,11 +417,23 @@ void ArgConfig::addDiagnosticArgs(CLI::App& app) {
   auto file = "Output diagnostic summary table to text file";
   auto csv  = "Output diagnostic summary table to a comma-separated file";
   auto base = "Use base units (seconds, units, etc.) for CSV file output";
+  auto exp  = "Stream sampled diagnostic values to a per-node time-series file";
+  auto expf = "Base name for the diagnostic time-series files";
+  auto expp = "Milliseconds between diagnostic samples (0 samples every phase)";
+  auto expc = "Number of samples buffered before the writer thread drops them";
+  auto expb = "Write the diagnostic time series in binary instead of CSV";
+  auto expr = "Reduce min/max/avg across nodes every N phases (0 disables)";
   auto a = app.add_flag("--vt_diag_enable,!--vt_diag_disable", config_.vt_diag_enable,           diag);
   auto b = app.add_flag("--vt_diag_print_summary",      config_.vt_diag_print_summary,    sum);
   auto c = app.add_option("--vt_diag_summary_file",     config_.vt_diag_summary_file,     file);
   auto d = app.add_option("--vt_diag_summary_csv_file", config_.vt_diag_summary_csv_file, csv);
   auto e = app.add_flag("--vt_diag_csv_base_units",     config_.vt_diag_csv_base_units,   base);
+  auto f = app.add_flag("--vt_diag_export",             config_.vt_diag_export,           exp);
+  auto g = app.add_option("--vt_diag_export_file",      config_.vt_diag_export_file,      expf, true);
+  auto h = app.add_option("--vt_diag_export_period",    config_.vt_diag_export_period,    expp, true);
+  auto i = app.add_option("--vt_diag_export_capacity",  config_.vt_diag_export_capacity,  expc, true);
+  auto j = app.add_flag("--vt_diag_export_binary",      config_.vt_diag_export_binary,    expb);
+  auto k = app.add_option("--vt_diag_export_reduce",    config_.vt_diag_export_reduce,    expr, true);
 
   auto diagnosticGroup = "Diagnostics";
   a->group(diagnosticGroup);
@@ -422,6 +441,12 @@ void ArgConfig::addDiagnosticArgs(CLI::App& app) {
   c->group(diagnosticGroup);
   d->group(diagnosticGroup);
   e->group(diagnosticGroup);
+  f->group(diagnosticGroup);
+  g->group(diagnosticGroup);
+  h->group(diagnosticGroup);
+  i->group(diagnosticGroup);
+  j->group(diagnosticGroup);
+  k->group(diagnosticGroup);
 }
 
 void ArgConfig::addTerminationArgs(CLI::App& app) {
@@ -432,6 +457,7 @@ void ArgConfig::addTerminationArgs(CLI::App& app) {
   auto graph_on     = "Output epoch graph to file (DOT) when hang is detected";
   auto terse        = "Output epoch graph to file in terse mode";
   auto progress     = "Print termination counts when progress is stalled";
+  auto no_coalesce  = "Send a separate wave message per epoch instead of coalescing ready epochs";
   auto hfd          = 1024;
   auto x  = app.add_flag("--vt_no_detect_hang",        config_.vt_no_detect_hang,       hang);
   auto x1 = app.add_flag("--vt_term_rooted_use_ds",    config_.vt_term_rooted_use_ds,   ds);
@@ -439,6 +465,7 @@ void ArgConfig::addTerminationArgs(CLI::App& app) {
   auto x3 = app.add_option("--vt_epoch_graph_on_hang", config_.vt_epoch_graph_on_hang,  graph_on, true);
   auto x4 = app.add_flag("--vt_epoch_graph_terse",     config_.vt_epoch_graph_terse,    terse);
   auto x5 = app.add_option("--vt_print_no_progress",   config_.vt_print_no_progress,    progress, true);
+  auto x6 = app.add_flag("--vt_term_no_coalesce",      config_.vt_term_no_coalesce,     no_coalesce);
   auto y = app.add_option("--vt_hang_freq",            config_.vt_hang_freq,      hang_freq, hfd);
   auto debugTerm = "Termination";
   x->group(debugTerm);
@@ -447,6 +474,7 @@ void ArgConfig::addTerminationArgs(CLI::App& app) {
   x3->group(debugTerm);
   x4->group(debugTerm);
   x5->group(debugTerm);
+  x6->group(debugTerm);
   y->group(debugTerm);
 }
 
@@ -492,13 +520,52 @@ void ArgConfig::addSchedulerArgs(CLI::App& app) {
   auto nsched = "Number of times to run the progress function in scheduler";
   auto ksched = "Run the MPI progress function at least every k handlers that run";
   auto ssched = "Run the MPI progress function at least every s seconds";
+  auto tsched = "Resolution of scheduler timers (delays, deadlines) in microseconds";
+  auto asched = "Only poll components with pending work, backing off after empty polls";
+  auto bsched = "Maximum number of progress calls a component sits out after empty polls";
+  auto isched = "Block instead of spinning when the scheduler has been idle for a while";
+  auto jsched = "Microseconds to spin idle before blocking (with --vt_sched_idle_block)";
+  auto lsched = "Maximum microseconds to block idle at a time (with --vt_sched_idle_block)";
+  auto wsys = "Units run in a row from the system (runtime control) queue";
+  auto wusr = "Units run in a row from the user queue";
+  auto wbkg = "Units run in a row from the background queue";
+  auto hhist = "Record queueing delay and execution time histograms per handler and queue";
+  auto qlat = "Time each work unit from enqueue to execution for the queue latency diagnostics";
+  auto psched = "Adapt the handlers run between progress calls to poll productivity and throughput";
+  auto qsched = "Maximum handlers between progress calls (with --vt_sched_progress_tune)";
   auto sca = app.add_option("--vt_sched_num_progress", config_.vt_sched_num_progress, nsched, 2);
   auto hca = app.add_option("--vt_sched_progress_han", config_.vt_sched_progress_han, ksched, 0);
   auto kca = app.add_option("--vt_sched_progress_sec", config_.vt_sched_progress_sec, ssched, 0.0);
+  auto tca = app.add_option("--vt_sched_timer_tick_us", config_.vt_sched_timer_tick_us, tsched, 100);
+  auto aca = app.add_flag("--vt_sched_adaptive_poll", config_.vt_sched_adaptive_poll, asched);
+  auto bca = app.add_option("--vt_sched_poll_max_backoff", config_.vt_sched_poll_max_backoff, bsched, 64);
+  auto ica = app.add_flag("--vt_sched_idle_block", config_.vt_sched_idle_block, isched);
+  auto jca = app.add_option("--vt_sched_idle_spin_us", config_.vt_sched_idle_spin_us, jsched, 1000);
+  auto lca = app.add_option("--vt_sched_idle_block_us", config_.vt_sched_idle_block_us, lsched, 1000);
+  auto wca = app.add_option("--vt_sched_weight_system", config_.vt_sched_weight_system, wsys, 16);
+  auto uca = app.add_option("--vt_sched_weight_user", config_.vt_sched_weight_user, wusr, 8);
+  auto gca = app.add_option("--vt_sched_weight_background", config_.vt_sched_weight_background, wbkg, 1);
+  auto yca = app.add_flag("--vt_sched_latency_hist", config_.vt_sched_latency_hist, hhist);
+  auto zca = app.add_flag("--vt_sched_queue_latency", config_.vt_sched_queue_latency, qlat);
+  auto pca = app.add_flag("--vt_sched_progress_tune", config_.vt_sched_progress_tune, psched);
+  auto qca = app.add_option("--vt_sched_progress_tune_max", config_.vt_sched_progress_tune_max, qsched, 64);
   auto schedulerGroup = "Scheduler Configuration";
   sca->group(schedulerGroup);
   hca->group(schedulerGroup);
   kca->group(schedulerGroup);
+  tca->group(schedulerGroup);
+  aca->group(schedulerGroup);
+  bca->group(schedulerGroup);
+  ica->group(schedulerGroup);
+  jca->group(schedulerGroup);
+  lca->group(schedulerGroup);
+  wca->group(schedulerGroup);
+  uca->group(schedulerGroup);
+  gca->group(schedulerGroup);
+  yca->group(schedulerGroup);
+  zca->group(schedulerGroup);
+  pca->group(schedulerGroup);
+  qca->group(schedulerGroup);
 }
 
 void ArgConfig::addConfigFileArgs(CLI::App& app) {
@@ -518,6 +585,12 @@ void ArgConfig::addRuntimeArgs(CLI::App& app) {
                   "into multiple MPI sends)";
   auto assert = "Do not abort the program when vtAssert(..) is invoked";
   auto throw_on_abort = "Throw an exception when vtAbort(..) is called";
+  auto group_scan = "Construct collective groups with one membership "
+                    "reduce/broadcast instead of multi-round tree reorganization";
+  auto compact = "Send small active messages with a compact variable-length "
+                 "envelope on the wire";
+  auto compact_max = "Largest message size (in bytes) sent with a compact "
+                     "envelope";
 
 
   auto a1 = app.add_option(
@@ -529,18 +602,35 @@ void ArgConfig::addRuntimeArgs(CLI::App& app) {
   auto a3 = app.add_flag(
     "--vt_throw_on_abort", config_.vt_throw_on_abort, throw_on_abort
   );
+  auto a4 = app.add_flag(
+    "--vt_group_scan_construct", config_.vt_group_scan_construct, group_scan
+  );
+  auto a5 = app.add_flag(
+    "--vt_compact_envelope", config_.vt_compact_envelope, compact
+  );
+  auto a6 = app.add_option(
+    "--vt_compact_envelope_max_size", config_.vt_compact_envelope_max_size,
+    compact_max, true
+  );
 
 
   auto configRuntime = "Runtime";
   a1->group(configRuntime);
   a2->group(configRuntime);
   a3->group(configRuntime);
+  a4->group(configRuntime);
+  a5->group(configRuntime);
+  a6->group(configRuntime);
 }
 
 void ArgConfig::addThreadingArgs(CLI::App& app) {
 #if (vt_feature_fcontext != 0)
   auto ult_disable = "Disable running handlers in user-level threads";
   auto stack_size = "The default stack size for user-level threads";
+  auto pool_max = "Max number of free user-level thread stacks cached per "
+                  "size class";
+  auto pool_hot = "Number of cached stacks per size class kept fully "
+                  "committed in memory";
 
   auto a1 = app.add_flag(
     "--vt_ult_disable", config_.vt_ult_disable, ult_disable
@@ -548,11 +638,43 @@ void ArgConfig::addThreadingArgs(CLI::App& app) {
   auto a2 = app.add_option(
     "--vt_ult_stack_size", config_.vt_ult_stack_size, stack_size, true
   );
+  auto a3 = app.add_option(
+    "--vt_ult_stack_pool_max", config_.vt_ult_stack_pool_max, pool_max, true
+  );
+  auto a4 = app.add_option(
+    "--vt_ult_stack_pool_hot", config_.vt_ult_stack_pool_hot, pool_hot, true
+  );
 
   auto configThreads = "Threads";
   a1->group(configThreads);
   a2->group(configThreads);
+  a3->group(configThreads);
+  a4->group(configThreads);
 #endif
+
+  auto coll_par = "Execute collection broadcast handlers concurrently across "
+                  "worker threads (handlers must be thread-safe)";
+  auto coll_con = "Construct local collection elements concurrently across "
+                  "worker threads (constructors must be thread-safe)";
+  auto coll_min = "Minimum number of local elements before a broadcast is "
+                  "delivered or elements are constructed concurrently";
+
+  auto b1 = app.add_flag(
+    "--vt_coll_parallel_deliver", config_.vt_coll_parallel_deliver, coll_par
+  );
+  auto b2 = app.add_option(
+    "--vt_coll_parallel_min_elms", config_.vt_coll_parallel_min_elms, coll_min,
+    true
+  );
+  auto b3 = app.add_flag(
+    "--vt_coll_parallel_construct", config_.vt_coll_parallel_construct,
+    coll_con
+  );
+
+  auto workerThreads = "Threads";
+  b1->group(workerThreads);
+  b2->group(workerThreads);
+  b3->group(workerThreads);
 }
 
 class VtFormatter : public CLI::Formatter {
@@ -62,6 +62,7 @@ struct RunnableNew {};
 
 #include <string>
 #include <cstring>
+#include <vector>
 
 #include <mpi.h>
 
@@ -91,9 +92,55 @@ Context::Context(bool const is_interop, MPI_Comm comm) {
   numNodes_ = static_cast<NodeType>(numNodesLocal);
   thisNode_ = static_cast<NodeType>(thisNodeLocal);
 
+  discoverHosts();
   setDefaultWorker();
 }
 
+void Context::discoverHosts() {
+  // The lowest rank sharing memory with this rank identifies the host
+  MPI_Comm shared_comm;
+  MPI_Comm_split_type(
+    communicator_, MPI_COMM_TYPE_SHARED, thisNode_, MPI_INFO_NULL,
+    &shared_comm
+  );
+
+  int leader = thisNode_;
+  MPI_Allreduce(MPI_IN_PLACE, &leader, 1, MPI_INT, MPI_MIN, shared_comm);
+  MPI_Comm_free(&shared_comm);
+
+  std::vector<int> leaders(numNodes_);
+  MPI_Allgather(&leader, 1, MPI_INT, &leaders[0], 1, MPI_INT, communicator_);
+
+  // Number hosts in order of their leader; leaders[i] <= i so a single pass
+  // assigns every leader before any rank that refers to it
+  nodeHost_.assign(numNodes_, uninitialized_destination);
+  numHosts_ = 0;
+  for (NodeType node = 0; node < numNodes_; node++) {
+    if (leaders[node] == node) {
+      nodeHost_[node] = numHosts_++;
+    } else {
+      nodeHost_[node] = nodeHost_[leaders[node]];
+    }
+  }
+
+  #if DEBUG_VT_CONTEXT
+    fmt::print(
+      "Context::discoverHosts node={}, host={}, num_hosts={}\n",
+      thisNode_, nodeHost_[thisNode_], numHosts_
+    );
+  #endif
+}
+
+std::vector<NodeType> Context::getNodesOnHost(NodeType host) const {
+  std::vector<NodeType> nodes;
+  for (NodeType node = 0; node < numNodes_; node++) {
+    if (nodeHost_[node] == host) {
+      nodes.push_back(node);
+    }
+  }
+  return nodes;
+}
+
 Context::~Context() {
   MPI_Comm_free(&communicator_);
 }
@@ -103,9 +150,12 @@ void Context::setDefaultWorker() {
 }
 
 DeclareClassOutsideInitTLS(Context, WorkerIDType, thisWorker_, no_worker_id)
+DeclareClassOutsideInitTLS(
+  Context, runnable::RunnableNew*, cur_task_, nullptr
+)
 
 void Context::setTask(runnable::RunnableNew* in_task) {
-  cur_task_ = in_task;
+  AccessClassTLS(Context, cur_task_) = in_task;
 }
 
 NodeType Context::getFromNodeCurrentTask() const {
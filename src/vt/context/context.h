@@ -45,6 +45,7 @@
 #define INCLUDED_VT_CONTEXT_CONTEXT_H
 
 #include <memory>
+#include <vector>
 #include <mpi.h>
 
 #include "vt/config.h"
@@ -120,6 +121,41 @@ struct Context : runtime::component::Component<Context> {
    */
   inline MPI_Comm getComm() const { return communicator_; }
 
+  /**
+   * \brief Get the number of hosts (shared-memory nodes) the runtime spans
+   *
+   * Ranks are grouped by \c MPI_COMM_TYPE_SHARED at startup; hosts are
+   * numbered in order of their lowest rank.
+   *
+   * \return the number of hosts
+   */
+  inline NodeType getNumHosts() const { return numHosts_; }
+
+  /**
+   * \brief Get the host (shared-memory node) a given node runs on
+   *
+   * \param[in] node the node
+   *
+   * \return the host index in \c [0, getNumHosts())
+   */
+  inline NodeType getHost(NodeType node) const { return nodeHost_[node]; }
+
+  /**
+   * \brief Get the host (shared-memory node) this node runs on
+   *
+   * \return the host index in \c [0, getNumHosts())
+   */
+  inline NodeType getHost() const { return getHost(thisNode_); }
+
+  /**
+   * \brief Get all nodes that run on a given host, in ascending order
+   *
+   * \param[in] host the host index
+   *
+   * \return the nodes sharing that host
+   */
+  std::vector<NodeType> getNodesOnHost(NodeType host) const;
+
   /**
    * \brief Relevant only in threaded mode (e.g., \c std::thread, or OpenMP
    * threads), gets the number of worker threads being used on a given node
@@ -159,7 +195,9 @@ struct Context : runtime::component::Component<Context> {
     s | thisNode_
       | numNodes_
       | numWorkers_
-      | communicator_;
+      | communicator_
+      | numHosts_
+      | nodeHost_;
   }
 
   /**
@@ -167,7 +205,9 @@ struct Context : runtime::component::Component<Context> {
    *
    * \return the current running task
    */
-  runnable::RunnableNew* getTask() const { return cur_task_; }
+  runnable::RunnableNew* getTask() const {
+    return AccessClassTLS(Context, cur_task_);
+  }
 
   /**
    * \brief Get the node that caused the current running task to execute; i.e.,
@@ -217,13 +257,18 @@ private:
   /// Set the default worker that runs in threaded mode
   void setDefaultWorker();
 
+  /// Discover which nodes share a host (collective over the communicator)
+  void discoverHosts();
+
 private:
   NodeType thisNode_ = uninitialized_destination;
   NodeType numNodes_ = uninitialized_destination;
   WorkerCountType numWorkers_ = no_workers;
   MPI_Comm communicator_ = MPI_COMM_WORLD;
+  NodeType numHosts_ = 1;
+  std::vector<NodeType> nodeHost_ = {};
   DeclareClassInsideInitTLS(Context, WorkerIDType, thisWorker_, no_worker_id)
-  runnable::RunnableNew* cur_task_ = nullptr;
+  DeclareClassInsideInitTLS(Context, runnable::RunnableNew*, cur_task_, nullptr)
 };
 
 }} // end namespace vt::ctx
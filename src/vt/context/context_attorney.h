@@ -51,6 +51,10 @@
 #include "vt/runnable/runnable.fwd.h"
 #include "vt/context/runnable_context/set_context.fwd.h"
 
+namespace vt { namespace worker {
+struct ForkJoinSection;
+}} /* end namespace vt::worker */
+
 namespace vt {  namespace ctx {
 
 /** \file */
@@ -75,6 +79,8 @@ struct ContextAttorney {
 
   /// Allow \c ctx::SetContext to modify the running task
   friend ctx::SetContext;
+  /// Allow deferred fork-join actions to run as their originating task
+  friend worker::ForkJoinSection;
 
 private:
   /// Allow internal runtime to set the worker
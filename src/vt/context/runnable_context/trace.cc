@@ -51,6 +51,8 @@
 #include "vt/context/runnable_context/trace.h"
 #include "vt/registry/auto/auto_registry_interface.h"
 #include "vt/messaging/active.h"
+#include "vt/timing/timing.h"
+#include "vt/worker/fork_join_section.h"
 
 namespace vt { namespace ctx {
 
@@ -63,11 +65,20 @@ void Trace::begin() {
 
   if (is_collection_) {
     auto const cur_node = theContext()->getFromNodeCurrentTask();
-    auto const from_node =
+    from_node_ =
       from_node_ != uninitialized_destination ? from_node_ : cur_node;
+  }
+
+  // The trace log is not thread-safe: inside a fork-join section record the
+  // times here and log the event from the comm thread when the section merges
+  if (worker::ForkJoinSection::current() != nullptr) {
+    deferred_begin_time_ = timing::getCurrentTime();
+    return;
+  }
 
+  if (is_collection_) {
     processing_tag_ = theTrace()->beginProcessing(
-      trace_id, msg_size_, event_, from_node, idx1_, idx2_, idx3_, idx4_
+      trace_id, msg_size_, event_, from_node_, idx1_, idx2_, idx3_, idx4_
     );
   } else {
     processing_tag_ = theTrace()->beginProcessing(
@@ -81,6 +92,25 @@ void Trace::end() {
     return;
   }
 
+  auto section = worker::ForkJoinSection::current();
+  if (section != nullptr) {
+    auto const trace_id = auto_registry::handlerTraceID(handler_, han_type_);
+    auto const begin_time = deferred_begin_time_;
+    auto const end_time = timing::getCurrentTime();
+    auto const msg_size = msg_size_;
+    auto const event = event_;
+    auto const from_node = from_node_;
+    auto const idx1 = idx1_, idx2 = idx2_, idx3 = idx3_, idx4 = idx4_;
+    section->defer([=]{
+      auto const tag = theTrace()->beginProcessing(
+        trace_id, msg_size, event, from_node, idx1, idx2, idx3, idx4,
+        begin_time
+      );
+      theTrace()->endProcessing(tag, end_time);
+    });
+    return;
+  }
+
   theTrace()->endProcessing(processing_tag_);
 }
 
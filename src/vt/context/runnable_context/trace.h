@@ -48,6 +48,7 @@
 #include "vt/trace/trace_common.h"
 #include "vt/messaging/envelope/envelope_get.h"
 #include "vt/registry/auto/auto_registry_common.h"
+#include "vt/timing/timing_type.h"
 
 namespace vt { namespace ctx {
 
@@ -128,6 +129,8 @@ private:
   uint64_t idx1_ = 0, idx2_ = 0, idx3_ = 0, idx4_ = 0;
   /// The open processing tag
   trace::TraceProcessingTag processing_tag_;
+  /// The begin time recorded when the event is logged after a fork-join
+  TimeType deferred_begin_time_ = 0.;
 };
 
 #else
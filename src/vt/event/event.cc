@@ -199,8 +199,11 @@ void AsyncEvent::finalize() {
 }
 
 int AsyncEvent::progress() {
-  theEvent()->testEventsTrigger();
-  return 0;
+  return theEvent()->testEventsTrigger();
+}
+
+bool AsyncEvent::hasPendingWork() {
+  return polling_event_container_.size() > 0;
 }
 
 bool AsyncEvent::isLocalTerm() {
@@ -301,7 +304,7 @@ AsyncEvent::EventStateType AsyncEvent::testEventComplete(EventType const& event)
   }
 }
 
-void AsyncEvent::testEventsTrigger(int const& num_events) {
+int AsyncEvent::testEventsTrigger(int const& num_events) {
 # if vt_check_enabled(trace_enabled)
   int32_t num_completed  = 0;
   TimeType tr_begin = 0.0;
@@ -312,6 +315,7 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
 # endif
 
   int cur = 0;
+  int completed = 0;
   auto& cont = polling_event_container_;
 
   if (cont.size() > 0) {
@@ -336,6 +340,7 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
       holder.executeActions();
       iter = polling_event_container_.erase(iter);
       lookup_container_.erase(id);
+      completed++;
 
 #     if vt_check_enabled(trace_enabled)
       if (theConfig()->vt_trace_event_polling) {
@@ -364,6 +369,8 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
     (void)num_completed;
   }
 # endif
+
+  return completed;
 }
 
 }} //end namespace vt::event
@@ -177,8 +177,9 @@ struct AsyncEvent : runtime::component::PollableComponent<AsyncEvent> {
   void removeEventID(EventType const& event);
   EventStateType testEventComplete(EventType const& event);
   EventType attachAction(EventType const& event, ActionType callable);
-  void testEventsTrigger(int const& num_events = num_check_actions);
+  int testEventsTrigger(int const& num_events = num_check_actions);
   int progress() override;
+  bool hasPendingWork() override;
   bool isLocalTerm();
 
   static void eventFinished(EventFinishedMsg* msg);
@@ -52,9 +52,32 @@
 #include "vt/collective/reduce/reduce.h"
 
 #include <memory>
+#include <vector>
 
 namespace vt { namespace group {
 
+/**
+ * \struct ScanTree
+ *
+ * \brief One node's part of the spanning tree that the scan construction path
+ * derives from a group's membership bitmap. Members are ordered by node and
+ * arranged in a complete \c scan_tree_arity-ary tree rooted at the lowest
+ * member.
+ */
+struct ScanTree {
+  using NodeListType = std::vector<NodeType>;
+
+  NodeType root_          = uninitialized_destination;
+  NodeType parent_        = uninitialized_destination;
+  NodeListType children_  = {};
+  NodeType size_          = 0;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | root_ | parent_ | children_ | size_;
+  }
+};
+
 struct GroupCollective {
   using TreeType = collective::tree::Tree;
   using TreePtrType = std::unique_ptr<TreeType>;
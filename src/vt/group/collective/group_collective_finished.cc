@@ -76,4 +76,15 @@ void InfoColl::CollSetupFinished::operator()(FinishedReduceMsg* msg) {
   }
 }
 
+void InfoColl::CollScanFinished::operator()(MembershipReduceMsg* msg) {
+  vt_debug_print(
+    verbose, group,
+    "CollScanFinished: group={:x}\n", msg->getGroup()
+  );
+  auto nmsg = makeMessage<GroupMembershipMsg>(
+    msg->getGroup(), msg->getConstVal()
+  );
+  theMsg()->broadcastMsg<GroupMembershipMsg,InfoColl::membershipHan>(nmsg);
+}
+
 }} /* end namespace vt::group */
@@ -50,6 +50,7 @@
 #include "vt/messaging/message.h"
 
 #include <cstdlib>
+#include <vector>
 
 namespace vt { namespace group {
 
@@ -93,6 +94,36 @@ private:
 
 using GroupCollectiveMsg = GroupCollectiveInfoMsg<GroupMsg<::vt::Message>>;
 
+/**
+ * \struct GroupMembershipMsg
+ *
+ * \brief Broadcasts the complete membership bitmap of a collective group so
+ * every node can derive its part of the spanning tree locally
+ */
+struct GroupMembershipMsg : ::vt::Message {
+  using MessageParentType = ::vt::Message;
+  vt_msg_serialize_required(); // for members_
+
+  GroupMembershipMsg() = default;
+  GroupMembershipMsg(GroupType const in_group, std::vector<uint64_t> in_bits)
+    : group_(in_group),
+      members_(std::move(in_bits))
+  { }
+
+  GroupType getGroup() const { return group_; }
+  std::vector<uint64_t> const& getMembers() const { return members_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | group_ | members_;
+  }
+
+private:
+  GroupType group_ = no_group;
+  std::vector<uint64_t> members_ = {};
+};
+
 }} /* end namespace vt::group */
 
 #endif /*INCLUDED_VT_GROUP_COLLECTIVE_GROUP_COLLECTIVE_MSG_H*/
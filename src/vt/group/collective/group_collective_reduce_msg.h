@@ -49,6 +49,8 @@
 #include "vt/group/collective/group_collective_msg.h"
 #include "vt/collective/reduce/reduce.h"
 
+#include <vector>
+
 namespace vt { namespace group {
 
 struct FinishedReduceMsg : collective::ReduceTMsg<collective::NoneType> {
@@ -63,6 +65,39 @@ private:
   GroupType group_ = no_group;
 };
 
+/**
+ * \struct MembershipReduceMsg
+ *
+ * \brief Reduces the membership bitmap (one bit per node) of a collective group
+ * under construction
+ */
+struct MembershipReduceMsg : SerializeRequired<
+  collective::ReduceTMsg<std::vector<uint64_t>>,
+  MembershipReduceMsg
+> {
+  using MessageParentType = SerializeRequired<
+    collective::ReduceTMsg<std::vector<uint64_t>>,
+    MembershipReduceMsg
+  >;
+
+  MembershipReduceMsg() = default;
+  MembershipReduceMsg(GroupType const in_group, std::vector<uint64_t> in_bits)
+    : MessageParentType(std::move(in_bits)),
+      group_(in_group)
+  { }
+
+  GroupType getGroup() const { return group_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | group_;
+  }
+
+private:
+  GroupType group_ = no_group;
+};
+
 }} /* end namespace vt::group */
 
 #endif /*INCLUDED_VT_GROUP_COLLECTIVE_GROUP_COLLECTIVE_REDUCE_MSG_H*/
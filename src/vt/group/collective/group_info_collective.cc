@@ -51,6 +51,7 @@
 #include "vt/group/collective/group_collective_util.h"
 #include "vt/group/group_manager.h"
 #include "vt/context/context.h"
+#include "vt/configs/arguments/app_config.h"
 #include "vt/messaging/active.h"
 #include "vt/collective/tree/tree.h"
 #include "vt/collective/collective_alg.h"
@@ -109,6 +110,154 @@ void InfoColl::freeComm() {
   }
 }
 
+void InfoColl::makeMPIGroup() {
+  // Create the MPI group, and wait for all nodes to get here. In theory, this
+  // might be overlapable with VT's group construction, but for now just wait
+  // on it here. These should be ordered within this scope, as the collective
+  // group creation is a collective invocation.
+  auto const in_group = is_in_group;
+  theGroup()->collective_scope_.mpiCollectiveWait(
+    [in_group,this]{
+      auto const this_node_impl = theContext()->getNode();
+      auto const cur_comm = theContext()->getComm();
+      int32_t const group_color = in_group;
+      MPI_Comm_split(cur_comm, group_color, this_node_impl, &mpi_group_comm_);
+    }
+  );
+}
+
+void InfoColl::setupCollectiveScan() {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const& group_ = getGroupID();
+
+  vt_debug_print(
+    terse, group,
+    "InfoColl::setupCollectiveScan: is_in_group={}, group_={:x}\n",
+    is_in_group, group_
+  );
+
+  if (make_mpi_group_) {
+    makeMPIGroup();
+  }
+
+  /*
+   *  Instead of reorganizing the default spanning tree over several rounds,
+   *  OR together one bit per node up the default tree and broadcast the result
+   *  back down. Every node then derives the same group tree locally.
+   */
+  std::vector<uint64_t> members((num_nodes + 63) / 64, 0);
+  if (is_in_group) {
+    members[this_node / 64] |= uint64_t{1} << (this_node % 64);
+  }
+
+  using collective::reduce::makeStamp;
+  using collective::reduce::StrongUserID;
+
+  auto const& root = 0;
+  auto stamp = makeStamp<StrongUserID>(group_);
+  auto msg = makeMessage<MembershipReduceMsg>(group_, std::move(members));
+  using OpType = collective::BitOrOp<std::vector<uint64_t>>;
+
+  auto r = theGroup()->reducer();
+  r->reduce<OpType,CollScanFinished>(root, msg.get(), stamp);
+}
+
+/*static*/ ScanTree InfoColl::buildScanTree(
+  std::vector<uint64_t> const& members, NodeType const node
+) {
+  static constexpr NodeType const scan_tree_arity = 4;
+
+  // Members in node order; the position of a member is its index in the tree
+  std::vector<NodeType> nodes;
+  NodeType pos = uninitialized_destination;
+  for (std::size_t w = 0; w < members.size(); w++) {
+    if (members[w] == 0) {
+      continue;
+    }
+    for (int b = 0; b < 64; b++) {
+      if ((members[w] >> b) & 1) {
+        auto const n = static_cast<NodeType>(w * 64 + b);
+        if (n == node) {
+          pos = static_cast<NodeType>(nodes.size());
+        }
+        nodes.push_back(n);
+      }
+    }
+  }
+
+  ScanTree t;
+  t.size_ = static_cast<NodeType>(nodes.size());
+  if (nodes.empty()) {
+    return t;
+  }
+
+  t.root_ = nodes[0];
+  if (pos != uninitialized_destination) {
+    if (pos != 0) {
+      t.parent_ = nodes[(pos - 1) / scan_tree_arity];
+    }
+    for (NodeType k = 1; k <= scan_tree_arity; k++) {
+      auto const c = pos * scan_tree_arity + k;
+      if (c < t.size_) {
+        t.children_.push_back(nodes[c]);
+      }
+    }
+  }
+  return t;
+}
+
+void InfoColl::scanTree(std::vector<uint64_t> const& members) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const& group_ = getGroupID();
+
+  auto const t = buildScanTree(members, this_node);
+
+  vt_debug_print(
+    normal, group,
+    "InfoColl::scanTree: group={:x}, size={}, root={}, parent={}, "
+    "children={}\n",
+    group_, t.size_, t.root_, t.parent_, t.children_.size()
+  );
+
+  is_empty_group_   = t.size_ == 0;
+  is_default_group_ = t.size_ == num_nodes;
+  known_root_node_  = t.root_;
+  is_new_root_      = t.root_ == this_node;
+  has_root_         = true;
+  in_phase_two_     = true;
+  subtree_          = static_cast<std::size_t>(t.size_);
+
+  if (is_in_group) {
+    collective_->parent_        = t.parent_;
+    collective_->span_children_ = t.children_;
+    collective_->span_          = std::make_unique<TreeType>(
+      is_new_root_, collective_->parent_, collective_->span_children_
+    );
+    theCollective()->makeReducerGroup(group_, collective_->span_.get());
+    collective_->reduce_ = theCollective()->getReducerGroup(group_);
+  }
+
+  auto const& action = getAction();
+  if (action) {
+    action();
+  }
+  auto cur_actions = pending_ready_actions_;
+  pending_ready_actions_.clear();
+  for (auto&& act : cur_actions) {
+    act();
+  }
+}
+
+/*static*/ void InfoColl::membershipHan(GroupMembershipMsg* msg) {
+  auto iter = theGroup()->local_collective_group_info_.find(msg->getGroup());
+  vtAssert(
+    iter != theGroup()->local_collective_group_info_.end(), "Must exist"
+  );
+  iter->second->scanTree(msg->getMembers());
+}
+
 void InfoColl::setupCollective() {
   auto const& num_nodes = theContext()->getNumNodes();
   auto const& group_ = getGroupID();
@@ -123,6 +272,10 @@ void InfoColl::setupCollective() {
     return setupCollectiveSingular();
   }
 
+  if (theConfig()->vt_group_scan_construct) {
+    return setupCollectiveScan();
+  }
+
   auto const& in_group = is_in_group;
   auto const& parent = collective_->getInitialParent();
   auto const& children = collective_->getInitialChildren();
@@ -137,18 +290,7 @@ void InfoColl::setupCollective() {
   );
 
   if (make_mpi_group_) {
-    // Create the MPI group, and wait for all nodes to get here. In theory, this
-    // might be overlapable with VT's group construction, but for now just wait
-    // on it here. These should be ordered within this scope, as the collective
-    // group creation is a collective invocation.
-    theGroup()->collective_scope_.mpiCollectiveWait(
-      [in_group,this]{
-        auto const this_node_impl = theContext()->getNode();
-        auto const cur_comm = theContext()->getComm();
-        int32_t const group_color = in_group;
-        MPI_Comm_split(cur_comm, group_color, this_node_impl, &mpi_group_comm_);
-      }
-    );
+    makeMPIGroup();
   }
 
   down_tree_cont_     = theGroup()->nextCollectiveID();
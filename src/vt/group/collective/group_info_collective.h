@@ -55,6 +55,7 @@
 
 #include <memory>
 #include <list>
+#include <vector>
 
 #include <mpi.h>
 
@@ -84,6 +85,14 @@ private:
     void operator()(FinishedReduceMsg* msg);
   };
 
+  /*
+   *  Reduce target of the scan construction path: the root broadcasts the
+   *  complete membership to every node.
+   */
+  struct CollScanFinished {
+    void operator()(MembershipReduceMsg* msg);
+  };
+
 public:
   ReducePtrType getReduce() const;
   NodeType getRoot() const;
@@ -99,6 +108,8 @@ public:
 protected:
   void setupCollective();
   void setupCollectiveSingular();
+  void setupCollectiveScan();
+  void makeMPIGroup();
 
   static void upHan(GroupCollectiveMsg* msg);
   static void downHan(GroupCollectiveMsg* msg);
@@ -107,6 +118,7 @@ protected:
   static void finalizeHan(GroupOnlyMsg* msg);
   static void newTreeHan(GroupOnlyMsg* msg);
   static void tree(GroupOnlyMsg* msg);
+  static void membershipHan(GroupMembershipMsg* msg);
 
 private:
   void upTree();
@@ -120,6 +132,10 @@ private:
   void sendDownNewTree();
   void newTree(NodeType const& parent);
   RemoteOperationIDType makeCollectiveContinuation(GroupType const group_);
+  void scanTree(std::vector<uint64_t> const& members);
+  static ScanTree buildScanTree(
+    std::vector<uint64_t> const& members, NodeType const node
+  );
 
 protected:
   bool is_in_group                       = false;
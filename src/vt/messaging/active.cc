@@ -46,6 +46,7 @@
 #include "vt/configs/arguments/app_config.h"
 #include "vt/messaging/active.h"
 #include "vt/messaging/envelope.h"
+#include "vt/messaging/envelope/envelope_compact.h"
 #include "vt/messaging/message/smart_ptr.h"
 #include "vt/termination/term_headers.h"
 #include "vt/group/group_manager_active_attorney.h"
@@ -150,6 +151,15 @@ ActiveMessenger::ActiveMessenger()
       UnitType::Bytes
     )
   };
+
+  // Number of messages sent with a compact envelope and the bytes saved
+  amCompactSentCount = registerCounter(
+    "AM_compact_sent", "active messages sent with a compact envelope"
+  );
+  amCompactBytesSaved = registerCounter(
+    "AM_compact_bytes_saved", "envelope bytes saved by compact envelopes",
+    UnitType::Bytes
+  );
 }
 
 void ActiveMessenger::startup() {
@@ -187,6 +197,12 @@ trace::TraceEventIDType ActiveMessenger::makeTraceCreationSend(
   ByteType serialized_msg_size, bool is_bcast
 ) {
   #if vt_check_enabled(trace_enabled)
+    // The trace log is not thread-safe: sends issued inside a fork-join
+    // section are recorded without a creation event
+    if (worker::ForkJoinSection::current() != nullptr) {
+      return trace::no_trace_event;
+    }
+
     trace::TraceEntryIDType ep = auto_registry::handlerTraceID(handler, type);
     trace::TraceEventIDType event = trace::no_trace_event;
     if (not is_bcast) {
@@ -411,6 +427,84 @@ EventType ActiveMessenger::sendMsgMPI(
   }
 }
 
+struct CompactWireMsg : ShortMessage { };
+
+bool ActiveMessenger::shouldCompactMsg(
+  MsgSharedPtr<BaseMsgType> const& base, MsgSizeType const& msg_size,
+  TagType const& send_tag
+) const {
+  return
+    theConfig()->vt_compact_envelope and
+    send_tag == static_cast<MPI_TagType>(MPITag::ActiveMsgTag) and
+    static_cast<std::size_t>(msg_size) <=
+      theConfig()->vt_compact_envelope_max_size and
+    static_cast<std::size_t>(msg_size) < theConfig()->vt_max_mpi_send_size and
+    envelopeCanCompact(base->env);
+}
+
+EventType ActiveMessenger::sendMsgCompact(
+  NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
+  MsgSizeType const& msg_size, TagType const& send_tag
+) {
+  char* untyped_msg = reinterpret_cast<char*>(base.get());
+  auto const env_size = envelopeFullSize(base->env);
+  auto const payload_size = static_cast<std::size_t>(msg_size) - env_size;
+
+  // The wire bytes live in the extra bytes of a holder message so the MPI
+  // event can keep them alive until the send completes
+  auto wire = makeMessageSz<CompactWireMsg>(
+    envelope_compact_max_bytes + payload_size
+  );
+  char* wire_buf = reinterpret_cast<char*>(wire.get()) + sizeof(CompactWireMsg);
+  auto const header_size = envelopeCompactEncode(base->env, dest, wire_buf);
+  std::memcpy(wire_buf + header_size, untyped_msg + env_size, payload_size);
+  auto const wire_size = header_size + payload_size;
+
+  vt_debug_print(
+    terse, active,
+    "sendMsgCompact: dest={}, msg_size={}, wire_size={}, send_tag={}\n",
+    dest, msg_size, wire_size, send_tag
+  );
+
+  amCompactSentCount.increment(1);
+  amCompactBytesSaved.increment(
+    msg_size - static_cast<MsgSizeType>(wire_size)
+  );
+
+  auto const event_id = theEvent()->createMPIEvent(this_node_);
+  auto& holder = theEvent()->getEventHolder(event_id);
+  auto mpi_event = holder.get_event();
+
+  mpi_event->setManagedMessage(wire.to<ShortMessage>());
+
+  {
+    VT_ALLOW_MPI_CALLS;
+    #if vt_check_enabled(trace_enabled)
+      double tr_begin = 0;
+      if (theConfig()->vt_trace_mpi) {
+        tr_begin = vt::timing::getCurrentTime();
+      }
+    #endif
+    int const ret = MPI_Isend(
+      wire_buf, static_cast<int>(wire_size), MPI_BYTE, dest, send_tag,
+      theContext()->getComm(), mpi_event->getRequest()
+    );
+    vtAssertMPISuccess(ret, "MPI_Isend");
+
+    #if vt_check_enabled(trace_enabled)
+      if (theConfig()->vt_trace_mpi) {
+        auto tr_end = vt::timing::getCurrentTime();
+        auto tr_note = fmt::format(
+          "Isend(AM compact): dest={}, bytes={}", dest, wire_size
+        );
+        trace::addUserBracketedNote(tr_begin, tr_end, tr_note, trace_isend);
+      }
+    #endif
+  }
+
+  return event_id;
+}
+
 EventType ActiveMessenger::sendMsgBytes(
   NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
   MsgSizeType const& msg_size, TagType const& send_tag
@@ -442,7 +536,9 @@ EventType ActiveMessenger::sendMsgBytes(
   }
   amSentCounterGauge.incrementUpdate(msg_size, 1);
 
-  EventType const event_id = sendMsgMPI(dest, base, msg_size, send_tag);
+  EventType const event_id = shouldCompactMsg(base, msg_size, send_tag) ?
+    sendMsgCompact(dest, base, msg_size, send_tag) :
+    sendMsgMPI(dest, base, msg_size, send_tag);
 
   if (not is_term) {
     theTerm()->produce(epoch,1,dest);
@@ -1109,7 +1205,44 @@ bool ActiveMessenger::tryProcessIncomingActiveMsg() {
   }
 }
 
+void ActiveMessenger::expandCompactMsg(InProgressIRecv* irecv) {
+  char* wire_buf = irecv->buf;
+  auto const wire_size = static_cast<std::size_t>(irecv->probe_bytes);
+
+  EpochTagEnvelope env_storage;
+  char* env_buf = reinterpret_cast<char*>(&env_storage);
+  auto const header_size = envelopeCompactDecode(
+    wire_buf, wire_size, this_node_, env_buf
+  );
+  auto const env_size =
+    envelopeFullSize(*reinterpret_cast<Envelope*>(env_buf));
+  auto const payload_size = wire_size - header_size;
+  auto const msg_size = env_size + payload_size;
+
+  #if vt_check_enabled(memory_pool)
+    char* buf = static_cast<char*>(thePool()->alloc(msg_size));
+  #else
+    char* buf = static_cast<char*>(std::malloc(msg_size));
+  #endif
+
+  std::memcpy(buf, env_buf, env_size);
+  std::memcpy(buf + env_size, wire_buf + header_size, payload_size);
+
+  #if vt_check_enabled(memory_pool)
+    thePool()->dealloc(wire_buf);
+  #else
+    std::free(wire_buf);
+  #endif
+
+  irecv->buf = buf;
+  irecv->probe_bytes = static_cast<MsgSizeType>(msg_size);
+}
+
 void ActiveMessenger::finishPendingActiveMsgAsyncRecv(InProgressIRecv* irecv) {
+  if (envelopeIsCompact(irecv->buf)) {
+    expandCompactMsg(irecv);
+  }
+
   char* buf = irecv->buf;
   auto num_probe_bytes = irecv->probe_bytes;
   auto sender = irecv->sender;
@@ -1324,6 +1457,22 @@ void ActiveMessenger::registerAsyncOp(std::unique_ptr<AsyncOp> in) {
   in_progress_ops.emplace(AsyncOpWrapper{std::move(in)});
 }
 
+void ActiveMessenger::registerAsyncOp(
+  std::unique_ptr<AsyncOp> in, TimeType timeout
+) {
+  // The op is owned by the wrapper, whose done() cancels the timer before the
+  // op is destroyed, so the raw pointer stays valid while the timer is live
+  auto op = in.get();
+  auto const timer = theSched()->addTimer(timeout, [op]{ op->expire(); });
+  in_progress_ops.emplace(AsyncOpWrapper{std::move(in), no_thread_id, timer});
+}
+
+void ActiveMessenger::registerAsyncOpResume(
+  std::unique_ptr<AsyncOp> op, ThreadIDType resume_id
+) {
+  in_progress_ops.emplace(AsyncOpWrapper{std::move(op), resume_id});
+}
+
 void ActiveMessenger::blockOnAsyncOp(std::unique_ptr<AsyncOp> op) {
 #if vt_check_enabled(fcontext)
   using TA = sched::ThreadAction;
@@ -64,6 +64,7 @@
 #include "vt/runtime/component/component_pack.h"
 #include "vt/elm/elm_id.h"
 #include "vt/elm/elm_stats.h"
+#include "vt/worker/fork_join_section.h"
 
 #if vt_check_enabled(trace_enabled)
   #include "vt/trace/trace_headers.h"
@@ -378,6 +379,15 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
   template <typename MsgPtrT>
   void markAsCollectionMessage(MsgPtrT const msg);
 
+  /**
+   * \brief Mark a message as a runtime control message so it is enqueued on
+   * the system scheduler queue instead of behind application handlers
+   *
+   * \param[in] msg the message to mark as a system message
+   */
+  template <typename MsgPtrT>
+  void markAsSystemMessage(MsgPtrT const msg);
+
   /**
    * \brief Set the epoch in the envelope of a message
    *
@@ -1350,6 +1360,14 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
    */
   int progress() override;
 
+  /**
+   * \internal
+   * \brief Messages can arrive at any time, so the probe is never backed off
+   *
+   * \return false
+   */
+  bool backoffWhenIdle() override { return false; }
+
   /**
    * \internal
    * \brief Register a bare handler
@@ -1511,6 +1529,38 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
     MsgSizeType const& msg_size, TagType const& send_tag
   );
 
+  /**
+   * \internal
+   * \brief Send a small message with its envelope replaced by a compact wire
+   * header
+   *
+   * \param[in] dest the destination of the message
+   * \param[in] base the message base pointer
+   * \param[in] msg_size the size of the message
+   * \param[in] send_tag the send tag on the message
+   *
+   * \return the event to test/wait for completion
+   */
+  EventType sendMsgCompact(
+    NodeType const& dest, MsgSharedPtr<BaseMsgType> const& base,
+    MsgSizeType const& msg_size, TagType const& send_tag
+  );
+
+  /**
+   * \internal
+   * \brief Test whether a message should be sent with a compact envelope
+   *
+   * \param[in] base the message base pointer
+   * \param[in] msg_size the size of the message
+   * \param[in] send_tag the send tag on the message
+   *
+   * \return whether to send it compacted
+   */
+  bool shouldCompactMsg(
+    MsgSharedPtr<BaseMsgType> const& base, MsgSizeType const& msg_size,
+    TagType const& send_tag
+  ) const;
+
   /**
    * \internal
    * \brief Get the current global epoch
@@ -1562,7 +1612,7 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
    * \internal
    * \brief Access the epoch stack
    */
-  inline EpochStackType& getEpochStack() { return epoch_stack_; }
+  inline EpochStackType& getEpochStack() { return curEpochStack(); }
 
   /**
    * \internal
@@ -1622,6 +1672,16 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
    */
   void registerAsyncOp(std::unique_ptr<AsyncOp> op);
 
+  /**
+   * \brief Register a async operation that needs polling with a timeout. If
+   * it has not completed when the timeout expires, \c AsyncOp::timedOut is
+   * called instead of \c AsyncOp::done.
+   *
+   * \param[in] op the async operation to register
+   * \param[in] timeout seconds to wait for completion
+   */
+  void registerAsyncOp(std::unique_ptr<AsyncOp> op, TimeType timeout);
+
   /**
    * \brief Block the current task's execution on an pollable async operation
    * until it completes
@@ -1633,6 +1693,18 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
    */
   void blockOnAsyncOp(std::unique_ptr<AsyncOp> op);
 
+  /**
+   * \brief Register an async operation that resumes a suspended unit (e.g., a
+   * coroutine) held by the scheduler when it completes
+   *
+   * \param[in] op the async operation to register
+   * \param[in] resume_id the suspended unit ID passed to
+   * \c Scheduler::resume on completion
+   */
+  void registerAsyncOpResume(
+    std::unique_ptr<AsyncOp> op, ThreadIDType resume_id
+  );
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | maybe_ready_tag_han_
@@ -1644,6 +1716,8 @@ struct ActiveMessenger : runtime::component::PollableComponent<ActiveMessenger>
       | in_progress_data_irecv
       | in_progress_ops
       | this_node_
+      | amCompactBytesSaved
+      | amCompactSentCount
       | amForwardCounterGauge
       | amHandlerCount
       | amPollCount
@@ -1720,11 +1794,26 @@ private:
    */
   void finishPendingActiveMsgAsyncRecv(InProgressIRecv* irecv);
 
+  /**
+   * \brief Expand a received compact wire header back into a full in-memory
+   * message, replacing the receive buffer
+   *
+   * \param[in,out] irecv the completed receive
+   */
+  void expandCompactMsg(InProgressIRecv* irecv);
+
   /**
    * \brief Called when a VT-MPI message has been received.
    */
   void finishPendingDataMsgAsyncRecv(InProgressDataIRecv* irecv);
 
+  /**
+   * \brief Get the epoch stack for the calling thread: the stack of the active
+   * \c worker::ForkJoinSection, if any, otherwise the messenger's own stack
+   */
+  inline EpochStackType& curEpochStack();
+  inline EpochStackType const& curEpochStack() const;
+
 private:
 # if vt_check_enabled(trace_enabled)
   trace::UserEventIDType trace_irecv             = trace::no_user_event_id;
@@ -1768,6 +1857,10 @@ private:
   // Diagnostic counters for counting forwarded messages
   diagnostic::CounterGauge amForwardCounterGauge;
 
+  // Diagnostic counters for messages sent with a compact envelope
+  diagnostic::Counter amCompactSentCount;
+  diagnostic::Counter amCompactBytesSaved;
+
 private:
   elm::ElementIDStruct bare_handler_dummy_elm_id_for_lb_stats_ = {};
   elm::ElementStats bare_handler_stats_;
@@ -62,6 +62,7 @@ constexpr NodeType broadcast_dest = uninitialized_destination;
 template <typename MsgPtrT>
 void ActiveMessenger::markAsTermMessage(MsgPtrT const msg) {
   setTermType(msg->env);
+  envelopeSetSchedQueue(msg->env, SchedQueue::System);
 #if vt_check_enabled(priorities)
   envelopeSetPriority(msg->env, sys_min_priority);
 #endif
@@ -91,6 +92,11 @@ void ActiveMessenger::markAsCollectionMessage(MsgPtrT const msg) {
 #endif
 }
 
+template <typename MsgPtrT>
+void ActiveMessenger::markAsSystemMessage(MsgPtrT const msg) {
+  envelopeSetSchedQueue(msg->env, SchedQueue::System);
+}
+
 template <typename MsgT>
 void ActiveMessenger::setEpochMessage(MsgT* msg, EpochType epoch) {
   envelopeSetEpoch(msg->env, epoch);
@@ -128,6 +134,22 @@ ActiveMessenger::PendingSendType ActiveMessenger::sendMsgSerializableImpl(
   // This is for consistency with sending non-serialized messages.
   envelopeSetIsLocked(msg->env, true);
 
+  if (worker::ForkJoinSection::current() != nullptr) {
+    // Serialized sends may post MPI operations directly; inside a fork-join
+    // section run the whole send on the comm thread when the section merges
+    MsgSharedPtr<MsgT> typed_msg = msg;
+    return PendingSendType(msg, [=](MsgSharedPtr<BaseMsgType>&) mutable {
+      MsgT* raw = typed_msg.get();
+      if (dest == broadcast_dest) {
+        SerializedMessenger::broadcastSerialMsg<MsgT>(
+          raw, han, envelopeGetDeliverBcast(raw->env)
+        );
+      } else {
+        SerializedMessenger::sendSerialMsg<MsgT>(dest, raw, han);
+      }
+    });
+  }
+
   if (dest == broadcast_dest) {
     return SerializedMessenger::broadcastSerialMsg<MsgT>(
       rawMsg, han, envelopeGetDeliverBcast(rawMsg->env)
@@ -445,12 +467,24 @@ ActiveMessenger::PendingSendType ActiveMessenger::broadcastMsgAuto(
   );
 }
 
+inline ActiveMessenger::EpochStackType& ActiveMessenger::curEpochStack() {
+  auto section = worker::ForkJoinSection::current();
+  return section != nullptr ? section->getEpochStack() : epoch_stack_;
+}
+
+inline ActiveMessenger::EpochStackType const&
+ActiveMessenger::curEpochStack() const {
+  auto section = worker::ForkJoinSection::current();
+  return section != nullptr ? section->getEpochStack() : epoch_stack_;
+}
+
 inline EpochType ActiveMessenger::getGlobalEpoch() const {
+  auto const& epoch_stack = curEpochStack();
   vtAssertInfo(
-    epoch_stack_.size() > 0, "Epoch stack size must be greater than zero",
-    epoch_stack_.size()
+    epoch_stack.size() > 0, "Epoch stack size must be greater than zero",
+    epoch_stack.size()
   );
-  return epoch_stack_.size() ? epoch_stack_.top() : term::any_epoch_sentinel;
+  return epoch_stack.size() ? epoch_stack.top() : term::any_epoch_sentinel;
 }
 
 inline void ActiveMessenger::pushEpoch(EpochType const& epoch) {
@@ -460,13 +494,14 @@ inline void ActiveMessenger::pushEpoch(EpochType const& epoch) {
    * current contexts pushed, transitively causally related active message
    * handlers.
    */
+  auto& epoch_stack = curEpochStack();
   vtAssertInfo(
     epoch != no_epoch, "Do not push no_epoch onto the epoch stack",
-    epoch, no_epoch, epoch_stack_.size(),
-    epoch_stack_.size() > 0 ? epoch_stack_.top() : no_epoch
+    epoch, no_epoch, epoch_stack.size(),
+    epoch_stack.size() > 0 ? epoch_stack.top() : no_epoch
   );
   if (epoch != no_epoch) {
-    epoch_stack_.push(epoch);
+    epoch_stack.push(epoch);
   }
 }
 
@@ -474,19 +509,20 @@ inline EpochType ActiveMessenger::popEpoch(EpochType const& epoch) {
   /*
    * popEpoch(epoch) shall remove the top entry from epoch_size_, iif the size
    * is non-zero and the `epoch' passed, if `epoch != no_epoch', is equal to the
-   * top of the `epoch_stack_.top()'; else, it shall remove any entry from the
+   * top of the `epoch_stack.top()'; else, it shall remove any entry from the
    * top of the stack.
    */
-  auto const& non_zero = epoch_stack_.size() > 0;
+  auto& epoch_stack = curEpochStack();
+  auto const& non_zero = epoch_stack.size() > 0;
   vtAssertExprInfo(
-    non_zero and (epoch_stack_.top() == epoch or epoch == no_epoch),
-    epoch, non_zero, epoch_stack_.top()
+    non_zero and (epoch_stack.top() == epoch or epoch == no_epoch),
+    epoch, non_zero, epoch_stack.top()
   );
   if (epoch == no_epoch) {
-    return non_zero ? epoch_stack_.pop(),epoch_stack_.top() : no_epoch;
+    return non_zero ? epoch_stack.pop(),epoch_stack.top() : no_epoch;
   } else {
-    return non_zero && epoch == epoch_stack_.top() ?
-      epoch_stack_.pop(),epoch :
+    return non_zero && epoch == epoch_stack.top() ?
+      epoch_stack.pop(),epoch :
       no_epoch;
   }
 }
@@ -52,9 +52,14 @@ AsyncOp::AsyncOp() {
 
 AsyncOp::AsyncOp(AsyncOp&& in) {
   cur_epoch_ = in.cur_epoch_;
+  expired_ = in.expired_;
   in.cur_epoch_ = no_epoch;
 }
 
+/*virtual*/ void AsyncOp::timedOut() {
+  vtAbort("AsyncOp did not complete before its timeout expired");
+}
+
 /*virtual*/ AsyncOp::~AsyncOp() {
   // This case only occurs in a moved-from instance, in which case the
   // move-ee will make the matching calls
@@ -80,6 +80,25 @@ struct AsyncOp {
    */
   virtual void done() = 0;
 
+  /**
+   * \brief Function that is triggered instead of \c done when the operation
+   * was registered with a timeout that expired before it completed. By
+   * default this aborts; override to recover (e.g., cancel the request).
+   */
+  virtual void timedOut();
+
+  /**
+   * \internal \brief Mark the operation as timed out
+   */
+  void expire() { expired_ = true; }
+
+  /**
+   * \brief Check whether the operation's timeout expired
+   *
+   * \return whether it timed out
+   */
+  bool isExpired() const { return expired_; }
+
   /**
    * \brief Serialize for footprinting
    *
@@ -90,11 +109,13 @@ struct AsyncOp {
    */
   template <typename SerializerT>
   void serialize(SerializerT& s) {
-    s | cur_epoch_;
+    s | cur_epoch_
+      | expired_;
   }
 
 protected:
   EpochType cur_epoch_ = no_epoch; /**< Enclosing epoch for the operation */
+  bool expired_ = false;           /**< Whether the timeout expired */
 };
 
 }} /* end namespace vt::messaging */
@@ -48,13 +48,18 @@ namespace vt { namespace messaging {
 
 bool AsyncOpWrapper::test(int& num_tests) {
   vtAssert(op_ != nullptr, "Must have valid operator");
-  auto const is_done = op_->poll();
+  auto const is_done = op_->isExpired() or op_->poll();
   num_tests++;
   return is_done;
 }
 
 void AsyncOpWrapper::done() {
-  op_->done();
+  if (op_->isExpired()) {
+    op_->timedOut();
+  } else {
+    theSched()->cancelTimer(timer_);
+    op_->done();
+  }
   op_ = nullptr;
 
   if (tid_ != no_thread_id) {
@@ -45,6 +45,7 @@
 #define INCLUDED_VT_MESSAGING_ASYNC_OP_WRAPPER_H
 
 #include "vt/messaging/async_op.h"
+#include "vt/scheduler/timer_wheel.h"
 
 #include <memory>
 
@@ -82,6 +83,22 @@ struct AsyncOpWrapper {
       tid_(in_tid)
   { }
 
+  /**
+   * \internal \brief Construct with unique pointer to operation, a thread ID
+   * to resume, and the timer that expires the operation
+   * \param[in] ptr the operation
+   * \param[in] tid the thread ID to resume after completion
+   * \param[in] timer the timeout timer, cancelled on completion
+   */
+  AsyncOpWrapper(
+    std::unique_ptr<AsyncOp> ptr, ThreadIDType in_tid,
+    sched::TimerIDType in_timer
+  ) : valid(true),
+      op_(std::move(ptr)),
+      tid_(in_tid),
+      timer_(in_timer)
+  { }
+
   /**
    * \internal \brief Test completion of the operation
    *
@@ -103,7 +120,7 @@ struct AsyncOpWrapper {
    */
   template <typename SerializerT>
   void serialize(SerializerT& s) {
-    s | valid | op_ | tid_;
+    s | valid | op_ | tid_ | timer_;
   }
 
 public:
@@ -112,6 +129,7 @@ public:
 private:
   std::unique_ptr<AsyncOp> op_ = nullptr;     /**< The enclosed operation  */
   ThreadIDType tid_ = no_thread_id;           /**< The thread ID to resume */
+  sched::TimerIDType timer_ = sched::no_timer; /**< The timeout timer */
 };
 
 }} /* end namespace vt::messaging */
@@ -46,6 +46,7 @@
 
 #include "vt/config.h"
 #include "vt/messaging/envelope/envelope_type.h"
+#include "vt/scheduler/sched_queue.h"
 
 #include <type_traits>
 
@@ -105,6 +106,9 @@ struct ActiveEnvelope {
   /// Used to denote that the message's bare handlers shouldn't record
   /// communication statistics due to redundancy
   bool comm_stats_recorded_above_bare_handler : 1;
+
+  /// The scheduler queue the message is enqueued on: \c sched::SchedQueue
+  uint8_t sched_queue : sched_queue_num_bits;
 };
 
 }} /* end namespace vt::messaging */
@@ -0,0 +1,259 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             envelope_compact.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/messaging/envelope.h"
+#include "vt/messaging/envelope/envelope_compact.h"
+
+#include <cstring>
+
+namespace vt {
+
+namespace {
+
+static_assert(
+  eEnvType::EnvPackedPut < 7,
+  "The compact marker bit must not overlap the envelope type bits"
+);
+
+inline char* writeVarint(char* out, uint64_t value) {
+  while (value >= 0x80) {
+    *out++ = static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<char>(value);
+  return out;
+}
+
+inline char const* readVarint(char const* in, char const* end, uint64_t& value) {
+  value = 0;
+  int shift = 0;
+  while (in < end) {
+    auto const byte = static_cast<uint8_t>(*in++);
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return in;
+    }
+    shift += 7;
+  }
+  vtAssert(false, "Compact envelope truncated");
+  return in;
+}
+
+template <typename T>
+inline char* writeRaw(char* out, T const& value) {
+  std::memcpy(out, &value, sizeof(T));
+  return out + sizeof(T);
+}
+
+template <typename T>
+inline char const* readRaw(char const* in, T& value) {
+  std::memcpy(&value, in, sizeof(T));
+  return in + sizeof(T);
+}
+
+inline bool hasFlag(uint64_t flags, eCompactFlag flag) {
+  return (flags & (1 << flag)) != 0;
+}
+
+} /* end anon namespace */
+
+std::size_t envelopeFullSize(Envelope const& env) {
+  if (envelopeIsPut(env)) {
+    return sizeof(PutShortEnvelope);
+  } else if (envelopeIsEpochType(env) and envelopeIsTagType(env)) {
+    return sizeof(EpochTagEnvelope);
+  } else if (envelopeIsEpochType(env)) {
+    return sizeof(EpochEnvelope);
+  } else if (envelopeIsTagType(env)) {
+    return sizeof(TagEnvelope);
+  } else {
+    return sizeof(Envelope);
+  }
+}
+
+bool envelopeCanCompact(Envelope const& env) {
+  return not envelopeIsPut(env);
+}
+
+std::size_t envelopeCompactEncode(
+  Envelope const& env, NodeType dest, char* out
+) {
+  vtAssert(envelopeCanCompact(env), "Envelope must be compactable");
+
+  auto const has_epoch =
+    envelopeIsEpochType(env) and envelopeGetEpoch(env) != no_epoch;
+  auto const has_tag =
+    envelopeIsTagType(env) and envelopeGetTag(env) != no_tag;
+  auto const env_dest = envelopeGetDest(env);
+  GroupType const group = env.group;
+
+  uint64_t flags = 0;
+  flags |= (env_dest != dest) << CompactHasDest;
+  flags |= has_epoch << CompactHasEpoch;
+  flags |= has_tag << CompactHasTag;
+  flags |= (group != default_group) << CompactHasGroup;
+  flags |= envelopeHasBeenSerialized(env) << CompactSerialized;
+  flags |= envelopeGetDeliverBcast(env) << CompactDeliverBcast;
+  flags |= envelopeCommStatsRecordedAboveBareHandler(env) << CompactCommStats;
+#if vt_check_enabled(trace_enabled)
+  flags |= env.trace_rt_enabled << CompactTraceRtEnabled;
+#endif
+  flags |= static_cast<uint64_t>(env.sched_queue) << CompactSchedQueue;
+
+  char* cur = out;
+  *cur++ = static_cast<char>(
+    static_cast<uint8_t>(env.type) | envelope_compact_marker
+  );
+  cur = writeVarint(cur, flags);
+  cur = writeVarint(cur, static_cast<uint64_t>(envelopeGetHandler(env)));
+
+  if (hasFlag(flags, CompactHasDest)) {
+    cur = writeVarint(cur, static_cast<uint16_t>(env_dest));
+  }
+  if (has_epoch) {
+    cur = writeRaw(cur, *envelopeGetEpoch(env));
+  }
+  if (has_tag) {
+    cur = writeVarint(cur, static_cast<uint32_t>(envelopeGetTag(env)));
+  }
+  if (hasFlag(flags, CompactHasGroup)) {
+    cur = writeVarint(cur, group);
+  }
+
+#if vt_check_enabled(priorities)
+  cur = writeRaw(cur, static_cast<PriorityType>(env.priority));
+  cur = writeRaw(cur, static_cast<PriorityLevelType>(env.priority_level));
+#endif
+
+#if vt_check_enabled(trace_enabled)
+  cur = writeVarint(cur, env.trace_event);
+#endif
+
+  auto const len = static_cast<std::size_t>(cur - out);
+  vtAssert(len <= envelope_compact_max_bytes, "Compact envelope overflow");
+  return len;
+}
+
+std::size_t envelopeCompactDecode(
+  char const* in, std::size_t len, NodeType this_node, char* out_env
+) {
+  vtAssert(len >= 2, "Compact envelope truncated");
+  vtAssert(envelopeIsCompact(in), "Buffer must hold a compact envelope");
+
+  char const* cur = in;
+  char const* end = in + len;
+  auto const type = static_cast<uint8_t>(*cur++) & ~envelope_compact_marker;
+  uint64_t flags = 0;
+  cur = readVarint(cur, end, flags);
+
+  std::memset(out_env, 0, sizeof(EpochTagEnvelope));
+  auto& env = *reinterpret_cast<Envelope*>(out_env);
+  env.type = static_cast<EnvelopeDataType>(type);
+
+  uint64_t value = 0;
+  cur = readVarint(cur, end, value);
+  envelopeSetHandler(env, static_cast<HandlerType>(value));
+
+  NodeType dest = this_node;
+  if (hasFlag(flags, CompactHasDest)) {
+    cur = readVarint(cur, end, value);
+    dest = static_cast<NodeType>(static_cast<uint16_t>(value));
+  }
+  envelopeSetDest(env, dest);
+
+  if (envelopeIsEpochType(env)) {
+    EpochType::ImplType epoch = *no_epoch;
+    if (hasFlag(flags, CompactHasEpoch)) {
+      cur = readRaw(cur, epoch);
+    }
+    envelopeSetEpoch(env, EpochType{epoch});
+  }
+
+  if (envelopeIsTagType(env)) {
+    TagType tag = no_tag;
+    if (hasFlag(flags, CompactHasTag)) {
+      cur = readVarint(cur, end, value);
+      tag = static_cast<TagType>(static_cast<uint32_t>(value));
+    }
+    envelopeSetTag(env, tag);
+  }
+
+  GroupType group = default_group;
+  if (hasFlag(flags, CompactHasGroup)) {
+    cur = readVarint(cur, end, value);
+    group = static_cast<GroupType>(value);
+  }
+  envelopeSetGroup(env, group);
+  envelopeSetRef(env, 0);
+
+#if vt_check_enabled(priorities)
+  PriorityType priority = 0;
+  PriorityLevelType priority_level = 0;
+  cur = readRaw(cur, priority);
+  cur = readRaw(cur, priority_level);
+  envelopeSetPriority(env, priority);
+  envelopeSetPriorityLevel(env, priority_level);
+#endif
+
+#if vt_check_enabled(trace_enabled)
+  cur = readVarint(cur, end, value);
+  envelopeSetTraceEvent(env, static_cast<trace::TraceEventIDType>(value));
+  envelopeSetTraceRuntimeEnabled(env, hasFlag(flags, CompactTraceRtEnabled));
+#endif
+
+  envelopeSetHasBeenSerialized(env, hasFlag(flags, CompactSerialized));
+  envelopeSetCommStatsRecordedAboveBareHandler(
+    env, hasFlag(flags, CompactCommStats)
+  );
+  envelopeSetSchedQueue(
+    env, static_cast<SchedQueue>((flags >> CompactSchedQueue) & 0x3)
+  );
+  env.deliver_bcast_to_sender = hasFlag(flags, CompactDeliverBcast);
+  envelopeSetIsLocked(env, true);
+
+  vtAssert(cur <= end, "Compact envelope truncated");
+  return static_cast<std::size_t>(cur - in);
+}
+
+} /* end namespace vt */
@@ -0,0 +1,153 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              envelope_compact.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_MESSAGING_ENVELOPE_ENVELOPE_COMPACT_H
+#define INCLUDED_VT_MESSAGING_ENVELOPE_ENVELOPE_COMPACT_H
+
+#include "vt/config.h"
+#include "vt/messaging/envelope/envelope_type.h"
+#include "vt/messaging/envelope/envelope_base.h"
+
+#include <cstdlib>
+
+namespace vt {
+
+/** \file */
+
+/*
+ *  Compact wire envelope layout:
+ *    byte 0     -> envelope type bits | envelope_compact_marker
+ *    varint     -> eCompactFlag bits
+ *    varint     -> handler
+ *    varint     -> dest        (iff CompactHasDest)
+ *    8 bytes    -> epoch       (iff CompactHasEpoch)
+ *    varint     -> tag         (iff CompactHasTag)
+ *    varint     -> group       (iff CompactHasGroup)
+ *    3 bytes    -> priority and level (iff priorities are enabled)
+ *    varint     -> trace event (iff tracing is enabled)
+ *
+ *  The payload that follows the full envelope in memory is appended after the
+ *  compact header.
+ */
+
+/// Bit set in the first byte to distinguish a compact header from an envelope
+static constexpr uint8_t const envelope_compact_marker = 0x80;
+
+/// Upper bound on the number of bytes a compact header can occupy
+static constexpr std::size_t const envelope_compact_max_bytes = 64;
+
+/// Flag bits following the first byte of a compact header; the common flags
+/// fit in a single varint byte
+enum eCompactFlag {
+  CompactHasDest          = 0, /**< Dest differs from the receiving node */
+  CompactHasEpoch         = 1, /**< Epoch is present and not \c no_epoch */
+  CompactHasTag           = 2, /**< Tag is present and not \c no_tag */
+  CompactHasGroup         = 3, /**< Group is not \c default_group */
+  CompactSerialized       = 4, /**< Mirrors \c has_been_serialized */
+  CompactDeliverBcast     = 5, /**< Mirrors \c deliver_bcast_to_sender */
+  CompactCommStats        = 6, /**< Mirrors comm stats recorded above bare */
+  CompactTraceRtEnabled   = 7, /**< Mirrors \c trace_rt_enabled */
+  CompactSchedQueue       = 8  /**< Two bits holding \c sched_queue */
+};
+
+/**
+ * \brief Get the size of the full in-memory envelope indicated by the type
+ * bits
+ *
+ * \param[in] env the envelope
+ *
+ * \return the number of bytes of the envelope struct
+ */
+std::size_t envelopeFullSize(Envelope const& env);
+
+/**
+ * \brief Test whether an envelope can be sent with a compact header
+ *
+ * \param[in] env the envelope
+ *
+ * \return whether it can be compacted (put envelopes cannot)
+ */
+bool envelopeCanCompact(Envelope const& env);
+
+/**
+ * \brief Test whether a received buffer starts with a compact header
+ *
+ * \param[in] buf the received bytes
+ *
+ * \return whether the buffer holds a compact header
+ */
+inline bool envelopeIsCompact(char const* buf) {
+  return (static_cast<uint8_t>(buf[0]) & envelope_compact_marker) != 0;
+}
+
+/**
+ * \brief Encode an envelope into a compact header
+ *
+ * \param[in] env the envelope to encode
+ * \param[in] dest the node the header will be sent to
+ * \param[out] out buffer of at least \c envelope_compact_max_bytes
+ *
+ * \return the number of bytes written
+ */
+std::size_t envelopeCompactEncode(
+  Envelope const& env, NodeType dest, char* out
+);
+
+/**
+ * \brief Decode a compact header into a full envelope. The envelope is locked
+ * after decoding as any received envelope is.
+ *
+ * \param[in] in the compact header
+ * \param[in] len the number of bytes available in \c in
+ * \param[in] this_node the receiving node
+ * \param[out] out_env buffer large enough for an \c EpochTagEnvelope
+ *
+ * \return the number of header bytes consumed
+ */
+std::size_t envelopeCompactDecode(
+  char const* in, std::size_t len, NodeType this_node, char* out_env
+);
+
+} /* end namespace vt */
+
+#endif /*INCLUDED_VT_MESSAGING_ENVELOPE_ENVELOPE_COMPACT_H*/
@@ -94,6 +94,16 @@ inline bool envelopeGetDeliverBcast(Env const& env);
 template <typename Env>
 inline GroupType envelopeGetGroup(Env& env);
 
+/**
+ * \brief Get the scheduler queue on an envelope
+ *
+ * \param[in] env the envelope
+ *
+ * \return the scheduler queue the message is enqueued on
+ */
+template <typename Env>
+inline SchedQueue envelopeGetSchedQueue(Env const& env);
+
 /**
  * \brief Get the reference count on an envelope
  *
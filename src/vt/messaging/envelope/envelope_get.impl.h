@@ -69,6 +69,13 @@ inline GroupType envelopeGetGroup(Env& env) {
   return reinterpret_cast<Envelope*>(&env)->group;
 }
 
+template <typename Env>
+inline SchedQueue envelopeGetSchedQueue(Env const& env) {
+  return static_cast<SchedQueue>(
+    reinterpret_cast<Envelope const*>(&env)->sched_queue
+  );
+}
+
 template <typename Env>
 inline RefType envelopeGetRef(Env& env) {
   return reinterpret_cast<Envelope*>(&env)->ref;
@@ -197,6 +197,15 @@ template <typename Env>
 inline void envelopeSetTraceRuntimeEnabled(Env& env, bool is_trace_enabled);
 #endif
 
+/**
+ * \brief Set the scheduler queue the message is enqueued on when it arrives
+ *
+ * \param[in,out] env the envelope
+ * \param[in] queue the scheduler queue
+ */
+template <typename Env>
+inline void envelopeSetSchedQueue(Env& env, SchedQueue queue);
+
 /**
  * \brief Set whether this message's base serializer has been called.
  *
@@ -151,6 +151,13 @@ inline void envelopeSetHasBeenSerialized(Env& env, bool has_been_serialized) {
   reinterpret_cast<Envelope*>(&env)->has_been_serialized = has_been_serialized;
 }
 
+template <typename Env>
+inline void envelopeSetSchedQueue(Env& env, SchedQueue queue) {
+  vtAssert(not envelopeIsLocked(env), "Envelope locked.");
+  reinterpret_cast<Envelope*>(&env)->sched_queue =
+    static_cast<uint8_t>(queue);
+}
+
 template <typename Env>
 inline void envelopeSetCommStatsRecordedAboveBareHandler(
   Env& env, bool comm_stats_recorded_above_bare_handler
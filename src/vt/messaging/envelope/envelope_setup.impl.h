@@ -76,6 +76,7 @@ inline void envelopeInit(Env& env) {
 #endif
   envelopeSetHasBeenSerialized(env, false);
   envelopeSetCommStatsRecordedAboveBareHandler(env, false);
+  envelopeSetSchedQueue(env, SchedQueue::User);
 }
 
 inline void envelopeInitEmpty(Envelope& env) {
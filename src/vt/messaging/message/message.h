@@ -89,12 +89,11 @@ struct ActiveMsg : BaseMsg {
   /**
    * \brief Construct an empty message; initializes the envelope state.
    */
-  ActiveMsg() {
+  ActiveMsg() : env(emptyEnvelope()) {
     // This is here for legacy reasons (which current allow detection of when
     // a message has not been created correctly). With just this base
     // setup, a vtAssert will fail when the message is attempted to be sent.
     // Proper initialization happens in 'makeMessage' calls.
-    envelopeInitEmpty(env);
 
     vt_debug_print(
       verbose, pool,
@@ -234,6 +233,22 @@ struct ActiveMsg : BaseMsg {
     s | env;
   }
 
+private:
+  /**
+   * \internal \brief An envelope set up once with \c envelopeInitEmpty that
+   * new messages copy instead of initializing each field
+   *
+   * \return the empty envelope
+   */
+  static EnvelopeType const& emptyEnvelope() {
+    static EnvelopeType const empty_env = []{
+      EnvelopeType e;
+      envelopeInitEmpty(e);
+      return e;
+    }();
+    return empty_env;
+  }
+
 public:
   // Message supports serialization for derived types.
   // However, only types that REQUIRE serialization will actually
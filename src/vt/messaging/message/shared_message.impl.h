@@ -53,6 +53,22 @@ namespace vt {
 
 namespace detail {
 
+/**
+ * \internal \brief Allocate storage for a message. The memory pool bucket is
+ * resolved from the message type's size at compile time.
+ *
+ * \return storage for a \c MsgT, to be released by its \c operator delete
+ */
+template <typename MsgT>
+void* allocMessage() {
+  #if vt_check_enabled(memory_pool) && \
+     !vt_check_enabled(no_pool_alloc_env)
+    return thePool()->allocSized<sizeof(MsgT)>();
+  #else
+    return MsgT::operator new(sizeof(MsgT));
+  #endif
+}
+
 /**
  * \internal \brief Create a bare message. Only the system should ever call this
  * function.
@@ -63,7 +79,7 @@ namespace detail {
  */
 template <typename MsgT, typename... Args>
 MsgT* makeMessageImpl(Args&&... args) {
-  MsgT* msg = new MsgT{std::forward<Args>(args)...};
+  MsgT* msg = new (allocMessage<MsgT>()) MsgT{std::forward<Args>(args)...};
   // n.b. do NOT actually take a ref here.
   // True ownership only starts in MsgPtr.
   envelopeSetRef(msg->env, 0);
@@ -92,7 +108,9 @@ MsgT* makeMessageSzImpl(std::size_t size, Args&&... args) {
 
 template <typename MsgT, typename... Args>
 MsgT* makeSharedMessage(Args&&... args) {
-  MsgT* msg = new MsgT{std::forward<Args>(args)...};
+  MsgT* msg = new (detail::allocMessage<MsgT>()) MsgT{
+    std::forward<Args>(args)...
+  };
   // n.b. do NOT actually take a ref here.
   // True ownership only starts in MsgPtr.
   // Double-initialization of an envelope is problematic.
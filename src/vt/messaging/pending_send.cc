@@ -43,6 +43,9 @@
 
 #include "vt/messaging/pending_send.h"
 #include "vt/messaging/active.h"
+#include "vt/worker/fork_join_section.h"
+
+#include <memory>
 
 namespace vt { namespace messaging {
 
@@ -97,6 +100,16 @@ void PendingSend::consumeMsg() {
 void PendingSend::release() {
   bool send_msg = msg_ != nullptr || send_action_ != nullptr;
   vtAssert(!send_msg || !epoch_action_, "cannot have both a message and epoch action");
+
+  auto section = worker::ForkJoinSection::current();
+  if (section != nullptr and (send_msg or epoch_action_)) {
+    // Inside a fork-join section: hand the operation to the comm thread, which
+    // runs it when the section merges
+    auto deferred = std::make_shared<PendingSend>(std::move(*this));
+    section->defer([deferred]{ deferred->release(); });
+    return;
+  }
+
   if (send_msg) {
     sendMsg();
   } else if ( epoch_action_ ) {
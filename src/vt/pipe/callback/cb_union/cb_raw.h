@@ -52,6 +52,7 @@
 #include "vt/pipe/callback/objgroup_bcast/callback_objgroup_bcast.h"
 #include "vt/pipe/callback/objgroup_send/callback_objgroup_send.h"
 #include "vt/pipe/callback/anon/callback_anon_tl.h"
+#include "vt/pipe/callback/local/callback_local_tl.h"
 
 #include <cstdlib>
 #include <cstdint>
@@ -61,6 +62,13 @@ namespace vt { namespace pipe { namespace callback { namespace cbunion {
 
 struct AnonCB : CallbackAnonTypeless { };
 
+struct LocalCB : CallbackLocalTypeless {
+  LocalCB() = default;
+  explicit LocalCB(CallbackLocalTypeless const& in)
+    : CallbackLocalTypeless(in)
+  { }
+};
+
 struct SendMsgCB : CallbackSendTypeless {
   SendMsgCB() = default;
   SendMsgCB(
@@ -129,6 +137,7 @@ union CallbackUnion {
   explicit CallbackUnion(AnonCB const& in)          : anon_cb_(in)          { }
   explicit CallbackUnion(BcastObjGrpCB const& in)   : bcast_obj_cb_(in)     { }
   explicit CallbackUnion(SendObjGrpCB const& in)    : send_obj_cb_(in)      { }
+  explicit CallbackUnion(LocalCB const& in)         : local_cb_(in)         { }
 
   AnonCB        anon_cb_;
   SendMsgCB     send_msg_cb_;
@@ -139,6 +148,7 @@ union CallbackUnion {
   SendColDirCB  send_col_dir_cb_;
   BcastObjGrpCB bcast_obj_cb_;
   SendObjGrpCB  send_obj_cb_;
+  LocalCB       local_cb_;
 };
 
 enum struct CallbackEnum : int8_t {
@@ -151,7 +161,8 @@ enum struct CallbackEnum : int8_t {
   SendColDirCB  = 6,
   AnonCB        = 7,
   BcastObjGrpCB = 8,
-  SendObjGrpCB  = 9
+  SendObjGrpCB  = 9,
+  LocalCB       = 10
 };
 
 struct GeneralCallback {
@@ -187,6 +198,9 @@ struct GeneralCallback {
   explicit GeneralCallback(SendObjGrpCB const& in)
     : u_(in), active_(CallbackEnum::SendObjGrpCB)
   { }
+  explicit GeneralCallback(LocalCB const& in)
+    : u_(in), active_(CallbackEnum::LocalCB)
+  { }
 
   bool operator==(GeneralCallback const& other) const {
     bool const same_active = other.active_ == active_;
@@ -208,6 +222,8 @@ struct GeneralCallback {
         return u_.bcast_obj_cb_ == other.u_.bcast_obj_cb_;
       case CallbackEnum::SendObjGrpCB:
         return u_.send_obj_cb_ == other.u_.send_obj_cb_;
+      case CallbackEnum::LocalCB:
+        return u_.local_cb_ == other.u_.local_cb_;
       case CallbackEnum::NoCB: return true;
       default: return false;
       }
@@ -253,6 +269,9 @@ struct GeneralCallback {
     case CallbackEnum::SendObjGrpCB:
       ser(u_.send_obj_cb_);
       break;
+    case CallbackEnum::LocalCB:
+      ser(u_.local_cb_);
+      break;
     case CallbackEnum::NoCB:
       // Serializing empty callback!
       s.addBytes(sizeof(u_) - sizeof(active_));
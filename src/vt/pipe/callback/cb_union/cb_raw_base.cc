@@ -91,6 +91,11 @@ CallbackRawBaseSingle::CallbackRawBaseSingle(
 ) : pipe_(in_pipe),  cb_(SendObjGrpCB{in_handler,in_proxy,in_node})
 { }
 
+CallbackRawBaseSingle::CallbackRawBaseSingle(
+  RawLocalTagType, CallbackLocalTypeless const& in_local
+) : cb_(LocalCB{in_local})
+{ }
+
 // CallbackRawBaseSingle::CallbackRawBaseSingle(
 //   RawSendColDirTagType, PipeType const& in_pipe,
 //   HandlerType const& in_handler, AutoHandlerType const& in_vrt_handler,
@@ -109,6 +114,9 @@ void CallbackRawBaseSingle::send() {
   case CallbackEnum::AnonCB:
     cb_.u_.anon_cb_.triggerVoid(pipe_);
     break;
+  case CallbackEnum::LocalCB:
+    cb_.u_.local_cb_.triggerVoid(pipe_);
+    break;
   case CallbackEnum::SendColMsgCB:
     vtAssert(0, "void dispatch not allowed for send collection msg callback");
     break;
@@ -65,6 +65,7 @@ static struct RawSendColDirTagType  { } RawSendColDirTag  { };
 static struct RawBcastColDirTagType { } RawBcastColDirTag { };
 static struct RawSendObjGrpTagType  { } RawSendObjGrpTag  { };
 static struct RawBcastObjGrpTagType { } RawBcastObjGrpTag { };
+static struct RawLocalTagType       { } RawLocalTag       { };
 #pragma GCC diagnostic pop
 
 template <typename MsgT>
@@ -111,6 +112,7 @@ struct CallbackRawBaseSingle {
     RawSendObjGrpTagType, PipeType in_pipe, HandlerType in_handler,
     ObjGroupProxyType in_proxy, NodeType in_node
   );
+  CallbackRawBaseSingle(RawLocalTagType, CallbackLocalTypeless const& in_local);
 
   template <typename MsgT>
   bool operator==(CallbackTyped<MsgT> const& other)   const;
@@ -212,6 +214,9 @@ struct CallbackTyped : CallbackRawBaseSingle {
         RawSendObjGrpTag,in_pipe,in_handler,in_proxy,in_node
       )
   { }
+  CallbackTyped(RawLocalTagType, CallbackLocalTypeless const& in_local)
+    : CallbackRawBaseSingle(RawLocalTag,in_local)
+  { }
 
   bool operator==(CallbackTyped<MsgT> const& other)   const {
     return equal(other);
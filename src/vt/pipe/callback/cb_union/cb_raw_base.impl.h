@@ -99,6 +99,9 @@ void CallbackRawBaseSingle::send(MsgT* msg) {
   case CallbackEnum::BcastObjGrpCB:
     cb_.u_.bcast_obj_cb_.trigger<MsgT>(msg,pipe_);
     break;
+  case CallbackEnum::LocalCB:
+    cb_.u_.local_cb_.trigger<MsgT>(msg,pipe_);
+    break;
   default:
     vtAssert(0, "Should not be reachable");
   }
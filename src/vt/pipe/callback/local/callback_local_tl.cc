@@ -0,0 +1,87 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             callback_local_tl.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/pipe/callback/local/callback_local_tl.h"
+#include "vt/context/context.h"
+
+namespace vt { namespace pipe { namespace callback {
+
+CallbackLocalTypeless::CallbackLocalTypeless(
+  DispatchFnType in_dispatch, ErasedFnType in_fn, void* in_ctx
+) : dispatch_(in_dispatch), fn_(in_fn), ctx_(in_ctx),
+    node_(theContext()->getNode())
+{ }
+
+/*static*/ CallbackLocalTypeless CallbackLocalTypeless::makeFnVoid(
+  void (*fn)()
+) {
+  return CallbackLocalTypeless{dispatchVoidFn, fn, nullptr};
+}
+
+void CallbackLocalTypeless::triggerVoid(PipeType const&) {
+  dispatch(nullptr);
+}
+
+void CallbackLocalTypeless::dispatch(void* msg) const {
+  vt_debug_print(
+    terse, pipe,
+    "CallbackLocalTypeless: trigger: node={}, this_node={}\n",
+    node_, theContext()->getNode()
+  );
+
+  vtAssert(
+    node_ == theContext()->getNode(),
+    "A local callback must be triggered on the node that created it; use "
+    "makeFunc for callbacks that may be triggered remotely"
+  );
+  dispatch_(*this, msg);
+}
+
+/*static*/ void CallbackLocalTypeless::dispatchVoidFn(
+  CallbackLocalTypeless const& cb, void*
+) {
+  cb.fn_();
+}
+
+}}} /* end namespace vt::pipe::callback */
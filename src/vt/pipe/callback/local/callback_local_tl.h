@@ -0,0 +1,140 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             callback_local_tl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_PIPE_CALLBACK_LOCAL_CALLBACK_LOCAL_TL_H
+#define INCLUDED_VT_PIPE_CALLBACK_LOCAL_CALLBACK_LOCAL_TL_H
+
+#include "vt/config.h"
+#include "vt/pipe/pipe_common.h"
+
+#include <type_traits>
+
+namespace vt { namespace pipe { namespace callback {
+
+/**
+ * \struct CallbackLocalTypeless
+ *
+ * \brief A callback to a function or member function on the node that created
+ * it, stored inline without any pipe registration.
+ *
+ * The target is kept as a type-erased function pointer, an optional context
+ * pointer and a dispatch function pointer instantiated for the exact target
+ * type, so triggering is a direct call with no lookup or allocation. Because
+ * the pointers are only meaningful in the creating process, the callback must
+ * be triggered on the node that created it.
+ */
+struct CallbackLocalTypeless {
+  using isByteCopyable = std::true_type;
+  using ErasedFnType   = void(*)();
+  using DispatchFnType = void(*)(CallbackLocalTypeless const&, void*);
+
+  CallbackLocalTypeless() = default;
+
+  template <typename MsgT>
+  static CallbackLocalTypeless makeFn(void (*fn)(MsgT*));
+
+  template <typename MsgT, typename ContextT>
+  static CallbackLocalTypeless makeFn(
+    ContextT* ctx, void (*fn)(MsgT*, ContextT*)
+  );
+
+  static CallbackLocalTypeless makeFnVoid(void (*fn)());
+
+  template <typename ContextT>
+  static CallbackLocalTypeless makeFnVoid(ContextT* ctx, void (*fn)(ContextT*));
+
+  template <typename ObjT, typename MsgT, void (ObjT::*f)(MsgT*)>
+  static CallbackLocalTypeless makeMember(ObjT* obj);
+
+  template <typename ObjT, void (ObjT::*f)()>
+  static CallbackLocalTypeless makeMemberVoid(ObjT* obj);
+
+  bool operator==(CallbackLocalTypeless const& other) const {
+    return
+      other.dispatch_ == dispatch_ and other.fn_ == fn_ and
+      other.ctx_ == ctx_ and other.node_ == node_;
+  }
+
+  NodeType getNode() const { return node_; }
+
+public:
+  template <typename MsgT>
+  void trigger(MsgT* msg, PipeType const& pipe);
+  void triggerVoid(PipeType const& pipe);
+
+private:
+  CallbackLocalTypeless(
+    DispatchFnType in_dispatch, ErasedFnType in_fn, void* in_ctx
+  );
+
+  void dispatch(void* msg) const;
+
+  template <typename MsgT>
+  static void dispatchFn(CallbackLocalTypeless const& cb, void* msg);
+
+  template <typename MsgT, typename ContextT>
+  static void dispatchCtxFn(CallbackLocalTypeless const& cb, void* msg);
+
+  static void dispatchVoidFn(CallbackLocalTypeless const& cb, void* msg);
+
+  template <typename ContextT>
+  static void dispatchVoidCtxFn(CallbackLocalTypeless const& cb, void* msg);
+
+  template <typename ObjT, typename MsgT, void (ObjT::*f)(MsgT*)>
+  static void dispatchMember(CallbackLocalTypeless const& cb, void* msg);
+
+  template <typename ObjT, void (ObjT::*f)()>
+  static void dispatchMemberVoid(CallbackLocalTypeless const& cb, void* msg);
+
+private:
+  DispatchFnType dispatch_ = nullptr;
+  ErasedFnType fn_ = nullptr;
+  void* ctx_ = nullptr;
+  NodeType node_ = uninitialized_destination;
+};
+
+}}} /* end namespace vt::pipe::callback */
+
+#include "vt/pipe/callback/local/callback_local_tl.impl.h"
+
+#endif /*INCLUDED_VT_PIPE_CALLBACK_LOCAL_CALLBACK_LOCAL_TL_H*/
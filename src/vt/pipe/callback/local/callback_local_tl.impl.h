@@ -0,0 +1,136 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           callback_local_tl.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_PIPE_CALLBACK_LOCAL_CALLBACK_LOCAL_TL_IMPL_H
+#define INCLUDED_VT_PIPE_CALLBACK_LOCAL_CALLBACK_LOCAL_TL_IMPL_H
+
+#include "vt/config.h"
+#include "vt/pipe/callback/local/callback_local_tl.h"
+
+namespace vt { namespace pipe { namespace callback {
+
+template <typename MsgT>
+/*static*/ CallbackLocalTypeless CallbackLocalTypeless::makeFn(
+  void (*fn)(MsgT*)
+) {
+  return CallbackLocalTypeless{
+    dispatchFn<MsgT>, reinterpret_cast<ErasedFnType>(fn), nullptr
+  };
+}
+
+template <typename MsgT, typename ContextT>
+/*static*/ CallbackLocalTypeless CallbackLocalTypeless::makeFn(
+  ContextT* ctx, void (*fn)(MsgT*, ContextT*)
+) {
+  return CallbackLocalTypeless{
+    dispatchCtxFn<MsgT,ContextT>, reinterpret_cast<ErasedFnType>(fn), ctx
+  };
+}
+
+template <typename ContextT>
+/*static*/ CallbackLocalTypeless CallbackLocalTypeless::makeFnVoid(
+  ContextT* ctx, void (*fn)(ContextT*)
+) {
+  return CallbackLocalTypeless{
+    dispatchVoidCtxFn<ContextT>, reinterpret_cast<ErasedFnType>(fn), ctx
+  };
+}
+
+template <typename ObjT, typename MsgT, void (ObjT::*f)(MsgT*)>
+/*static*/ CallbackLocalTypeless CallbackLocalTypeless::makeMember(ObjT* obj) {
+  return CallbackLocalTypeless{dispatchMember<ObjT,MsgT,f>, nullptr, obj};
+}
+
+template <typename ObjT, void (ObjT::*f)()>
+/*static*/ CallbackLocalTypeless CallbackLocalTypeless::makeMemberVoid(
+  ObjT* obj
+) {
+  return CallbackLocalTypeless{dispatchMemberVoid<ObjT,f>, nullptr, obj};
+}
+
+template <typename MsgT>
+void CallbackLocalTypeless::trigger(MsgT* msg, PipeType const&) {
+  dispatch(msg);
+}
+
+template <typename MsgT>
+/*static*/ void CallbackLocalTypeless::dispatchFn(
+  CallbackLocalTypeless const& cb, void* msg
+) {
+  auto fn = reinterpret_cast<void(*)(MsgT*)>(cb.fn_);
+  fn(static_cast<MsgT*>(msg));
+}
+
+template <typename MsgT, typename ContextT>
+/*static*/ void CallbackLocalTypeless::dispatchCtxFn(
+  CallbackLocalTypeless const& cb, void* msg
+) {
+  auto fn = reinterpret_cast<void(*)(MsgT*, ContextT*)>(cb.fn_);
+  fn(static_cast<MsgT*>(msg), static_cast<ContextT*>(cb.ctx_));
+}
+
+template <typename ContextT>
+/*static*/ void CallbackLocalTypeless::dispatchVoidCtxFn(
+  CallbackLocalTypeless const& cb, void*
+) {
+  auto fn = reinterpret_cast<void(*)(ContextT*)>(cb.fn_);
+  fn(static_cast<ContextT*>(cb.ctx_));
+}
+
+template <typename ObjT, typename MsgT, void (ObjT::*f)(MsgT*)>
+/*static*/ void CallbackLocalTypeless::dispatchMember(
+  CallbackLocalTypeless const& cb, void* msg
+) {
+  (static_cast<ObjT*>(cb.ctx_)->*f)(static_cast<MsgT*>(msg));
+}
+
+template <typename ObjT, void (ObjT::*f)()>
+/*static*/ void CallbackLocalTypeless::dispatchMemberVoid(
+  CallbackLocalTypeless const& cb, void*
+) {
+  (static_cast<ObjT*>(cb.ctx_)->*f)();
+}
+
+}}} /* end namespace vt::pipe::callback */
+
+#endif /*INCLUDED_VT_PIPE_CALLBACK_LOCAL_CALLBACK_LOCAL_TL_IMPL_H*/
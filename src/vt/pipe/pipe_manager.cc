@@ -62,6 +62,13 @@ Callback<PipeManager::Void> PipeManager::makeFunc(
   return makeCallbackSingleAnonVoid<Callback<Void>>(life,fn);
 }
 
+Callback<PipeManager::Void> PipeManager::makeFuncLocal(void (*fn)()) {
+  return Callback<Void>{
+    callback::cbunion::RawLocalTag,
+    callback::CallbackLocalTypeless::makeFnVoid(fn)
+  };
+}
+
 // Functions pulled out of PipeManager for header deps, forward to manager
 void triggerPipe(PipeType const& pipe) {
   return theCB()->triggerPipe(pipe);
@@ -220,6 +220,117 @@ struct PipeManager
    */
   Callback<Void> makeFunc(LifetimeEnum life, FuncVoidType fn);
 
+  /**
+   * \brief Make a lightweight callback to a function on this node with a
+   * message.
+   *
+   * Unlike \c makeFunc, no pipe state is registered: the function pointer is
+   * stored inline in the callback and invoked directly when it is triggered.
+   * Lambdas without captures convert implicitly when \c MsgT is given.
+   *
+   * \warning The callback must be triggered on this node; use \c makeFunc for
+   * a callback that may be triggered remotely. A reduction to node 0 over the
+   * default spanning tree qualifies: the root's own contribution supplies the
+   * callback that fires.
+   *
+   * Example snippet:
+   *
+   * \code{.cpp}
+   *  struct DataMsg : vt::Message { };
+   *  int main() {
+   *    auto cb = vt::theCB()->makeFuncLocal<DataMsg>([](DataMsg* msg){
+   *      // callback triggered with message
+   *    });
+   *    cb.send();
+   *  }
+   * \endcode
+   *
+   * \param[in] fn endpoint function that takes a message
+   *
+   * \return the new callback
+   */
+  template <typename MsgT>
+  Callback<MsgT> makeFuncLocal(void (*fn)(MsgT*));
+
+  /**
+   * \brief Make a lightweight callback to a function on this node with a
+   * message and a context pointer.
+   *
+   * \warning The callback must be triggered on this node, and the context must
+   * outlive the last time it might be triggered.
+   *
+   * \param[in] ctx pointer to the object context passed to callback function
+   * \param[in] fn endpoint function that takes a message and context pointer
+   *
+   * \return the new callback
+   */
+  template <typename MsgT, typename ContextT>
+  Callback<MsgT> makeFuncLocal(ContextT* ctx, void (*fn)(MsgT*, ContextT*));
+
+  /**
+   * \brief Make a lightweight void callback to a function on this node.
+   *
+   * \warning The callback must be triggered on this node.
+   *
+   * \param[in] fn void endpoint function
+   *
+   * \return the new callback
+   */
+  Callback<Void> makeFuncLocal(void (*fn)());
+
+  /**
+   * \brief Make a lightweight void callback to a function on this node with a
+   * context pointer.
+   *
+   * \warning The callback must be triggered on this node, and the context must
+   * outlive the last time it might be triggered.
+   *
+   * \param[in] ctx pointer to the object context passed to callback function
+   * \param[in] fn endpoint function that takes a context pointer
+   *
+   * \return the new callback
+   */
+  template <typename ContextT>
+  Callback<Void> makeFuncLocal(ContextT* ctx, void (*fn)(ContextT*));
+
+  /**
+   * \brief Make a lightweight callback to a member function of an object on
+   * this node with a message.
+   *
+   * Example snippet:
+   *
+   * \code{.cpp}
+   *  struct DataMsg : vt::Message { };
+   *  struct Solver { void done(DataMsg* msg); };
+   *  auto cb = vt::theCB()->makeMemberLocal<Solver,DataMsg,&Solver::done>(
+   *    &solver
+   *  );
+   * \endcode
+   *
+   * \warning The callback must be triggered on this node, and the object must
+   * outlive the last time it might be triggered.
+   *
+   * \param[in] obj the object to invoke the member function on
+   *
+   * \return the new callback
+   */
+  template <typename ObjT, typename MsgT, void (ObjT::*f)(MsgT*)>
+  Callback<MsgT> makeMemberLocal(ObjT* obj);
+
+  /**
+   * \brief Make a lightweight void callback to a member function of an object
+   * on this node.
+   *
+   * \warning The callback must be triggered on this node, and the object must
+   * outlive the last time it might be triggered.
+   *
+   * \param[in] obj the object to invoke the member function on
+   *
+   * \return the new callback
+   */
+  template <typename ObjT, void (ObjT::*f)()>
+  Callback<Void> makeMemberLocal(ObjT* obj);
+
   /**
    * \brief Make a callback to a active message handler to be invoked on a
    * certain node with a message.
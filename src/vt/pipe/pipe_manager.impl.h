@@ -98,6 +98,48 @@ Callback<MsgT> PipeManager::makeFunc(LifetimeEnum life, FuncMsgType<MsgT> fn) {
   return makeCallbackSingleAnon<MsgT,Callback<MsgT>>(life,fn);
 }
 
+template <typename MsgT>
+Callback<MsgT> PipeManager::makeFuncLocal(void (*fn)(MsgT*)) {
+  return Callback<MsgT>{
+    callback::cbunion::RawLocalTag,
+    callback::CallbackLocalTypeless::makeFn<MsgT>(fn)
+  };
+}
+
+template <typename MsgT, typename C>
+Callback<MsgT> PipeManager::makeFuncLocal(C* ctx, void (*fn)(MsgT*, C*)) {
+  return Callback<MsgT>{
+    callback::cbunion::RawLocalTag,
+    callback::CallbackLocalTypeless::makeFn<MsgT,C>(ctx,fn)
+  };
+}
+
+template <typename C>
+Callback<PipeManager::Void> PipeManager::makeFuncLocal(
+  C* ctx, void (*fn)(C*)
+) {
+  return Callback<Void>{
+    callback::cbunion::RawLocalTag,
+    callback::CallbackLocalTypeless::makeFnVoid<C>(ctx,fn)
+  };
+}
+
+template <typename ObjT, typename MsgT, void (ObjT::*f)(MsgT*)>
+Callback<MsgT> PipeManager::makeMemberLocal(ObjT* obj) {
+  return Callback<MsgT>{
+    callback::cbunion::RawLocalTag,
+    callback::CallbackLocalTypeless::makeMember<ObjT,MsgT,f>(obj)
+  };
+}
+
+template <typename ObjT, void (ObjT::*f)()>
+Callback<PipeManager::Void> PipeManager::makeMemberLocal(ObjT* obj) {
+  return Callback<Void>{
+    callback::cbunion::RawLocalTag,
+    callback::CallbackLocalTypeless::makeMemberVoid<ObjT,f>(obj)
+  };
+}
+
 template <typename MsgT, ActiveTypedFnType<MsgT>* f>
 Callback<MsgT> PipeManager::makeSend(NodeType const& node) {
   return makeCallbackSingleSend<MsgT,f>(node);
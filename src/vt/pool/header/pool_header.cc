@@ -55,6 +55,7 @@ namespace vt { namespace pool {
   view.layout->prealloc.alloc_size = num_bytes;
   view.layout->prealloc.oversize = oversize;
   view.layout->prealloc.alloc_worker = theContext()->getWorker();
+  view.layout->prealloc.pool_type = 0;
   auto buf_start = buffer + sizeof(Header);
   return buf_start;
 }
@@ -77,6 +78,20 @@ namespace vt { namespace pool {
   return view.layout->prealloc.alloc_worker;
 }
 
+/*static*/ void HeaderManager::setHeaderPoolType(
+  char* buffer, int8_t pool_type
+) {
+  AllocView view;
+  view.buffer = buffer - sizeof(Header);
+  view.layout->prealloc.pool_type = pool_type;
+}
+
+/*static*/ int8_t HeaderManager::getHeaderPoolType(char* buffer) {
+  AllocView view;
+  view.buffer = buffer - sizeof(Header);
+  return view.layout->prealloc.pool_type;
+}
+
 /*static*/ char* HeaderManager::getHeaderPtr(char* buffer) {
   return buffer - sizeof(Header);
 }
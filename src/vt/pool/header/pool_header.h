@@ -50,6 +50,7 @@ namespace vt { namespace pool {
 
 struct Header {
   WorkerIDType alloc_worker;
+  int8_t pool_type;
   size_t alloc_size;
   size_t oversize;
 };
@@ -70,6 +71,8 @@ struct HeaderManager {
   static size_t getHeaderBytes(char* buffer);
   static size_t getHeaderOversizeBytes(char* buffer);
   static WorkerIDType getHeaderWorker(char* buffer);
+  static void setHeaderPoolType(char* buffer, int8_t pool_type);
+  static int8_t getHeaderPoolType(char* buffer);
   static char* getHeaderPtr(char* buffer);
 };
 
@@ -67,14 +67,7 @@ Pool::Pool()
 Pool::ePoolSize Pool::getPoolType(
   size_t const& num_bytes, size_t const& oversize
 ) {
-  auto const& total_bytes = num_bytes + oversize;
-  if (total_bytes <= static_cast<size_t>(small_msg->getNumBytes())) {
-    return ePoolSize::Small;
-  } else if (total_bytes <= static_cast<size_t>(medium_msg->getNumBytes())) {
-    return ePoolSize::Medium;
-  } else {
-    return ePoolSize::Malloc;
-  }
+  return getSizeClass(num_bytes + oversize);
 }
 
 void* Pool::tryPooledAlloc(size_t const& num_bytes, size_t const& oversize) {
@@ -89,9 +82,9 @@ void* Pool::tryPooledAlloc(size_t const& num_bytes, size_t const& oversize) {
 
 bool Pool::tryPooledDealloc(void* const buf) {
   auto buf_char = static_cast<char*>(buf);
-  auto const& actual_alloc_size = HeaderManagerType::getHeaderBytes(buf_char);
-  auto const& oversize = HeaderManagerType::getHeaderOversizeBytes(buf_char);
-  ePoolSize const pool_type = getPoolType(actual_alloc_size, oversize);
+  auto const pool_type = static_cast<ePoolSize>(
+    HeaderManagerType::getHeaderPoolType(buf_char)
+  );
 
   if (pool_type != ePoolSize::Malloc) {
     poolDealloc(buf, pool_type);
@@ -133,6 +126,10 @@ void* Pool::pooledAlloc(
     ret = nullptr;
   }
 
+  HeaderManagerType::setHeaderPoolType(
+    static_cast<char*>(ret), static_cast<int8_t>(pool_type)
+  );
+
   return ret;
 }
 
@@ -154,9 +151,13 @@ void Pool::poolDealloc(void* const buf, ePoolSize const pool_type) {
 
 void* Pool::defaultAlloc(size_t const& num_bytes, size_t const& oversize) {
   auto alloc_buf = std::malloc(num_bytes + oversize + sizeof(HeaderType));
-  return HeaderManagerType::setHeader(
+  auto ret = HeaderManagerType::setHeader(
     num_bytes, oversize, static_cast<char*>(alloc_buf)
   );
+  HeaderManagerType::setHeaderPoolType(
+    ret, static_cast<int8_t>(ePoolSize::Malloc)
+  );
+  return ret;
 }
 
 void Pool::defaultDealloc(void* const ptr) {
@@ -198,10 +199,12 @@ void Pool::dealloc(void* const buf) {
   auto const& actual_alloc_size = HeaderManagerType::getHeaderBytes(buf_char);
   auto const& alloc_worker = HeaderManagerType::getHeaderWorker(buf_char);
   auto const& ptr_actual = HeaderManagerType::getHeaderPtr(buf_char);
-  auto const& oversize = HeaderManagerType::getHeaderOversizeBytes(buf_char);
   auto const worker = theContext()->getWorker();
 
-  ePoolSize const pool_type = getPoolType(actual_alloc_size, oversize);
+  // The bucket was recorded at allocation, so no size lookup is needed here
+  auto const pool_type = static_cast<ePoolSize>(
+    HeaderManagerType::getHeaderPoolType(buf_char)
+  );
 
   vt_debug_print(
     normal, pool,
@@ -237,8 +240,9 @@ Pool::SizeType Pool::remainingSize(void* const buf) {
     auto buf_char = static_cast<char*>(buf);
     auto const& actual_alloc_size = HeaderManagerType::getHeaderBytes(buf_char);
     auto const& oversize = HeaderManagerType::getHeaderOversizeBytes(buf_char);
-
-    ePoolSize const pool_type = getPoolType(actual_alloc_size, oversize);
+    auto const pool_type = static_cast<ePoolSize>(
+      HeaderManagerType::getHeaderPoolType(buf_char)
+    );
 
     if (pool_type == ePoolSize::Small) {
       return small_msg->getNumBytes() - actual_alloc_size;
@@ -101,6 +101,18 @@ struct Pool : runtime::component::Component<Pool> {
    */
   void* alloc(size_t const& num_bytes, size_t oversize = 0);
 
+  /**
+   * \brief Allocate a number of bytes known at compile time, such as the size
+   * of a message type
+   *
+   * The bucket is resolved at compile time, so the size comparisons in
+   * \c getPoolType are skipped.
+   *
+   * \return pointer to new allocation
+   */
+  template <std::size_t num_bytes>
+  void* allocSized();
+
   /**
    * \brief De-allocate a pool-allocated buffer
    *
@@ -118,6 +130,20 @@ struct Pool : runtime::component::Component<Pool> {
    */
   ePoolSize getPoolType(size_t const& num_bytes, size_t const& oversize);
 
+  /**
+   * \internal \brief Bucket for a total allocation size, usable at compile time
+   *
+   * \param[in] total_bytes payload plus extra bytes
+   *
+   * \return enum \c ePoolSize of which pool to target
+   */
+  static constexpr ePoolSize getSizeClass(size_t total_bytes) {
+    return
+      total_bytes <= memory_size_small  ? ePoolSize::Small  :
+      total_bytes <= memory_size_medium ? ePoolSize::Medium :
+                                          ePoolSize::Malloc;
+  }
+
   /**
    * \internal \brief Get remaining bytes for a pool allocation
    *
@@ -251,4 +277,6 @@ extern pool::Pool* thePool();
 
 } //end namespace vt
 
+#include "vt/pool/pool.impl.h"
+
 #endif /*INCLUDED_VT_POOL_POOL_H*/
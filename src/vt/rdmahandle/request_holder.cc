@@ -60,6 +60,12 @@ MPI_Request* RequestHolder::add() {
 }
 
 bool RequestHolder::test() {
+  // A delayed operation has not been issued yet, so it can not be complete
+  if (delayed_ != nullptr) {
+    delayed_();
+    delayed_ = nullptr;
+  }
+
   VT_ALLOW_MPI_CALLS;
   std::vector<MPI_Request> new_reqs;
   std::vector<MPI_Status> stats;
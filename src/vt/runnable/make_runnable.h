@@ -272,6 +272,18 @@ struct RunnableMaker {
    */
   void enqueue();
 
+  /**
+   * \brief Finish building the runnable and release ownership to the caller
+   * instead of running or enqueuing it
+   *
+   * \return the runnable, ready to run
+   */
+  std::unique_ptr<RunnableNew> release() {
+    setup();
+    is_done_ = true;
+    return std::move(impl_);
+  }
+
   /**
    * \brief Set an explicit task for this runnable (not going through normal
    * handler)
@@ -45,6 +45,9 @@
 #define INCLUDED_VT_RUNTIME_COMPONENT_COMPONENT_PACK_CC
 
 #include "vt/runtime/component/component_pack.h"
+#include "vt/configs/arguments/app_config.h"
+
+#include <algorithm>
 
 namespace vt { namespace runtime { namespace component {
 
@@ -102,10 +105,58 @@ void ComponentPack::destruct() {
   }
 }
 
+ComponentPack::PollState::PollState(BaseComponent* in_component)
+  : component_(in_component),
+    backoff_when_idle_(in_component->backoffWhenIdle()),
+    polls_(in_component->registerCounter(
+      "progress_polls", "scheduler progress polls"
+    )),
+    hits_(in_component->registerCounter(
+      "progress_poll_hits", "scheduler progress polls that made progress"
+    )),
+    skips_(in_component->registerCounter(
+      "progress_poll_skips", "scheduler progress polls skipped while idle"
+    ))
+{ }
+
 int ComponentPack::progress() {
   int total = 0;
-  for (auto&& pollable : pollable_components_) {
-    total += pollable->progress();
+
+  if (not theConfig()->vt_sched_adaptive_poll) {
+    for (auto&& state : pollable_components_) {
+      total += state.component_->progress();
+    }
+    return total;
+  }
+
+  auto const max_backoff = std::max(theConfig()->vt_sched_poll_max_backoff, 0);
+  for (auto&& state : pollable_components_) {
+    if (not state.backoff_when_idle_) {
+      auto const units = state.component_->progress();
+      state.polls_.increment(1);
+      if (units > 0) {
+        state.hits_.increment(1);
+      }
+      total += units;
+      continue;
+    }
+
+    if (state.skip_ > 0 or not state.component_->hasPendingWork()) {
+      state.skip_ = std::max(state.skip_ - 1, 0);
+      state.skips_.increment(1);
+      continue;
+    }
+
+    auto const units = state.component_->progress();
+    state.polls_.increment(1);
+    if (units > 0) {
+      state.hits_.increment(1);
+      state.backoff_ = 0;
+    } else {
+      state.backoff_ = std::min(std::max(state.backoff_ * 2, 1), max_backoff);
+    }
+    state.skip_ = state.backoff_;
+    total += units;
   }
   return total;
 }
@@ -110,6 +110,12 @@ public:
   /**
    * \internal \brief Invoke the progress function on all pollable components
    *
+   * With \c --vt_sched_adaptive_poll, components reporting no pending work are
+   * skipped, and each empty poll doubles the number of calls a component sits
+   * out (up to \c --vt_sched_poll_max_backoff) until a poll makes progress.
+   * Components that opt out with \c backoffWhenIdle, such as the active
+   * messenger's probe for incoming messages, are polled on every call.
+   *
    * \return the number of work units processed
    */
   int progress();
@@ -184,6 +190,23 @@ public:
   bool isLive() const { return live_; }
 
 private:
+  /**
+   * \struct PollState
+   *
+   * \brief Adaptive polling state for a pollable component
+   */
+  struct PollState {
+    explicit PollState(BaseComponent* in_component);
+
+    Progressable* component_ = nullptr; /**< The component to poll */
+    bool backoff_when_idle_ = true;     /**< Whether idle polls back off */
+    int32_t skip_ = 0;                  /**< Progress calls left to skip */
+    int32_t backoff_ = 0;               /**< Calls to skip after a miss */
+    diagnostic::Counter polls_;         /**< Number of polls */
+    diagnostic::Counter hits_;          /**< Polls that made progress */
+    diagnostic::Counter skips_;         /**< Calls skipped (idle or backoff) */
+  };
+
   /// Whether the pack is live
   bool live_ = false;
   /// List of registered components
@@ -196,8 +219,8 @@ private:
   std::unordered_map<registry::AutoHandlerType, Callable> construct_components_;
   /// Set of owning pointers to live components
   std::vector<std::unique_ptr<BaseComponent>> live_components_;
-  /// Set of non-owning pointers to pollable components for progress engine
-  std::vector<Progressable*> pollable_components_;
+  /// Pollable components (non-owning) with their polling state
+  std::vector<PollState> pollable_components_;
   /// Component ID for assigning during construction
   ComponentIDType cur_id_ = 1;
 };
@@ -0,0 +1,371 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            diagnostic_exporter.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/runtime/component/diagnostic_exporter.h"
+#include "vt/runtime/component/diagnostic.h"
+#include "vt/runtime/component/diagnostic_value_base.h"
+#include "vt/context/context.h"
+#include "vt/collective/collective_alg.h"
+#include "vt/collective/reduce/reduce.h"
+#include "vt/collective/reduce/operators/default_msg.h"
+#include "vt/messaging/message.h"
+#include "vt/phase/phase_manager.h"
+#include "vt/pipe/pipe_manager.h"
+#include "vt/timetrigger/time_trigger_manager.h"
+#include "vt/timing/timing.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace vt { namespace runtime { namespace component {
+
+/*friend*/ DiagnosticSeriesStats operator+(
+  DiagnosticSeriesStats a, DiagnosticSeriesStats const& b
+) {
+  vtAssert(a.sum_.size() == b.sum_.size(), "Number of columns must match");
+  for (std::size_t i = 0; i < a.sum_.size(); i++) {
+    a.min_[i] = std::min(a.min_[i], b.min_[i]);
+    a.max_[i] = std::max(a.max_[i], b.max_[i]);
+    a.sum_[i] += b.sum_[i];
+  }
+  return a;
+}
+
+DiagnosticExporter::~DiagnosticExporter() {
+  stop();
+}
+
+void DiagnosticExporter::start(std::vector<Diagnostic*> const& sources) {
+  if (started_) {
+    return;
+  }
+
+  auto const node = theContext()->getNode();
+  auto const& base = theConfig()->vt_diag_export_file;
+
+  binary_ = theConfig()->vt_diag_export_binary;
+  capacity_ = std::max<std::size_t>(theConfig()->vt_diag_export_capacity, 1);
+  reduce_every_ = theConfig()->vt_diag_export_reduce;
+
+  // Columns are resolved once in the same order on every node; diagnostics
+  // registered after this point are not exported
+  for (auto&& c : sources) {
+    c->foreachDiagnostic([&](detail::DiagnosticBase* d) {
+      columns_.push_back(Column{c->name(), d});
+    });
+  }
+
+  auto const ncols = columns_.size();
+  scratch_.resize(ncols);
+  records_.resize(capacity_);
+  values_.resize(capacity_ * ncols);
+
+  auto const file_name = fmt::format(
+    "{}.{}.{}", base, node, binary_ ? "bin" : "csv"
+  );
+  auto const mode = binary_ ?
+    std::ios::out | std::ios::trunc | std::ios::binary :
+    std::ios::out | std::ios::trunc;
+  out_.open(file_name, mode);
+  vtAbortIf(not out_.good(), fmt::format("Failed to open \"{}\"", file_name));
+  writeHeader();
+
+  if (reduce_every_ > 0) {
+    reducer_ = theCollective()->makeReducerCollective();
+    if (node == 0) {
+      reduced_out_.open(fmt::format("{}.reduced.csv", base));
+      reduced_out_ << "phase,num_nodes";
+      for (auto const& col : columns_) {
+        auto const name = col.component_ + "." + col.diag_->getKey();
+        reduced_out_ << "," << name << ".min"
+                     << "," << name << ".max"
+                     << "," << name << ".avg";
+      }
+      reduced_out_ << "\n";
+    }
+  }
+
+  stop_ = false;
+  writer_ = std::thread([this]{ writerLoop(); });
+
+  auto const period = theConfig()->vt_diag_export_period;
+  if (period > 0) {
+    trigger_id_ = theTimeTrigger()->addTrigger(
+      timing::getCurrentTime(), std::chrono::milliseconds{period},
+      [this]{ sample(); }, true
+    );
+  } else {
+    hooks_.push_back(
+      thePhase()->registerHookCollective(
+        phase::PhaseHook::End, [this]{ sample(); }
+      )
+    );
+  }
+
+  if (reduce_every_ > 0) {
+    hooks_.push_back(
+      thePhase()->registerHookCollective(phase::PhaseHook::End, [this]{
+        auto const phase = thePhase()->getCurrentPhase();
+        if (phase % static_cast<PhaseType>(reduce_every_) == 0) {
+          reduceValues();
+        }
+      })
+    );
+  }
+
+  started_ = true;
+}
+
+void DiagnosticExporter::stop() {
+  if (not started_) {
+    return;
+  }
+
+  if (trigger_id_ != -1) {
+    theTimeTrigger()->removeTrigger(trigger_id_);
+    trigger_id_ = -1;
+  }
+  for (auto&& hook : hooks_) {
+    thePhase()->unregisterHook(hook);
+  }
+  hooks_.clear();
+
+  // Capture the state at shutdown so the series always ends at finalize
+  sample();
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+  writer_.join();
+
+  out_.close();
+  if (reduced_out_.is_open()) {
+    reduced_out_.close();
+  }
+
+  if (dropped_ > 0) {
+    vt_print(
+      runtime,
+      "DiagnosticExporter: dropped {} samples; writer fell behind "
+      "(consider a larger --vt_diag_export_capacity)\n",
+      dropped_
+    );
+  }
+
+  started_ = false;
+}
+
+void DiagnosticExporter::readValues(std::vector<double>& out) const {
+  for (std::size_t i = 0; i < columns_.size(); i++) {
+    out[i] = columns_[i].diag_->sampleValue();
+  }
+}
+
+void DiagnosticExporter::sample() {
+  auto const ncols = columns_.size();
+
+  // Read the values before taking the lock so the writer thread is only ever
+  // contended for the copy into the ring
+  readValues(scratch_);
+
+  Record rec;
+  rec.time_ = timing::getCurrentTime();
+  rec.phase_ = thePhase()->getCurrentPhase();
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    records_[head_] = rec;
+    std::copy(
+      scratch_.begin(), scratch_.end(), values_.begin() + head_ * ncols
+    );
+    head_ = (head_ + 1) % capacity_;
+    if (count_ == capacity_) {
+      dropped_++;
+    } else {
+      count_++;
+    }
+  }
+  cv_.notify_one();
+}
+
+void DiagnosticExporter::reduceValues() {
+  readValues(scratch_);
+
+  auto const phase = thePhase()->getCurrentPhase();
+  auto msg = makeMessage<ReduceMsgType>(DiagnosticSeriesStats{phase, scratch_});
+  auto cb = theCB()->makeMemberLocal<
+    DiagnosticExporter, ReduceMsgType, &DiagnosticExporter::reducedValues
+  >(this);
+  reducer_->reduce<collective::PlusOp<DiagnosticSeriesStats>>(
+    0, msg.get(), cb
+  );
+}
+
+void DiagnosticExporter::reducedValues(ReduceMsgType* msg) {
+  ReducedRecord rec;
+  rec.phase_ = msg->getConstVal().phase_;
+  rec.num_nodes_ = theContext()->getNumNodes();
+  rec.stats_ = msg->getConstVal();
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    reduced_.emplace_back(std::move(rec));
+  }
+  cv_.notify_one();
+}
+
+void DiagnosticExporter::writerLoop() {
+  auto const ncols = columns_.size();
+
+  std::vector<Record> records;
+  std::vector<double> values;
+  std::deque<ReducedRecord> reduced;
+
+  while (true) {
+    bool done = false;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]{
+        return stop_ or count_ > 0 or not reduced_.empty();
+      });
+
+      // Unwrap the ring oldest-first into the local buffers
+      records.resize(count_);
+      values.resize(count_ * ncols);
+      auto const tail = (head_ + capacity_ - count_) % capacity_;
+      for (std::size_t i = 0; i < count_; i++) {
+        auto const slot = (tail + i) % capacity_;
+        records[i] = records_[slot];
+        std::copy(
+          values_.begin() + slot * ncols,
+          values_.begin() + (slot + 1) * ncols,
+          values.begin() + i * ncols
+        );
+      }
+      count_ = 0;
+      reduced.swap(reduced_);
+      done = stop_;
+    }
+
+    writeRows(records, values);
+    writeReduced(reduced);
+    reduced.clear();
+
+    if (done) {
+      break;
+    }
+  }
+
+  out_.flush();
+}
+
+void DiagnosticExporter::writeHeader() {
+  if (binary_) {
+    // Layout: "VTDS", u32 version, u32 ncols, ncols x (u32 len, name bytes),
+    // then rows of (f64 time, u64 phase, ncols x f64 value)
+    auto put32 = [this](uint32_t v) {
+      out_.write(reinterpret_cast<char const*>(&v), sizeof(v));
+    };
+    out_.write("VTDS", 4);
+    put32(1);
+    put32(static_cast<uint32_t>(columns_.size()));
+    for (auto const& col : columns_) {
+      auto const name = col.component_ + "." + col.diag_->getKey();
+      put32(static_cast<uint32_t>(name.size()));
+      out_.write(name.data(), name.size());
+    }
+  } else {
+    out_ << "time,phase";
+    for (auto const& col : columns_) {
+      out_ << "," << col.component_ << "." << col.diag_->getKey();
+    }
+    out_ << "\n";
+  }
+  out_.flush();
+}
+
+void DiagnosticExporter::writeRows(
+  std::vector<Record> const& records, std::vector<double> const& values
+) {
+  auto const ncols = columns_.size();
+  for (std::size_t i = 0; i < records.size(); i++) {
+    auto const& rec = records[i];
+    auto const* row = values.data() + i * ncols;
+    if (binary_) {
+      uint64_t const phase = rec.phase_;
+      out_.write(reinterpret_cast<char const*>(&rec.time_), sizeof(rec.time_));
+      out_.write(reinterpret_cast<char const*>(&phase), sizeof(phase));
+      out_.write(reinterpret_cast<char const*>(row), ncols * sizeof(double));
+    } else {
+      out_ << fmt::format("{:.6f},{}", rec.time_, rec.phase_);
+      for (std::size_t j = 0; j < ncols; j++) {
+        out_ << fmt::format(",{}", row[j]);
+      }
+      out_ << "\n";
+    }
+  }
+}
+
+void DiagnosticExporter::writeReduced(
+  std::deque<ReducedRecord> const& reduced
+) {
+  for (auto const& rec : reduced) {
+    auto const& s = rec.stats_;
+    reduced_out_ << fmt::format("{},{}", rec.phase_, rec.num_nodes_);
+    for (std::size_t j = 0; j < s.sum_.size(); j++) {
+      reduced_out_ << fmt::format(
+        ",{},{},{}", s.min_[j], s.max_[j], s.sum_[j] / rec.num_nodes_
+      );
+    }
+    reduced_out_ << "\n";
+  }
+  if (not reduced.empty()) {
+    reduced_out_.flush();
+  }
+}
+
+}}} /* end namespace vt::runtime::component */
@@ -0,0 +1,245 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            diagnostic_exporter.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_RUNTIME_COMPONENT_DIAGNOSTIC_EXPORTER_H
+#define INCLUDED_VT_RUNTIME_COMPONENT_DIAGNOSTIC_EXPORTER_H
+
+#include "vt/config.h"
+#include "vt/phase/phase_hook_id.h"
+#include "vt/timing/timing_type.h"
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vt { namespace collective { namespace reduce {
+
+struct Reduce;
+
+namespace operators {
+
+template <typename T>
+struct ReduceTMsg;
+
+} /* end namespace operators */
+
+}}} /* end namespace vt::collective::reduce */
+
+namespace vt { namespace runtime { namespace component {
+
+struct Diagnostic;
+
+namespace detail {
+
+struct DiagnosticBase;
+
+} /* end namespace detail */
+
+/**
+ * \struct DiagnosticSeriesStats
+ *
+ * \brief Per-column min/max/sum of a sampled row, reduced across all nodes
+ */
+struct DiagnosticSeriesStats {
+  DiagnosticSeriesStats() = default;
+
+  /**
+   * \internal \brief Initialize the stats from a single node's sampled values
+   *
+   * \param[in] phase the phase the values were sampled in, the same on all
+   * nodes
+   * \param[in] vals the sampled values, one per column
+   */
+  DiagnosticSeriesStats(PhaseType phase, std::vector<double> const& vals)
+    : phase_(phase),
+      min_(vals),
+      max_(vals),
+      sum_(vals)
+  { }
+
+  friend DiagnosticSeriesStats operator+(
+    DiagnosticSeriesStats a, DiagnosticSeriesStats const& b
+  );
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | phase_ | min_ | max_ | sum_;
+  }
+
+  PhaseType phase_ = 0;
+  std::vector<double> min_;
+  std::vector<double> max_;
+  std::vector<double> sum_;
+};
+
+/**
+ * \struct DiagnosticExporter
+ *
+ * \brief Periodically samples every registered diagnostic value into a ring
+ * buffer and streams the time series to a per-node file.
+ *
+ * Sampling happens on the communication thread---either from a time trigger
+ * every \c --vt_diag_export_period milliseconds or at the end of each phase
+ * when the period is zero---and only copies the current values into a
+ * preallocated row of the ring buffer. A background thread drains the buffer
+ * and does all formatting and I/O so the scheduler loop is never blocked on
+ * the file system. If the writer falls behind, the oldest unwritten rows are
+ * overwritten and counted as dropped.
+ *
+ * When \c --vt_diag_export_reduce is non-zero, every that-many phases the
+ * current values are also reduced across nodes and node 0 writes the
+ * min/max/avg of each diagnostic to a separate series.
+ */
+struct DiagnosticExporter {
+  /// A diagnostic value being exported along with its owning component
+  struct Column {
+    std::string component_;
+    detail::DiagnosticBase* diag_ = nullptr;
+  };
+
+  /// The fixed part of each sampled row
+  struct Record {
+    TimeType time_ = 0.;
+    PhaseType phase_ = 0;
+  };
+
+  /// A row of cross-node reduced values, only produced on node 0
+  struct ReducedRecord {
+    PhaseType phase_ = 0;
+    NodeType num_nodes_ = 0;
+    DiagnosticSeriesStats stats_;
+  };
+
+  DiagnosticExporter() = default;
+  DiagnosticExporter(DiagnosticExporter const&) = delete;
+  DiagnosticExporter& operator=(DiagnosticExporter const&) = delete;
+
+  ~DiagnosticExporter();
+
+  /**
+   * \internal \brief Collectively start exporting: resolve the set of
+   * diagnostic columns, open the output and launch the writer thread
+   *
+   * \param[in] sources the components whose diagnostics are sampled, in the
+   * same order on every node
+   */
+  void start(std::vector<Diagnostic*> const& sources);
+
+  /**
+   * \internal \brief Take a final sample, stop triggering, flush all pending
+   * rows and join the writer thread
+   */
+  void stop();
+
+  /**
+   * \internal \brief Snapshot every diagnostic value into the ring buffer
+   */
+  void sample();
+
+private:
+  /**
+   * \internal \brief Read the current value of each column into \c out
+   *
+   * \param[out] out the values, one per column
+   */
+  void readValues(std::vector<double>& out) const;
+
+  using ReduceMsgType =
+    collective::reduce::operators::ReduceTMsg<DiagnosticSeriesStats>;
+
+  /**
+   * \internal \brief Contribute the current values to a cross-node reduction
+   */
+  void reduceValues();
+
+  /**
+   * \internal \brief Queue the reduced values on node 0 for the writer thread
+   *
+   * \param[in] msg the reduction result
+   */
+  void reducedValues(ReduceMsgType* msg);
+
+  /**
+   * \internal \brief Background loop that drains the ring buffer to the file
+   */
+  void writerLoop();
+
+  void writeHeader();
+  void writeRows(
+    std::vector<Record> const& records, std::vector<double> const& values
+  );
+  void writeReduced(std::deque<ReducedRecord> const& reduced);
+
+private:
+  bool started_ = false;
+  bool binary_ = false;
+  std::size_t capacity_ = 0;
+  int reduce_every_ = 0;
+  int trigger_id_ = -1;
+  std::vector<phase::PhaseHookID> hooks_;
+  collective::reduce::Reduce* reducer_ = nullptr;
+  std::vector<Column> columns_;
+  std::vector<double> scratch_;           /**< Comm-thread staging row */
+  std::ofstream out_;
+  std::ofstream reduced_out_;
+
+  // State below is shared with the writer thread and guarded by \c mutex_
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Record> records_;           /**< Ring of \c capacity_ records */
+  std::vector<double> values_;            /**< Ring of \c capacity_ rows */
+  std::size_t head_ = 0;                  /**< Next slot to fill */
+  std::size_t count_ = 0;                 /**< Unwritten rows in the ring */
+  std::size_t dropped_ = 0;               /**< Rows overwritten before write */
+  std::deque<ReducedRecord> reduced_;
+  bool stop_ = false;
+  std::thread writer_;
+};
+
+}}} /* end namespace vt::runtime::component */
+
+#endif /*INCLUDED_VT_RUNTIME_COMPONENT_DIAGNOSTIC_EXPORTER_H*/
@@ -54,6 +54,25 @@ namespace vt { namespace runtime { namespace component { namespace detail {
 
 namespace {
 
+template <typename T>
+void reduceDone(
+  collective::ReduceTMsg<DiagnosticValueWrapper<T>>* m,
+  DiagnosticErasedValue* out
+) {
+  auto const update = out->update_;
+  auto const unit = out->unit_;
+  auto& reduced_val = m->getConstVal();
+  *out = DiagnosticEraser<T>::get(reduced_val);
+  out->hist_ = reduced_val.getHistogram();
+  out->update_ = update;
+  out->unit_ = unit;
+  if (update == DiagnosticUpdate::Min) {
+    out->is_valid_value_ = reduced_val.min() != std::numeric_limits<T>::max();
+  } else {
+    out->is_valid_value_ = reduced_val.sum() != 0;
+  }
+}
+
 template <typename T>
 void reduceHelper(
   Diagnostic* diagnostic, DiagnosticErasedValue* out, T val, DiagnosticUnit unit,
@@ -69,20 +88,13 @@ void reduceHelper(
   auto msg = makeMessage<ReduceMsgType>(
     ValueType{typename ValueType::ReduceTag{}, val, updated, N}
   );
-  auto cb = theCB()->makeFunc<ReduceMsgType>(
-    pipe::LifetimeEnum::Once,
-    [=](ReduceMsgType* m) {
-      auto& reduced_val = m->getConstVal();
-      *out = DiagnosticEraser<T>::get(reduced_val);
-      out->hist_ = reduced_val.getHistogram();
-      out->update_ = update;
-      out->unit_ = unit;
-      if (update == DiagnosticUpdate::Min) {
-        out->is_valid_value_ = reduced_val.min() != std::numeric_limits<T>::max();
-      } else {
-        out->is_valid_value_ = reduced_val.sum() != 0;
-      }
-    }
+
+  // The result lands in out on node 0, so stash the metadata there for the
+  // callback instead of capturing it
+  out->update_ = update;
+  out->unit_ = unit;
+  auto cb = theCB()->makeFuncLocal<ReduceMsgType, DiagnosticErasedValue>(
+    out, reduceDone<T>
   );
   r->reduce<collective::PlusOp<ValueType>>(0, msg.get(), cb);
 }
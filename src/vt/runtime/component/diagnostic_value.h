@@ -442,6 +442,15 @@ struct DiagnosticValue : DiagnosticBase {
     Diagnostic* diagnostic, DiagnosticErasedValue* out, int snapshot
   ) override;
 
+  /**
+   * \internal \brief Read the current local value as a double
+   *
+   * \return the current value
+   */
+  double sampleValue() const override {
+    return static_cast<double>(get(0));
+  }
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | values_;
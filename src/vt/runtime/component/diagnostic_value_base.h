@@ -140,6 +140,14 @@ struct DiagnosticBase {
     Diagnostic* diagnostic, DiagnosticErasedValue* out, int snapshot
   ) = 0;
 
+  /**
+   * \internal \brief Read the current local value (over the entire runtime)
+   * converted to a double for time-series sampling
+   *
+   * \return the current value
+   */
+  virtual double sampleValue() const = 0;
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | type_
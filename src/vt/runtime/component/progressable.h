@@ -60,6 +60,24 @@ struct Progressable {
    * \return the number of units executed---zero if no progress was made
    */
   virtual int progress() = 0;
+
+  /**
+   * \brief Whether the component has outstanding work that polling could
+   * advance, such as pending requests or armed triggers. With adaptive polling,
+   * the scheduler skips components that have none.
+   *
+   * \return whether to poll; conservatively true by default
+   */
+  virtual bool hasPendingWork() { return true; }
+
+  /**
+   * \brief Whether adaptive polling may back off this component after empty
+   * polls. Components waiting on input that can arrive at any time, such as
+   * incoming messages, return false so they are polled on every call.
+   *
+   * \return whether to back off; true by default
+   */
+  virtual bool backoffWhenIdle() { return true; }
 };
 
 }}} /* end namespace vt::runtime::component */
@@ -453,6 +453,11 @@ bool Runtime::finalize(bool const force_now, bool const disable_sig) {
     auto const& is_zero = theContext->getNode() == 0;
 
 #   if vt_check_enabled(diagnostics)
+    if (diag_exporter_ != nullptr) {
+      diag_exporter_->stop();
+      diag_exporter_ = nullptr;
+    }
+
     if (getAppConfig()->vt_diag_enable) {
       computeAndPrintDiagnostics();
     }
@@ -648,6 +653,15 @@ void Runtime::setup() {
     pauseForDebugger();
   }
 
+# if vt_check_enabled(diagnostics)
+  if (theConfig()->vt_diag_enable and theConfig()->vt_diag_export) {
+    std::vector<component::Diagnostic*> sources;
+    p_->foreach([&](component::BaseComponent* c) { sources.push_back(c); });
+    diag_exporter_ = std::make_unique<component::DiagnosticExporter>();
+    diag_exporter_->start(sources);
+  }
+# endif
+
   vt_debug_print(normal, runtime, "end: setup\n");
 }
 
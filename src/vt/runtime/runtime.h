@@ -48,6 +48,7 @@
 #include "vt/runtime/runtime_common.h"
 #include "vt/runtime/runtime_component_fwd.h"
 #include "vt/worker/worker_headers.h"
+#include "vt/runtime/component/diagnostic_exporter.h"
 
 // Optional components
 #if vt_check_enabled(trace_enabled)
@@ -443,6 +444,7 @@ protected:
   MPI_Comm initial_communicator_ = MPI_COMM_NULL;
   std::unique_ptr<component::ComponentPack> p_;
   std::unique_ptr<arguments::ArgConfig> arg_config_;
+  std::unique_ptr<component::DiagnosticExporter> diag_exporter_;
   arguments::AppConfig const* app_config_;   /**< App config during startup */
 };
 
@@ -287,6 +287,63 @@ void Runtime::printStartupBanner() {
     fmt::print("{}\t{}{}", vt_pre, f12, reset);
   }
 
+  if (getAppConfig()->vt_sched_adaptive_poll) {
+    auto f11 = fmt::format(
+      "Adaptive polling of idle components (max backoff: {})",
+      getAppConfig()->vt_sched_poll_max_backoff
+    );
+    auto f12 = opt_on("--vt_sched_adaptive_poll", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_sched_idle_block) {
+    auto f11 = fmt::format(
+      "Blocking when idle after {} us (max block: {} us)",
+      getAppConfig()->vt_sched_idle_spin_us,
+      getAppConfig()->vt_sched_idle_block_us
+    );
+    auto f12 = opt_on("--vt_sched_idle_block", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (
+    getAppConfig()->vt_sched_weight_system != 16 or
+    getAppConfig()->vt_sched_weight_user != 8 or
+    getAppConfig()->vt_sched_weight_background != 1
+  ) {
+    auto f11 = fmt::format(
+      "Scheduler queue weights: system={}, user={}, background={}",
+      getAppConfig()->vt_sched_weight_system,
+      getAppConfig()->vt_sched_weight_user,
+      getAppConfig()->vt_sched_weight_background
+    );
+    auto f12 = opt_on("--vt_sched_weight_*", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_sched_latency_hist) {
+    auto f11 = fmt::format(
+      "Recording work unit latency histograms as queue and handler diagnostics"
+    );
+    auto f12 = opt_on("--vt_sched_latency_hist", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_sched_queue_latency) {
+    auto f11 = fmt::format("Timing scheduler queue latency for diagnostics");
+    auto f12 = opt_on("--vt_sched_queue_latency", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_sched_progress_tune) {
+    auto f11 = fmt::format(
+      "Auto-tuning handlers between progress calls (max: {})",
+      getAppConfig()->vt_sched_progress_tune_max
+    );
+    auto f12 = opt_on("--vt_sched_progress_tune", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
   if (getAppConfig()->vt_lb) {
     auto f9 = opt_on("--vt_lb", "Load balancing enabled");
     fmt::print("{}\t{}{}", vt_pre, f9, reset);
@@ -310,6 +367,15 @@ void Runtime::printStartupBanner() {
       auto a2 = opt_on("--vt_lb_interval", a1);
       fmt::print("{}\t{}{}", vt_pre, a2, reset);
 
+      if (getAppConfig()->vt_lb_adaptive) {
+        auto a5 = fmt::format(
+          "Adaptive LB: run only when gain over {} phases exceeds cost",
+          getAppConfig()->vt_lb_adaptive_horizon
+        );
+        auto a6 = opt_on("--vt_lb_adaptive", a5);
+        fmt::print("{}\t{}{}", vt_pre, a6, reset);
+      }
+
       // Check validity of LB passed to VT
       bool found = false;
       for (auto&& lb : vrt::collection::balance::get_lb_names()) {
@@ -771,6 +837,21 @@ void Runtime::printStartupBanner() {
       auto f14 = opt_on("--vt_diag_summary_csv_file", f13);
       fmt::print("{}\t{}{}", vt_pre, f14, reset);
     }
+
+    if (getAppConfig()->vt_diag_export) {
+      auto const period = getAppConfig()->vt_diag_export_period;
+      auto f13 = period > 0 ?
+        fmt::format(
+          "Exporting diagnostics time series \"{}\" every {} ms",
+          getAppConfig()->vt_diag_export_file, period
+        ) :
+        fmt::format(
+          "Exporting diagnostics time series \"{}\" every phase",
+          getAppConfig()->vt_diag_export_file
+        );
+      auto f14 = opt_on("--vt_diag_export", f13);
+      fmt::print("{}\t{}{}", vt_pre, f14, reset);
+    }
   } else {
 #   if vt_check_enabled(diagnostics_runtime)
     auto f11 = fmt::format("Diagnostics are disabled");
@@ -805,6 +886,39 @@ void Runtime::printStartupBanner() {
   }
 #endif
 
+  if (getAppConfig()->vt_coll_parallel_deliver) {
+    auto f11 = fmt::format(
+      "Concurrent collection broadcast delivery enabled (min elements: {})",
+      getAppConfig()->vt_coll_parallel_min_elms
+    );
+    auto f12 = opt_on("--vt_coll_parallel_deliver", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_coll_parallel_construct) {
+    auto f11 = fmt::format(
+      "Concurrent collection element construction enabled (min elements: {})",
+      getAppConfig()->vt_coll_parallel_min_elms
+    );
+    auto f12 = opt_on("--vt_coll_parallel_construct", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_group_scan_construct) {
+    auto f11 = fmt::format("Collective groups built by membership scan");
+    auto f12 = opt_on("--vt_group_scan_construct", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
+  if (getAppConfig()->vt_compact_envelope) {
+    auto f11 = fmt::format(
+      "Compact wire envelope for messages up to {} B",
+      getAppConfig()->vt_compact_envelope_max_size
+    );
+    auto f12 = opt_on("--vt_compact_envelope", f11);
+    fmt::print("{}\t{}{}", vt_pre, f12, reset);
+  }
+
   // Limit to between 256 B and 1 GiB. If its too small a VT envelope won't fit;
   // if its too large we overflow an integer passed to MPI.
   if (getAppConfig()->vt_max_mpi_send_size < 256) {
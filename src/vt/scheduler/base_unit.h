@@ -46,6 +46,7 @@
 
 #include "vt/config.h"
 #include "vt/runnable/runnable.fwd.h"
+#include "vt/timing/timing_type.h"
 
 #include <memory>
 
@@ -89,6 +90,34 @@ struct BaseUnit {
    */
   bool isTerm() const { return is_term_; }
 
+  /**
+   * \brief Set the time the unit was enqueued, for queue latency diagnostics
+   *
+   * \param[in] time the enqueue time
+   */
+  void setEnqueueTime(TimeType time) { enqueue_time_ = time; }
+
+  /**
+   * \brief Get the time the unit was enqueued
+   *
+   * \return the enqueue time
+   */
+  TimeType getEnqueueTime() const { return enqueue_time_; }
+
+  /**
+   * \brief Set the handler the unit runs, for per-handler latency histograms
+   *
+   * \param[in] han the handler
+   */
+  void setHandler(HandlerType han) { handler_ = han; }
+
+  /**
+   * \brief Get the handler the unit runs
+   *
+   * \return the handler, \c uninitialized_handler if not a message handler
+   */
+  HandlerType getHandler() const { return handler_; }
+
   /**
    * \brief Execute the work
    */
@@ -103,6 +132,8 @@ protected:
   RunnablePtrType r_ = nullptr; /**< the runnable task */
   ActionType work_ = nullptr;   /**< the lambda task */
   bool is_term_ = false;        /**< whether it's a termination task */
+  TimeType enqueue_time_ = 0.;  /**< when the unit was enqueued */
+  HandlerType handler_ = uninitialized_handler; /**< the unit's handler */
 };
 
 }} /* end namespace vt::sched */
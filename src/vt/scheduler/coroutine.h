@@ -0,0 +1,332 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 coroutine.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_COROUTINE_H
+#define INCLUDED_VT_SCHEDULER_COROUTINE_H
+
+#include "vt/config.h"
+
+/*
+ * Stackless coroutine handlers; only available when the including translation
+ * unit is compiled as C++20 (or later) with coroutine support.
+ */
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include "vt/messaging/active.h"
+#include "vt/messaging/async_op.h"
+#include "vt/termination/termination.h"
+#include "vt/scheduler/scheduler.h"
+#include "vt/pipe/pipe_manager.h"
+#include "vt/rdmahandle/request_holder.h"
+
+#include <coroutine>
+#include <memory>
+#include <utility>
+
+namespace vt { namespace coro {
+
+/**
+ * \struct Task
+ *
+ * \brief The return type of a coroutine handler.
+ *
+ * A \c Task starts running eagerly inside the handler that creates it, so
+ * everything up to the first suspending \c co_await runs exactly like a normal
+ * handler. When it suspends, the coroutine holds a local dependency on the
+ * epoch it was created in, so that epoch cannot terminate under it. It is
+ * parked in the scheduler's suspended units, and the scheduler resumes it
+ * (with that epoch pushed) once the awaited event occurs. No stack is
+ * allocated; the coroutine frame is freed when the body finishes.
+ *
+ * \note After the first suspension, the coroutine no longer runs inside the
+ * original handler's context: \c theContext()->getTask(), collection index
+ * queries and LB instrumentation do not refer to the original message.
+ * Messages must be held through \c MsgSharedPtr across suspension points.
+ */
+struct Task {
+  struct promise_type {
+    promise_type() : epoch_(theMsg()->getEpoch()) { }
+
+    promise_type(promise_type const&) = delete;
+    promise_type& operator=(promise_type const&) = delete;
+
+    ~promise_type() {
+      if (holds_epoch_) {
+        theTerm()->releaseLocalDependency(epoch_);
+      }
+    }
+
+    Task get_return_object() { return Task{}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() { }
+
+    void unhandled_exception() {
+      vtAbort("Exception escaped a coroutine handler");
+    }
+
+    /**
+     * \internal \brief Keep the creating epoch alive while suspended
+     */
+    void holdEpoch() {
+      if (not holds_epoch_) {
+        theTerm()->addLocalDependency(epoch_);
+        holds_epoch_ = true;
+      }
+    }
+
+    EpochType epoch_ = no_epoch;
+    bool holds_epoch_ = false;
+  };
+};
+
+namespace detail {
+
+using HandleType = std::coroutine_handle<Task::promise_type>;
+
+/**
+ * \internal \brief Park a coroutine in the scheduler's suspended units
+ *
+ * \param[in] h the coroutine handle
+ *
+ * \return the ID to pass to \c theSched()->resume(..) to resume it
+ */
+inline ThreadIDType suspend(HandleType h) {
+  auto& promise = h.promise();
+  promise.holdEpoch();
+  auto const ep = promise.epoch_;
+  return theSched()->suspendAction([h, ep]{
+    theMsg()->pushEpoch(ep);
+    h.resume();
+    theMsg()->popEpoch(ep);
+  });
+}
+
+/**
+ * \internal \struct RequestOp
+ *
+ * \brief Polls an RDMA handle request as an \c AsyncOp
+ */
+struct RequestOp final : messaging::AsyncOp {
+  explicit RequestOp(rdma::RequestHolder&& in_req)
+    : req_(std::move(in_req))
+  { }
+
+  bool poll() override { return req_.test(); }
+  void done() override { req_.wait(); }
+
+private:
+  rdma::RequestHolder req_;
+};
+
+} /* end namespace detail */
+
+/**
+ * \struct EpochAwaiter
+ *
+ * \brief Awaits termination of an epoch
+ */
+struct EpochAwaiter {
+  bool await_ready() const { return theTerm()->isEpochTerminated(epoch_); }
+
+  void await_suspend(detail::HandleType h) {
+    auto const id = detail::suspend(h);
+    theTerm()->addAction(epoch_, [id]{ theSched()->resume(id); });
+  }
+
+  void await_resume() const { }
+
+  EpochType epoch_ = no_epoch;
+};
+
+/**
+ * \struct AsyncOpAwaiter
+ *
+ * \brief Awaits completion of a pollable \c AsyncOp
+ */
+struct AsyncOpAwaiter {
+  bool await_ready() const { return false; }
+
+  void await_suspend(detail::HandleType h) {
+    auto const id = detail::suspend(h);
+    theMsg()->registerAsyncOpResume(std::move(op_), id);
+  }
+
+  void await_resume() const { }
+
+  std::unique_ptr<messaging::AsyncOp> op_ = nullptr;
+};
+
+/**
+ * \struct CallbackAwaiter
+ *
+ * \brief Awaits the message delivered to a local callback
+ *
+ * The awaiter lives in the suspended coroutine's frame, so the callback points
+ * straight at it without registering a pipe.
+ */
+template <typename MsgT>
+struct CallbackAwaiter {
+  using StartType = std::function<void(Callback<MsgT>)>;
+
+  explicit CallbackAwaiter(StartType in_start)
+    : start_(std::move(in_start))
+  { }
+
+  bool await_ready() const { return false; }
+
+  void await_suspend(detail::HandleType h) {
+    id_ = detail::suspend(h);
+    auto cb = theCB()->makeMemberLocal<
+      CallbackAwaiter<MsgT>, MsgT, &CallbackAwaiter<MsgT>::deliver
+    >(this);
+    start_(cb);
+  }
+
+  MsgSharedPtr<MsgT> await_resume() { return std::move(result_); }
+
+private:
+  void deliver(MsgT* msg) {
+    result_ = promoteMsg(msg);
+    theSched()->resume(id_);
+  }
+
+private:
+  StartType start_ = nullptr;
+  ThreadIDType id_ = no_thread_id;
+  MsgSharedPtr<MsgT> result_ = nullptr;
+};
+
+/**
+ * \brief Suspend until an epoch terminates
+ *
+ * \note Awaiting the epoch the coroutine itself runs in will never resume
+ *
+ * \param[in] epoch the epoch
+ *
+ * \return the awaitable
+ */
+inline EpochAwaiter epoch(EpochType epoch) {
+  return EpochAwaiter{epoch};
+}
+
+/**
+ * \brief Suspend until an async operation completes
+ *
+ * \param[in] op the operation
+ *
+ * \return the awaitable
+ */
+inline AsyncOpAwaiter asyncOp(std::unique_ptr<messaging::AsyncOp> op) {
+  return AsyncOpAwaiter{std::move(op)};
+}
+
+/**
+ * \brief Suspend until an RDMA handle request (e.g., from \c rget)
+ * completes
+ *
+ * \param[in] req the request
+ *
+ * \return the awaitable
+ */
+inline AsyncOpAwaiter request(rdma::RequestHolder&& req) {
+  return AsyncOpAwaiter{std::make_unique<detail::RequestOp>(std::move(req))};
+}
+
+/**
+ * \brief Suspend until a callback is triggered, yielding its message
+ *
+ * The callback is a local one (see \c PipeManager::makeMemberLocal), so the
+ * operation must trigger it on this node.
+ *
+ * Example snippet:
+ *
+ * \code{.cpp}
+ *  auto msg = co_await vt::coro::callback<DataMsg>([=](auto cb){
+ *    cache.fetch(key, cb); // triggers cb on this node once the data is here
+ *  });
+ * \endcode
+ *
+ * \param[in] start function that starts the operation given the callback
+ *
+ * \return the awaitable
+ */
+template <typename MsgT, typename StartT>
+CallbackAwaiter<MsgT> callback(StartT&& start) {
+  return CallbackAwaiter<MsgT>{std::forward<StartT>(start)};
+}
+
+/**
+ * \brief Adapt a coroutine to an active message handler
+ *
+ * \code{.cpp}
+ *  vt::coro::Task myCoro(vt::MsgSharedPtr<MyMsg> msg);
+ *  theMsg()->sendMsg<MyMsg, vt::coro::handler<MyMsg, myCoro>>(node, msg);
+ * \endcode
+ *
+ * \param[in] msg the message
+ */
+template <typename MsgT, Task (*f)(MsgSharedPtr<MsgT>)>
+void handler(MsgT* msg) {
+  f(promoteMsg(msg));
+}
+
+/**
+ * \brief Adapt a coroutine member of a collection or object group to a
+ * non-member handler taking the object
+ *
+ * \note A collection element must not migrate while one of its coroutines is
+ * suspended
+ *
+ * \param[in] msg the message
+ * \param[in] obj the object
+ */
+template <typename ObjT, typename MsgT, Task (ObjT::*f)(MsgSharedPtr<MsgT>)>
+void objHandler(MsgT* msg, ObjT* obj) {
+  (obj->*f)(promoteMsg(msg));
+}
+
+}} /* end namespace vt::coro */
+
+#endif /*__cpp_impl_coroutine*/
+#endif /*INCLUDED_VT_SCHEDULER_COROUTINE_H*/
@@ -0,0 +1,93 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              handler_latency.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/scheduler/handler_latency.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace vt { namespace sched {
+
+void HandlerLatency::record(
+  HandlerType handler, TimeType delay, TimeType exec
+) {
+  if (handler != uninitialized_handler) {
+    handlers_[handler].add(delay, exec);
+  }
+}
+
+HandlerLatency operator+(HandlerLatency h1, HandlerLatency const& h2) {
+  for (auto const& elm : h2.handlers_) {
+    h1.handlers_[elm.first].mergeIn(elm.second);
+  }
+  return h1;
+}
+
+std::vector<HandlerType> HandlerLatency::mostFrequent(
+  std::size_t max_handlers
+) const {
+  std::vector<std::pair<int64_t, HandlerType>> order;
+  for (auto const& elm : handlers_) {
+    order.emplace_back(elm.second.getCount(), elm.first);
+  }
+  std::sort(
+    order.begin(), order.end(),
+    [](std::pair<int64_t, HandlerType> const& a,
+       std::pair<int64_t, HandlerType> const& b) {
+      return a.first != b.first ? a.first > b.first : a.second < b.second;
+    }
+  );
+
+  std::vector<HandlerType> handlers;
+  for (auto const& elm : order) {
+    if (handlers.size() == max_handlers) {
+      break;
+    }
+    handlers.push_back(elm.second);
+  }
+  return handlers;
+}
+
+}} /* end namespace vt::sched */
@@ -0,0 +1,183 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              handler_latency.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_HANDLER_LATENCY_H
+#define INCLUDED_VT_SCHEDULER_HANDLER_LATENCY_H
+
+#include "vt/config.h"
+#include "vt/timing/timing_type.h"
+#include "vt/utils/adt/histogram_approx.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace sched {
+
+/**
+ * \struct LatencySketch
+ *
+ * \brief Approximate histograms of the queueing delay (enqueue to start) and
+ * execution time of work units
+ */
+struct LatencySketch {
+  using HistType = adt::HistogramApprox<double, int64_t>;
+
+  /// Centroids kept per histogram; bounds the memory and merge cost
+  static constexpr int64_t const max_centroids = 32;
+
+  LatencySketch()
+    : delay_(max_centroids),
+      exec_(max_centroids)
+  { }
+
+  /**
+   * \brief Add a work unit's times
+   *
+   * \param[in] delay seconds the unit waited in the queue
+   * \param[in] exec seconds the unit executed
+   */
+  void add(TimeType delay, TimeType exec) {
+    delay_.add(delay);
+    exec_.add(exec);
+  }
+
+  /**
+   * \brief Merge in another sketch, e.g., from another rank
+   *
+   * \param[in] in the sketch to merge in
+   */
+  void mergeIn(LatencySketch const& in) {
+    delay_.mergeIn(in.delay_);
+    exec_.mergeIn(in.exec_);
+  }
+
+  /**
+   * \brief Get the number of work units added
+   *
+   * \return the count
+   */
+  int64_t getCount() const { return delay_.getCount(); }
+
+  /**
+   * \brief Get the queueing delay histogram
+   *
+   * \return the histogram
+   */
+  HistType& getDelay() { return delay_; }
+
+  /**
+   * \brief Get the execution time histogram
+   *
+   * \return the histogram
+   */
+  HistType& getExec() { return exec_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | delay_ | exec_;
+  }
+
+private:
+  HistType delay_;
+  HistType exec_;
+};
+
+/**
+ * \struct HandlerLatency
+ *
+ * \brief Latency sketches of executed work units, kept per handler. Recorded
+ * on each rank with \c --vt_sched_latency_hist; sketches from several ranks
+ * can be merged with \c operator+. The per-queue times are recorded by the
+ * scheduler's \c queue_latency_* and \c queue_exec_* diagnostics instead.
+ */
+struct HandlerLatency {
+  /**
+   * \brief Record an executed work unit
+   *
+   * \param[in] handler the unit's handler, \c uninitialized_handler if none
+   * \param[in] delay seconds the unit waited in the queue
+   * \param[in] exec seconds the unit executed
+   */
+  void record(HandlerType handler, TimeType delay, TimeType exec);
+
+  /**
+   * \brief Merge two sets of sketches for a reduction across ranks
+   *
+   * \param[in] h1 the first operand
+   * \param[in] h2 the second operand
+   *
+   * \return the merged sketches
+   */
+  friend HandlerLatency operator+(HandlerLatency h1, HandlerLatency const& h2);
+
+  /**
+   * \brief Get the sketches of each handler that ran
+   *
+   * \return map from handler to sketch
+   */
+  std::unordered_map<HandlerType, LatencySketch>& getHandlers() {
+    return handlers_;
+  }
+
+  /**
+   * \brief Get the handlers that ran the most work units, most frequent first
+   * and ties broken by handler so that the order is the same on every rank
+   *
+   * \param[in] max_handlers the maximum number of handlers to return
+   *
+   * \return the handlers
+   */
+  std::vector<HandlerType> mostFrequent(std::size_t max_handlers) const;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | handlers_;
+  }
+
+private:
+  std::unordered_map<HandlerType, LatencySketch> handlers_;
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*INCLUDED_VT_SCHEDULER_HANDLER_LATENCY_H*/
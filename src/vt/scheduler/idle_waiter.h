@@ -0,0 +1,94 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                idle_waiter.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_IDLE_WAITER_H
+#define INCLUDED_VT_SCHEDULER_IDLE_WAITER_H
+
+#include "vt/config.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace vt { namespace sched {
+
+/**
+ * \struct IdleWaiter
+ *
+ * \brief Lets an idle scheduler sleep until another thread signals new work or
+ * a timeout expires
+ *
+ * A notification that arrives while nobody is waiting is remembered, so the
+ * next \c wait returns immediately instead of missing the wakeup. Once one is
+ * pending, further notifications only load an atomic flag and skip the mutex,
+ * so frequent notifiers pay for at most one lock per wait.
+ */
+struct IdleWaiter {
+  IdleWaiter() = default;
+  IdleWaiter(IdleWaiter const&) = delete;
+  IdleWaiter& operator=(IdleWaiter const&) = delete;
+
+  /**
+   * \brief Wake the waiting thread; safe to call from any thread and cheap
+   * while a notification is already pending
+   */
+  void notify();
+
+  /**
+   * \brief Block until notified or until \c timeout seconds elapse
+   *
+   * \param[in] timeout the maximum time to block in seconds
+   *
+   * \return whether a notification ended the wait
+   */
+  bool wait(TimeType timeout);
+
+private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic<bool> notified_ = {false};
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*INCLUDED_VT_SCHEDULER_IDLE_WAITER_H*/
@@ -0,0 +1,115 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              progress_tuner.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/scheduler/progress_tuner.h"
+
+#include <algorithm>
+
+namespace vt { namespace sched {
+
+/*static*/ constexpr int32_t const ProgressTuner::window_polls;
+/*static*/ constexpr double const ProgressTuner::high_ratio;
+/*static*/ constexpr double const ProgressTuner::low_ratio;
+/*static*/ constexpr double const ProgressTuner::revert_threshold;
+/*static*/ constexpr int32_t const ProgressTuner::hold_windows;
+
+ProgressTuner::ProgressTuner(
+  int32_t in_initial, int32_t in_min, int32_t in_max
+) : min_(std::max(1, in_min)),
+    max_(std::max(min_, in_max))
+{
+  interval_ = std::min(max_, std::max(min_, in_initial));
+}
+
+ProgressTuner::Decision ProgressTuner::recordPoll(
+  bool productive, int32_t handlers, TimeType elapsed
+) {
+  polls_++;
+  productive_ += productive ? 1 : 0;
+  handlers_ += handlers;
+  elapsed_ += elapsed;
+
+  if (polls_ < window_polls) {
+    return Decision::None;
+  }
+
+  last_ratio_ = static_cast<double>(productive_) / polls_;
+  last_throughput_ = elapsed_ > 0. ? handlers_ / elapsed_ : 0.;
+  polls_ = 0;
+  productive_ = 0;
+  handlers_ = 0;
+  elapsed_ = 0.;
+
+  // Judge the last increase by the throughput of the window that followed it
+  if (increased_from_ != 0) {
+    auto const from = increased_from_;
+    increased_from_ = 0;
+    if (last_throughput_ < prev_throughput_ * revert_threshold) {
+      interval_ = from;
+      hold_ = hold_windows;
+      return Decision::Revert;
+    }
+  }
+
+  if (hold_ > 0) {
+    hold_--;
+    return Decision::None;
+  }
+
+  if (last_ratio_ >= high_ratio and interval_ > min_) {
+    interval_ = std::max(min_, interval_ / 2);
+    return Decision::Decrease;
+  }
+
+  if (last_ratio_ <= low_ratio and interval_ < max_) {
+    increased_from_ = interval_;
+    prev_throughput_ = last_throughput_;
+    interval_ = std::min(max_, interval_ * 2);
+    return Decision::Increase;
+  }
+
+  return Decision::None;
+}
+
+}} /* end namespace vt::sched */
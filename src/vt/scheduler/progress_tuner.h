@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               progress_tuner.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_PROGRESS_TUNER_H
+#define INCLUDED_VT_SCHEDULER_PROGRESS_TUNER_H
+
+#include "vt/config.h"
+#include "vt/timing/timing_type.h"
+
+namespace vt { namespace sched {
+
+/**
+ * \struct ProgressTuner
+ *
+ * \brief Adapts the number of handlers the scheduler runs between progress
+ * polls from the observed poll productivity and handler throughput
+ *
+ * Polls taken while work is queued are grouped into windows. At the end of a
+ * window, a high fraction of productive polls (polls that found messages)
+ * halves the interval to favor message latency, and a low fraction doubles it
+ * to favor handler throughput. An increase that lowers the throughput of the
+ * next window is reverted and the interval is held for a few windows.
+ */
+struct ProgressTuner {
+  /// The tuner's decision at the end of a window
+  enum struct Decision : int8_t {
+    None     = 0,
+    Increase = 1,
+    Decrease = 2,
+    Revert   = 3
+  };
+
+  /// Polls per decision window
+  static constexpr int32_t const window_polls = 32;
+  /// Productive fraction at or above which the interval is decreased
+  static constexpr double const high_ratio = 0.5;
+  /// Productive fraction at or below which the interval is increased
+  static constexpr double const low_ratio = 0.1;
+  /// Relative throughput below which an increase is reverted
+  static constexpr double const revert_threshold = 0.9;
+  /// Windows to hold the interval after a revert
+  static constexpr int32_t const hold_windows = 4;
+
+  ProgressTuner() = default;
+
+  /**
+   * \brief Construct a tuner
+   *
+   * \param[in] in_initial the starting interval in handlers
+   * \param[in] in_min the smallest interval
+   * \param[in] in_max the largest interval
+   */
+  ProgressTuner(int32_t in_initial, int32_t in_min, int32_t in_max);
+
+  /**
+   * \brief Record a progress poll taken after running handlers
+   *
+   * \param[in] productive whether the poll found messages or other work
+   * \param[in] handlers the handlers run since the previous poll
+   * \param[in] elapsed seconds since the previous poll, including this one
+   *
+   * \return the decision made if this poll ends a window
+   */
+  Decision recordPoll(bool productive, int32_t handlers, TimeType elapsed);
+
+  /**
+   * \brief Get the current interval
+   *
+   * \return handlers to run between progress polls
+   */
+  int32_t getInterval() const { return interval_; }
+
+  /**
+   * \brief Get the productive poll fraction of the last window
+   *
+   * \return the fraction in [0, 1]
+   */
+  double getProductiveRatio() const { return last_ratio_; }
+
+  /**
+   * \brief Get the handler throughput of the last window
+   *
+   * \return handlers per second
+   */
+  double getThroughput() const { return last_throughput_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | interval_
+      | min_
+      | max_
+      | polls_
+      | productive_
+      | handlers_
+      | elapsed_
+      | increased_from_
+      | prev_throughput_
+      | hold_
+      | last_ratio_
+      | last_throughput_;
+  }
+
+private:
+  int32_t interval_ = 1;
+  int32_t min_ = 1;
+  int32_t max_ = 1;
+
+  // Accumulated over the current window
+  int32_t polls_ = 0;
+  int32_t productive_ = 0;
+  int64_t handlers_ = 0;
+  TimeType elapsed_ = 0.;
+
+  // Interval before the last increase, 0 once it has been judged
+  int32_t increased_from_ = 0;
+  double prev_throughput_ = 0.;
+  int32_t hold_ = 0;
+
+  double last_ratio_ = 0.;
+  double last_throughput_ = 0.;
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*INCLUDED_VT_SCHEDULER_PROGRESS_TUNER_H*/
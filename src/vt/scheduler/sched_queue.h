@@ -0,0 +1,81 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                sched_queue.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_SCHED_QUEUE_H
+#define INCLUDED_VT_SCHEDULER_SCHED_QUEUE_H
+
+#include "vt/config.h"
+
+namespace vt { namespace sched {
+
+/**
+ * \brief The scheduler ready queue a message or action is enqueued on. The
+ * scheduler serves the non-empty queues in weighted round-robin order, see
+ * \c --vt_sched_weight_system and friends.
+ */
+enum struct SchedQueue : uint8_t {
+  User       = 0,   /**< Application handlers (the default) */
+  System     = 1,   /**< Runtime control: termination, location, reductions */
+  Background = 2    /**< Deferrable work that should not delay other work */
+};
+
+/// Number of scheduler ready queues
+static constexpr int const num_sched_queues = 3;
+
+/// Number of envelope bits for the scheduler queue
+static constexpr BitCountType const sched_queue_num_bits = 2;
+
+/// Printable name for each queue, indexed by \c SchedQueue
+static constexpr char const* const sched_queue_names[num_sched_queues] = {
+  "user", "system", "background"
+};
+
+}} /* end namespace vt::sched */
+
+namespace vt {
+
+using SchedQueue = sched::SchedQueue;
+
+} /* end namespace vt */
+
+#endif /*INCLUDED_VT_SCHEDULER_SCHED_QUEUE_H*/
@@ -56,6 +56,9 @@
 #include "vt/runtime/runtime.h"
 #include "vt/runtime/mpi_access.h"
 #include "vt/scheduler/thread_manager.h"
+#include "vt/collective/reduce/operators/default_msg.h"
+#include "vt/collective/reduce/reduce.h"
+#include "vt/pipe/pipe_manager.h"
 
 namespace vt { namespace sched {
 
@@ -67,9 +70,14 @@ namespace vt { namespace sched {
 }
 
 Scheduler::Scheduler()
+  :
 #if vt_check_enabled(fcontext)
-  : thread_manager_(std::make_unique<ThreadManager>())
+    thread_manager_(std::make_unique<ThreadManager>()),
 #endif
+    timer_wheel_(
+      std::max(1, theConfig()->vt_sched_timer_tick_us) * 1e-6,
+      timing::getCurrentTime()
+    )
 {
   auto event_count = SchedulerEventType::LastSchedulerEvent + 1;
   event_triggers.resize(event_count);
@@ -77,6 +85,14 @@ Scheduler::Scheduler()
 
   progress_time_enabled_ = theConfig()->vt_sched_progress_sec != 0.0;
 
+  progress_tune_enabled_ = theConfig()->vt_sched_progress_tune;
+  if (progress_tune_enabled_) {
+    progress_tuner_ = ProgressTuner{
+      std::max(1, theConfig()->vt_sched_progress_han), 1,
+      theConfig()->vt_sched_progress_tune_max
+    };
+  }
+
   // Number of times the progress function is called to poll components
   progressCount = registerCounter("num_progress", "progress function calls");
 
@@ -86,11 +102,69 @@ Scheduler::Scheduler()
   // Max/avg of work units enqueued
   queueSizeGauge = registerGauge("queue_size", "work queue size");
 
+  // Timers that expired and deadline units that started late
+  timerCount = registerCounter("timers_expired", "scheduler timers expired");
+  deadlineMissCount = registerCounter(
+    "deadline_misses", "deadline units started after their deadline"
+  );
+  idleBlockCount = registerCounter(
+    "idle_blocks", "times the idle scheduler blocked"
+  );
+
+  // Decisions of the progress interval auto-tuner
+  progressIntervalGauge = registerGauge(
+    "progress_interval", "handlers between progress calls (auto-tuned)"
+  );
+  progressTuneIncCount = registerCounter(
+    "progress_tune_inc", "progress interval increases"
+  );
+  progressTuneDecCount = registerCounter(
+    "progress_tune_dec", "progress interval decreases"
+  );
+  progressTuneRevertCount = registerCounter(
+    "progress_tune_revert", "progress interval increases reverted"
+  );
+
   // Time scheduler
   vtLiveTime = registerTimer("init_time", "duration VT was initialized");
   schedLoopTime = registerTimer("sched_loop", "inside scheduler loop");
   idleTime = registerTimer("idle_time", "idle time (inc. TD)");
   idleTimeMinusTerm = registerTimer("idle_time_term", "idle time (exc. TD)");
+  idleBlockTime = registerTimer("idle_block_time", "idle time spent blocked");
+
+  // Depth, enqueue-to-run latency and execution time of each scheduler queue
+  for (int i = 0; i < num_sched_queues; i++) {
+    auto const name = std::string{sched_queue_names[i]};
+    queueDepthGauge[i] = registerGauge(
+      "queue_size_" + name, name + " work queue size"
+    );
+    queueLatencyTime[i] = registerTimer(
+      "queue_latency_" + name, name + " work queue latency"
+    );
+    queueExecTime[i] = registerTimer(
+      "queue_exec_" + name, name + " work unit execution time"
+    );
+  }
+
+  queue_weights_[static_cast<int>(SchedQueue::System)] =
+    theConfig()->vt_sched_weight_system;
+  queue_weights_[static_cast<int>(SchedQueue::User)] =
+    theConfig()->vt_sched_weight_user;
+  queue_weights_[static_cast<int>(SchedQueue::Background)] =
+    theConfig()->vt_sched_weight_background;
+  for (auto& weight : queue_weights_) {
+    weight = std::max(weight, 1);
+  }
+
+  // Stamping units costs a clock read per enqueue, so it is opt-in even when
+  // diagnostics are compiled in. The latency histograms time the queue
+  // themselves when the unit starts.
+  latency_hist_enabled_ = theConfig()->vt_sched_latency_hist;
+# if vt_check_enabled(diagnostics)
+  queue_latency_enabled_ =
+    theConfig()->vt_sched_queue_latency and not latency_hist_enabled_;
+# endif
+  time_units_ = latency_hist_enabled_ or queue_latency_enabled_;
 
   // Explicitly define these out when diagnostics are disabled---they might be
   // expensive
@@ -111,8 +185,98 @@ Scheduler::Scheduler()
 # endif
 }
 
+namespace {
+
+/// Handlers reported with their own diagnostics; the rest go in "other"
+constexpr std::size_t const max_reported_handlers = 8;
+
+} /* end anon namespace */
+
 void Scheduler::preDiagnostic() {
   vtLiveTime.stop();
+
+  if (latency_hist_enabled_ and theConfig()->vt_diag_enable) {
+    reportHandlerLatency();
+  }
+}
+
+void Scheduler::reportHandlerLatency() {
+  // Diagnostics are registered collectively, so every node must report the
+  // same handlers: merge the sketches to agree on the most frequent ones
+  runInEpochCollective("Scheduler::reportHandlerLatency", [this]{
+    auto msg = makeMessage<HandlerLatencyMsgType>(handler_latency_);
+    auto cb = theCB()->makeBcast<
+      HandlerLatencyMsgType, &Scheduler::handlerLatencyHandler
+    >();
+    reducer()->reduce<collective::PlusOp<HandlerLatency>>(0, msg.get(), cb);
+  });
+
+  auto& handlers = handler_latency_.getHandlers();
+  LatencySketch other;
+  for (auto&& elm : handlers) {
+    auto const& rep = reported_handlers_;
+    if (std::find(rep.begin(), rep.end(), elm.first) == rep.end()) {
+      other.mergeIn(elm.second);
+    }
+  }
+
+  for (auto const han : reported_handlers_) {
+    reportLatencySketch(fmt::format("{:#x}", han), handlers[han]);
+  }
+  reportLatencySketch("other", other);
+}
+
+/*static*/ void Scheduler::handlerLatencyHandler(HandlerLatencyMsgType* msg) {
+  theSched()->reported_handlers_ =
+    msg->getConstVal().mostFrequent(max_reported_handlers);
+}
+
+void Scheduler::reportLatencySketch(
+  std::string const& label, LatencySketch& sketch
+) {
+  using runtime::component::DiagnosticUnit;
+
+  auto const units_key = "handler_units_" + label;
+  registerDiagnostic<int64_t>(
+    units_key, "work units run by handler " + label, UpdateType::Sum,
+    DiagnosticUnit::Units
+  );
+  updateDiagnostic<int64_t>(units_key, sketch.getCount());
+
+  // The quantiles of this node's sketch; nodes where the handler never ran
+  // leave them unset so they are skipped in the summary
+  auto quantiles = [&](
+    std::string const& key, std::string const& desc,
+    LatencySketch::HistType& hist
+  ) {
+    auto const p50 = key + " [p50]";
+    auto const p99 = key + " [p99]";
+    auto const max = key + " [max]";
+    registerDiagnostic<double>(
+      p50, desc + " (median)", UpdateType::Replace, DiagnosticUnit::Seconds
+    );
+    registerDiagnostic<double>(
+      p99, desc + " (99th percentile)", UpdateType::Replace,
+      DiagnosticUnit::Seconds
+    );
+    registerDiagnostic<double>(
+      max, desc + " (max)", UpdateType::Replace, DiagnosticUnit::Seconds
+    );
+    if (sketch.getCount() > 0) {
+      updateDiagnostic<double>(p50, hist.quantile(0.5));
+      updateDiagnostic<double>(p99, hist.quantile(0.99));
+      updateDiagnostic<double>(max, hist.getMax());
+    }
+  };
+
+  quantiles(
+    "handler_latency_" + label, "queue delay of handler " + label,
+    sketch.getDelay()
+  );
+  quantiles(
+    "handler_exec_" + label, "execution time of handler " + label,
+    sketch.getExec()
+  );
 }
 
 void Scheduler::runWorkUnit(UnitType& work) {
@@ -145,6 +309,40 @@ void Scheduler::runWorkUnit(UnitType& work) {
   }
 }
 
+void Scheduler::enqueueUnit(SchedQueue queue, UnitType&& unit) {
+  auto const idx = static_cast<int>(queue);
+
+  if (time_units_) {
+    unit.setEnqueueTime(timing::getCurrentTime());
+  }
+
+  work_queues_[idx].emplace(std::move(unit));
+}
+
+Scheduler::UnitType Scheduler::popWorkUnit() {
+  // Each pass either serves the current queue or moves on and resets the turn,
+  // so a non-empty queue is reached within one full rotation
+  for (int i = 0; i <= num_sched_queues; i++) {
+    auto& queue = work_queues_[cur_queue_];
+    if (not queue.empty() and served_in_turn_ < queue_weights_[cur_queue_]) {
+      served_in_turn_++;
+      queueDepthGauge[cur_queue_].update(queue.size());
+      UnitType work = queue.pop();
+      if (queue_latency_enabled_) {
+        queueLatencyTime[cur_queue_].update(
+          work.getEnqueueTime(), timing::getCurrentTime()
+        );
+      }
+      return work;
+    }
+    cur_queue_ = (cur_queue_ + 1) % num_sched_queues;
+    served_in_turn_ = 0;
+  }
+
+  vtAbort("popWorkUnit called with all scheduler queues empty");
+  return work_queues_[0].pop();
+}
+
 /*private*/
 bool Scheduler::progressImpl() {
   int const total = curRT->progress();
@@ -165,10 +363,10 @@ bool Scheduler::shouldCallProgress(
 
   // By default, `vt_sched_progress_han` is 0 and will happen every time we go
   // through the scheduler
-  bool k_handler_enabled = theConfig()->vt_sched_progress_han != 0;
+  auto const progress_han = getProgressInterval();
+  bool k_handler_enabled = progress_han != 0;
   bool k_handlers_executed =
-    k_handler_enabled and
-    processed_since_last_progress >= theConfig()->vt_sched_progress_han;
+    k_handler_enabled and processed_since_last_progress >= progress_han;
   bool enough_time_passed =
     progress_time_enabled_ and
     time_since_last_progress > theConfig()->vt_sched_progress_sec;
@@ -217,37 +415,122 @@ void Scheduler::runProgress(bool msg_only) {
    * progress on MPI
    */
   auto const num_iter = std::max(1, theConfig()->vt_sched_num_progress);
+  bool productive = false;
   for (int i = 0; i < num_iter; i++) {
     if (msg_only) {
       // This is a special case used only during startup when other components
       // are not ready and progress should not be called on them.
-      progressMsgOnlyImpl();
+      productive |= progressMsgOnlyImpl();
     } else {
-      progressImpl();
+      productive |= progressImpl();
     }
     progressCount.increment(1);
   }
+  made_progress_ |= productive;
 
   if (theConfig()->vt_print_memory_at_threshold) {
     printMemoryUsage();
   }
 
+  auto const now = timing::getCurrentTime();
+
+  // Only polls that interrupted handler execution inform the tuner; idle polls
+  // say nothing about the interval
+  if (progress_tune_enabled_ and processed_after_last_progress_ > 0) {
+    tuneProgress(productive, now - last_progress_time_);
+  }
+
   // Reset count of processed handlers since the last time progress was invoked
   processed_after_last_progress_ = 0;
-  last_progress_time_ = timing::getCurrentTime();
+  last_progress_time_ = now;
+}
+
+int32_t Scheduler::getProgressInterval() const {
+  return progress_tune_enabled_ ?
+    progress_tuner_.getInterval() : theConfig()->vt_sched_progress_han;
+}
+
+void Scheduler::tuneProgress(bool productive, TimeType elapsed) {
+  using Decision = ProgressTuner::Decision;
+
+  auto const decision = progress_tuner_.recordPoll(
+    productive, processed_after_last_progress_, elapsed
+  );
+  if (decision == Decision::None) {
+    return;
+  }
+
+  switch (decision) {
+  case Decision::Increase: progressTuneIncCount.increment(1);    break;
+  case Decision::Decrease: progressTuneDecCount.increment(1);    break;
+  case Decision::Revert:   progressTuneRevertCount.increment(1); break;
+  default:                                                        break;
+  }
+  progressIntervalGauge.update(progress_tuner_.getInterval());
+
+  vt_debug_print(
+    normal, gen,
+    "tuneProgress: decision={}, interval={}, productive={:.2f}, "
+    "throughput={:.0f}/s\n",
+    static_cast<int>(decision), progress_tuner_.getInterval(),
+    progress_tuner_.getProductiveRatio(), progress_tuner_.getThroughput()
+  );
+}
+
+void Scheduler::pollTimers() {
+  // Bound the work per scheduler iteration; a backlog of expired ticks is
+  // worked off over subsequent iterations
+  static constexpr int const max_ticks_per_poll = 64;
+  auto const num = timer_wheel_.advance(
+    timing::getCurrentTime(), max_ticks_per_poll
+  );
+  if (num > 0) {
+    timerCount.increment(num);
+  }
+}
+
+TimerIDType Scheduler::addTimer(
+  TimeType delay, ActionType action, ActionType on_cancel
+) {
+  return timer_wheel_.schedule(
+    timing::getCurrentTime() + delay, std::move(action), std::move(on_cancel)
+  );
+}
+
+bool Scheduler::cancelTimer(TimerIDType id) {
+  return timer_wheel_.cancel(id);
+}
+
+TimerIDType Scheduler::timeoutEpoch(
+  EpochType epoch, TimeType timeout, ActionType on_timeout
+) {
+  auto const id = addTimer(timeout, [this, epoch, on_timeout]{
+    if (not theTerm()->isEpochTerminated(epoch)) {
+      enqueue(on_timeout);
+    }
+  });
+  theTerm()->addAction(epoch, [this, id]{ cancelTimer(id); });
+  return id;
 }
 
 void Scheduler::runSchedulerOnceImpl(bool msg_only) {
+  made_progress_ = false;
+
+  if (not msg_only and not timer_wheel_.empty()) {
+    pollTimers();
+  }
+
   auto time_since_last_progress = timing::getCurrentTime() - last_progress_time_;
   if (
-    work_queue_.empty() or
+    workQueueEmpty() or
     shouldCallProgress(processed_after_last_progress_, time_since_last_progress)
   ) {
     runProgress(msg_only);
   }
 
-  if (not work_queue_.empty()) {
-    queueSizeGauge.update(work_queue_.size());
+  if (not workQueueEmpty()) {
+    auto const queue_size = workQueueSize();
+    queueSizeGauge.update(queue_size);
 
     processed_after_last_progress_++;
 
@@ -258,7 +541,7 @@ void Scheduler::runSchedulerOnceImpl(bool msg_only) {
       is_idle = false;
       triggerEvent(SchedulerEventType::EndIdle);
     }
-    if (is_idle_minus_term and num_term_msgs_ not_eq work_queue_.size()) {
+    if (is_idle_minus_term and num_term_msgs_ not_eq queue_size) {
       is_idle_minus_term = false;
       triggerEvent(SchedulerEventType::EndIdleMinusTerm);
     }
@@ -266,15 +549,31 @@ void Scheduler::runSchedulerOnceImpl(bool msg_only) {
     /*
      * Run a work unit!
      */
-    UnitType work = work_queue_.pop();
-    runWorkUnit(work);
+    UnitType work = popWorkUnit();
+    if (latency_hist_enabled_) {
+      // popWorkUnit leaves the rotation on the queue it served
+      auto const queue = static_cast<SchedQueue>(cur_queue_);
+      auto const handler = work.getHandler();
+      auto const start = timing::getCurrentTime();
+      runWorkUnit(work);
+      auto const end = timing::getCurrentTime();
+      handler_latency_.record(
+        handler, start - work.getEnqueueTime(), end - start
+      );
+      auto const idx = static_cast<int>(queue);
+      queueLatencyTime[idx].update(work.getEnqueueTime(), start);
+      queueExecTime[idx].update(start, end);
+    } else {
+      runWorkUnit(work);
+    }
+    made_progress_ = true;
 
     // Enter idle state immediately after processing if relevant.
-    if (not is_idle_minus_term and num_term_msgs_ == work_queue_.size()) {
+    if (not is_idle_minus_term and isIdleMinusTerm()) {
       is_idle_minus_term = true;
       triggerEvent(SchedulerEventType::BeginIdleMinusTerm);
     }
-    if (not is_idle and work_queue_.empty()) {
+    if (not is_idle and workQueueEmpty()) {
       is_idle = true;
       triggerEvent(SchedulerEventType::BeginIdle);
     }
@@ -307,13 +606,19 @@ void Scheduler::runSchedulerWhile(std::function<bool()> cond) {
 
   // Ensure to immediately enter an idle state if such applies.
   // The scheduler call ends idle as picking up work.
-  if (not is_idle and work_queue_.empty()) {
+  if (not is_idle and workQueueEmpty()) {
     is_idle = true;
     triggerEvent(SchedulerEventType::BeginIdle);
   }
 
+  bool const idle_block = theConfig()->vt_sched_idle_block;
+  last_activity_time_ = timing::getCurrentTime();
+
   while (cond()) {
     runSchedulerOnceImpl();
+    if (idle_block) {
+      maybeBlockIdle();
+    }
   }
 
   // After running the scheduler ensure to exit idle state.
@@ -325,6 +630,52 @@ void Scheduler::runSchedulerWhile(std::function<bool()> cond) {
   }
 }
 
+void Scheduler::wakeIdle() {
+  if (theConfig()->vt_sched_idle_block) {
+    idle_waiter_.notify();
+  }
+}
+
+void Scheduler::maybeBlockIdle() {
+  // Shortest block, so brief lulls do not oversleep
+  static constexpr TimeType const min_block_sec = 1e-5;
+
+  auto const now = timing::getCurrentTime();
+  if (made_progress_ or not workQueueEmpty()) {
+    last_activity_time_ = now;
+    idle_block_sec_ = 0.0;
+    return;
+  }
+
+  auto const spin_sec = theConfig()->vt_sched_idle_spin_us * 1e-6;
+  if (now - last_activity_time_ < spin_sec) {
+    return;
+  }
+
+  // Nothing has arrived for a while: sleep instead of polling MPI in a tight
+  // loop. The scheduler is still idle, so idle time keeps accumulating. Only
+  // worker threads and timers can end the wait early; an incoming MPI message
+  // is not seen until the probe after it, so each block adds up to its length
+  // in message latency.
+  auto const max_block_sec = std::max(
+    theConfig()->vt_sched_idle_block_us * 1e-6, min_block_sec
+  );
+  idle_block_sec_ = std::min(
+    std::max(idle_block_sec_ * 2, min_block_sec), max_block_sec
+  );
+  auto timeout = idle_block_sec_;
+  if (not timer_wheel_.empty()) {
+    timeout = std::min(timeout, timer_wheel_.getTick());
+  }
+
+  idleBlockCount.increment(1);
+  idleBlockTime.start();
+  if (idle_waiter_.wait(timeout)) {
+    idle_block_sec_ = 0.0;
+  }
+  idleBlockTime.stop();
+}
+
 void Scheduler::triggerEvent(SchedulerEventType const& event) {
   vtAssert(
     event_triggers.size() >= static_cast<size_t>(event), "Must be large enough to hold this event"
@@ -368,6 +719,10 @@ void Scheduler::resume(ThreadIDType tid) {
   suspended_.resumeRunnable(tid);
 }
 
+ThreadIDType Scheduler::suspendAction(ActionType action, PriorityType p) {
+  return suspended_.addSuspendedAction(std::move(action), p);
+}
+
 #if vt_check_enabled(fcontext)
 ThreadManager* Scheduler::getThreadManager() {
   return thread_manager_.get();
@@ -50,10 +50,16 @@
 #include "vt/scheduler/prioritized_work_unit.h"
 #include "vt/scheduler/work_unit.h"
 #include "vt/scheduler/suspended_units.h"
+#include "vt/scheduler/timer_wheel.h"
+#include "vt/scheduler/idle_waiter.h"
+#include "vt/scheduler/sched_queue.h"
+#include "vt/scheduler/handler_latency.h"
+#include "vt/scheduler/progress_tuner.h"
 #include "vt/timing/timing.h"
 #include "vt/runtime/component/component_pack.h"
 #include "vt/messaging/async_op_wrapper.fwd.h"
 
+#include <array>
 #include <cassert>
 #include <vector>
 #include <list>
@@ -81,7 +87,16 @@ namespace messaging {
 template <typename T>
 struct MsgSharedPtr;
 
-}} /* end namespace vt::messaging */
+} /* end namespace messaging */
+
+namespace collective { namespace reduce { namespace operators {
+
+template <typename T>
+struct ReduceTMsg;
+
+}}} /* end namespace collective::reduce::operators */
+
+} /* end namespace vt */
 
 namespace vt { namespace sched {
 
@@ -108,6 +123,10 @@ enum SchedulerEvent {
  *
  * Tracks work to be completed, orders it by priority, and executes it. Polls
  * components for incoming work.
+ *
+ * Ready work is partitioned into the queues of \c SchedQueue so runtime
+ * control messages are not stuck behind application handlers. The non-empty
+ * queues are served in weighted round-robin order.
  */
 struct Scheduler : runtime::component::Component<Scheduler> {
   using SchedulerEventType   = SchedulerEvent;
@@ -126,8 +145,10 @@ struct Scheduler : runtime::component::Component<Scheduler> {
 
 # if vt_check_enabled(priorities)
   using UnitType             = PriorityUnit;
+  using QueueType            = PriorityQueue<UnitType>;
 # else
   using UnitType             = Unit;
+  using QueueType            = Queue<UnitType>;
 # endif
 
   Scheduler();
@@ -189,6 +210,13 @@ struct Scheduler : runtime::component::Component<Scheduler> {
    */
   void runSchedulerWhile(std::function<bool()> cond);
 
+  /**
+   * \brief Wake the scheduler if it is blocked idle; safe to call from any
+   * thread, e.g. when a worker thread finishes or enqueues work. Does nothing
+   * unless \c --vt_sched_idle_block is enabled.
+   */
+  void wakeIdle();
+
   /**
    * \brief Register a trigger with the scheduler
    *
@@ -240,6 +268,16 @@ struct Scheduler : runtime::component::Component<Scheduler> {
   template <typename RunT>
   void enqueue(PriorityType priority, RunT r);
 
+  /**
+   * \brief Enqueue a runnable or action on a specific scheduler queue with the
+   * default priority
+   *
+   * \param[in] queue the scheduler queue
+   * \param[in] r the runnable to execute later
+   */
+  template <typename RunT>
+  void enqueue(SchedQueue queue, RunT r);
+
   /**
    * \brief Print current memory usage
    */
@@ -268,30 +306,54 @@ struct Scheduler : runtime::component::Component<Scheduler> {
   /**
    * \brief Get the work queue size
    *
+   * \return how many units in all the queues
+   */
+  std::size_t workQueueSize() const {
+    std::size_t size = 0;
+    for (auto const& queue : work_queues_) {
+      size += queue.size();
+    }
+    return size;
+  }
+
+  /**
+   * \brief Get the size of one scheduler queue
+   *
+   * \param[in] queue the scheduler queue
+   *
    * \return how many units in the queue
    */
-  std::size_t workQueueSize() const { return work_queue_.size(); }
+  std::size_t workQueueSize(SchedQueue queue) const {
+    return work_queues_[static_cast<int>(queue)].size();
+  }
 
   /**
    * \brief Query if the work queue is empty
    *
    * \return whether it is empty
    */
-  bool workQueueEmpty() const { return work_queue_.empty(); }
+  bool workQueueEmpty() const {
+    for (auto const& queue : work_queues_) {
+      if (not queue.empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
 
   /**
    * \brief Check if the scheduler is idle
    *
    * \return whether this scheduler is idle
    */
-  bool isIdle() const { return work_queue_.empty(); }
+  bool isIdle() const { return workQueueEmpty(); }
 
   /**
    * \internal \brief Check if the scheduler is idle minus termination messages
    *
    * \return whether this scheduler is idle
    */
-  bool isIdleMinusTerm() const { return work_queue_.size() == num_term_msgs_; }
+  bool isIdleMinusTerm() const { return workQueueSize() == num_term_msgs_; }
 
   /**
    * \brief Suspend a thread with an ID and runnable
@@ -312,6 +374,145 @@ struct Scheduler : runtime::component::Component<Scheduler> {
    */
   void resume(ThreadIDType tid);
 
+  /**
+   * \brief Suspend a unit that is resumed by enqueuing an action (e.g., a
+   * stackless coroutine) until \c resume is called with the returned ID
+   *
+   * \param[in] action the action that resumes the unit
+   * \param[in] p the priority for resumption
+   *
+   * \return the ID to pass to \c resume
+   */
+  ThreadIDType suspendAction(
+    ActionType action, PriorityType p = default_priority
+  );
+
+  /**
+   * \brief Enqueue a runnable or action with the default priority once a delay
+   * has elapsed
+   *
+   * The enclosing epoch is kept from terminating until the unit is enqueued
+   * (or the timer is cancelled).
+   *
+   * \param[in] delay seconds to wait before enqueuing
+   * \param[in] r the runnable to execute later
+   *
+   * \return the timer ID, which may be passed to \c cancelTimer
+   */
+  template <typename RunT>
+  TimerIDType enqueueAfter(TimeType delay, RunT r);
+
+  /**
+   * \brief Enqueue a runnable or action with a priority once a delay has
+   * elapsed
+   *
+   * \param[in] delay seconds to wait before enqueuing
+   * \param[in] priority the priority of the action
+   * \param[in] r the runnable to execute later
+   *
+   * \return the timer ID, which may be passed to \c cancelTimer
+   */
+  template <typename RunT>
+  TimerIDType enqueueAfter(TimeType delay, PriorityType priority, RunT r);
+
+  /**
+   * \brief Enqueue a runnable associated with a message once a delay has
+   * elapsed. The message's epoch is kept alive while it waits.
+   *
+   * \param[in] delay seconds to wait before enqueuing
+   * \param[in] msg the message
+   * \param[in] r the runnable to execute later
+   *
+   * \return the timer ID, which may be passed to \c cancelTimer
+   */
+  template <typename MsgT, typename RunT>
+  TimerIDType enqueueAfter(
+    TimeType delay, messaging::MsgSharedPtr<MsgT> msg, RunT r
+  );
+
+  /**
+   * \brief Enqueue a runnable associated with a message that has a deadline
+   *
+   * The runnable is enqueued immediately with the message's priority. If it
+   * has not run \c lead seconds before the deadline, it is enqueued again on
+   * the system queue (at \c max_priority when priorities are enabled), which
+   * the scheduler serves ahead of user work; whichever copy is reached first
+   * runs and the other is dropped. Runs that start after the deadline are counted in the
+   * \c deadline_misses diagnostic.
+   *
+   * \param[in] msg the message
+   * \param[in] time_to_deadline seconds from now until the deadline
+   * \param[in] lead seconds before the deadline to raise the priority
+   * \param[in] r the runnable to execute
+   */
+  template <typename MsgT, typename RunT>
+  void enqueueDeadline(
+    messaging::MsgSharedPtr<MsgT> msg, TimeType time_to_deadline,
+    TimeType lead, RunT r
+  );
+
+  /**
+   * \internal \brief Register a timer whose action runs directly from the
+   * scheduler loop when it expires; the action must be short and must not
+   * block.
+   *
+   * \param[in] delay seconds until the timer expires
+   * \param[in] action the action to run on expiration
+   * \param[in] on_cancel optional action to run if the timer is cancelled
+   *
+   * \return the timer ID
+   */
+  TimerIDType addTimer(
+    TimeType delay, ActionType action, ActionType on_cancel = nullptr
+  );
+
+  /**
+   * \brief Cancel a pending timer
+   *
+   * \param[in] id the timer ID
+   *
+   * \return whether the timer was still pending
+   */
+  bool cancelTimer(TimerIDType id);
+
+  /**
+   * \brief Enqueue an action if an epoch has not terminated within a timeout
+   *
+   * \param[in] epoch the epoch to watch
+   * \param[in] timeout seconds to wait for termination
+   * \param[in] on_timeout the action to enqueue on timeout
+   *
+   * \return the timer ID; the timer is cancelled when the epoch terminates
+   */
+  TimerIDType timeoutEpoch(
+    EpochType epoch, TimeType timeout, ActionType on_timeout
+  );
+
+  /**
+   * \brief Get the number of pending timers
+   *
+   * \return the number of pending timers
+   */
+  std::size_t numPendingTimers() const { return timer_wheel_.size(); }
+
+  /**
+   * \brief Get the number of handlers run between progress calls chosen by
+   * \c --vt_sched_progress_tune
+   *
+   * \return the current interval, or \c --vt_sched_progress_han when the
+   * tuner is disabled
+   */
+  int32_t getProgressInterval() const;
+
+  /**
+   * \brief Get the per-handler latency histograms recorded on this node with
+   * \c --vt_sched_latency_hist. At finalize, the most frequent handlers across
+   * all nodes are reported as \c handler_* diagnostics.
+   *
+   * \return the per-handler latency sketches
+   */
+  HandlerLatency& getHandlerLatency() { return handler_latency_; }
+
 #if vt_check_enabled(fcontext)
   /**
    * \brief Get the thread manager
@@ -323,11 +524,18 @@ struct Scheduler : runtime::component::Component<Scheduler> {
 
   template <typename SerializerT>
   void serialize(SerializerT& s) {
-    s | work_queue_
+    s | work_queues_
+      | queue_weights_
+      | cur_queue_
+      | served_in_turn_
       | suspended_
+      | timer_wheel_
 #if vt_check_enabled(fcontext)
       | thread_manager_
 #endif
+      | made_progress_
+      | last_activity_time_
+      | idle_block_sec_
       | has_executed_
       | is_idle
       | is_idle_minus_term
@@ -338,6 +546,8 @@ struct Scheduler : runtime::component::Component<Scheduler> {
       | last_progress_time_
       | progress_time_enabled_
       | processed_after_last_progress_
+      | progress_tune_enabled_
+      | progress_tuner_
       | last_threshold_memory_usage_
       | threshold_memory_usage_
       | last_memory_usage_poll_
@@ -347,7 +557,23 @@ struct Scheduler : runtime::component::Component<Scheduler> {
       | vtLiveTime
       | schedLoopTime
       | idleTime
-      | idleTimeMinusTerm;
+      | idleTimeMinusTerm
+      | timerCount
+      | deadlineMissCount
+      | idleBlockCount
+      | idleBlockTime
+      | time_units_
+      | queue_latency_enabled_
+      | latency_hist_enabled_
+      | handler_latency_
+      | reported_handlers_
+      | queueDepthGauge
+      | queueLatencyTime
+      | queueExecTime
+      | progressIntervalGauge
+      | progressTuneIncCount
+      | progressTuneDecCount
+      | progressTuneRevertCount;
   }
 
 private:
@@ -359,6 +585,46 @@ private:
    */
   void runWorkUnit(UnitType& work);
 
+  /**
+   * \internal \brief Push a unit on a scheduler queue
+   *
+   * \param[in] queue the scheduler queue
+   * \param[in] unit the unit to enqueue
+   */
+  void enqueueUnit(SchedQueue queue, UnitType&& unit);
+
+  /**
+   * \internal \brief Pop the next unit by weighted round-robin: the current
+   * queue is served up to its weight in a row, then the next non-empty queue
+   * gets a turn. At least one queue must be non-empty.
+   *
+   * \return the unit to run
+   */
+  UnitType popWorkUnit();
+
+  /**
+   * \internal \brief Feed a progress poll to the progress tuner and record
+   * its decisions in diagnostics
+   *
+   * \param[in] productive whether the poll made progress
+   * \param[in] elapsed seconds since the previous poll
+   */
+  void tuneProgress(bool productive, TimeType elapsed);
+
+  /**
+   * \internal \brief Expire due timers with a bounded amount of work
+   */
+  void pollTimers();
+
+  /**
+   * \internal \brief With \c --vt_sched_idle_block, block the idle scheduler
+   * once nothing has happened for \c --vt_sched_idle_spin_us. The block lasts
+   * until a thread wakes it or the timeout expires; the timeout doubles on
+   * each consecutive block up to \c --vt_sched_idle_block_us and is capped at
+   * a timer tick while timers are pending.
+   */
+  void maybeBlockIdle();
+
   /**
    * \internal \brief Make progress on active message only
    *
@@ -373,13 +639,47 @@ private:
    */
   bool progressImpl();
 
+  using HandlerLatencyMsgType =
+    collective::reduce::operators::ReduceTMsg<HandlerLatency>;
+
+  /**
+   * \internal \brief Collectively merge the per-handler latency sketches and
+   * register diagnostics for the most frequent handlers, with the remaining
+   * handlers combined into an "other" bucket
+   */
+  void reportHandlerLatency();
+
+  /**
+   * \internal \brief Receive the merged per-handler latency sketches
+   *
+   * \param[in] msg the merged sketches
+   */
+  static void handlerLatencyHandler(HandlerLatencyMsgType* msg);
+
+  /**
+   * \internal \brief Register and set the diagnostics for one handler's
+   * sketch on this node
+   *
+   * \param[in] label the handler label used in the diagnostic names
+   * \param[in] sketch this node's sketch for the handler
+   */
+  void reportLatencySketch(std::string const& label, LatencySketch& sketch);
+
 private:
 
-# if vt_check_enabled(priorities)
-  PriorityQueue<UnitType> work_queue_;
-# else
-  Queue<UnitType> work_queue_;
-# endif
+  std::array<QueueType, num_sched_queues> work_queues_;
+  // Units served in a row from each queue before moving to the next
+  std::array<int, num_sched_queues> queue_weights_ = {};
+  int cur_queue_ = static_cast<int>(SchedQueue::System);
+  int served_in_turn_ = 0;
+  // Whether units are stamped at enqueue, for queue latency diagnostics or
+  // latency histograms
+  bool time_units_ = false;
+  bool queue_latency_enabled_ = false;
+  bool latency_hist_enabled_ = false;
+  HandlerLatency handler_latency_;
+  // Handlers reported with their own diagnostics, agreed on by all nodes
+  std::vector<HandlerType> reported_handlers_;
 
 #if vt_check_enabled(fcontext)
   std::unique_ptr<ThreadManager> thread_manager_ = nullptr;
@@ -387,6 +687,14 @@ private:
 
   SuspendedUnits suspended_;
 
+  TimerWheel timer_wheel_;
+
+  IdleWaiter idle_waiter_;
+  // Whether the last scheduler iteration ran work or made progress
+  bool made_progress_ = false;
+  TimeType last_activity_time_ = 0.0;
+  TimeType idle_block_sec_ = 0.0;
+
   bool has_executed_      = false;
   bool is_idle            = true;
   bool is_idle_minus_term = true;
@@ -403,6 +711,10 @@ private:
   TimeType last_progress_time_ = 0.0;
   bool progress_time_enabled_ = false;
   int32_t processed_after_last_progress_ = 0;
+  // With --vt_sched_progress_tune, the tuner supplies the handler interval
+  // between progress calls in place of --vt_sched_progress_han
+  bool progress_tune_enabled_ = false;
+  ProgressTuner progress_tuner_;
 
   std::size_t last_threshold_memory_usage_ = 0;
   std::size_t threshold_memory_usage_ = 0;
@@ -423,6 +735,17 @@ private:
   diagnostic::Timer schedLoopTime;
   diagnostic::Timer idleTime;
   diagnostic::Timer idleTimeMinusTerm;
+  diagnostic::Counter timerCount;
+  diagnostic::Counter deadlineMissCount;
+  diagnostic::Counter idleBlockCount;
+  diagnostic::Timer idleBlockTime;
+  std::array<diagnostic::Gauge, num_sched_queues> queueDepthGauge;
+  std::array<diagnostic::Timer, num_sched_queues> queueLatencyTime;
+  std::array<diagnostic::Timer, num_sched_queues> queueExecTime;
+  diagnostic::Gauge progressIntervalGauge;
+  diagnostic::Counter progressTuneIncCount;
+  diagnostic::Counter progressTuneDecCount;
+  diagnostic::Counter progressTuneRevertCount;
 };
 
 }} //end namespace vt::sched
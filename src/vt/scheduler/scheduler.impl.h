@@ -47,6 +47,10 @@
 #include "vt/config.h"
 #include "vt/messaging/active.h"
 #include "vt/termination/termination.h"
+#include "vt/scheduler/base_unit.h"
+
+#include <algorithm>
+#include <memory>
 
 namespace vt {
 
@@ -95,12 +99,21 @@ void Scheduler::enqueue(MsgT* msg, RunT r) {
     num_term_msgs_++;
   }
 
+  // Termination messages are always runtime control
+  auto const queue =
+    is_term ? SchedQueue::System : envelopeGetSchedQueue(msg->env);
+
 # if vt_check_enabled(priorities)
   auto priority = envelopeGetPriority(msg->env);
-  work_queue_.emplace(UnitType(is_term, std::move(r), priority));
+  UnitType unit(is_term, std::move(r), priority);
 # else
-  work_queue_.emplace(UnitType(is_term, std::move(r)));
+  UnitType unit(is_term, std::move(r));
 # endif
+
+  if (latency_hist_enabled_) {
+    unit.setHandler(envelopeGetHandler(msg->env));
+  }
+  enqueueUnit(queue, std::move(unit));
 }
 
 template <typename MsgT, typename RunT>
@@ -116,24 +129,133 @@ void Scheduler::enqueue(MsgSharedPtr<MsgT> msg, RunT r) {
 
 template <typename RunT>
 void Scheduler::enqueue(RunT r) {
+  enqueue(SchedQueue::User, std::move(r));
+}
+
+template <typename RunT>
+void Scheduler::enqueue(PriorityType priority, RunT r) {
   bool const is_term = false;
 # if vt_check_enabled(priorities)
-  work_queue_.emplace(UnitType(is_term, std::move(r), default_priority));
+  enqueueUnit(SchedQueue::User, UnitType(is_term, std::move(r), priority));
 # else
-  work_queue_.emplace(UnitType(is_term, std::move(r)));
+  enqueueUnit(SchedQueue::User, UnitType(is_term, std::move(r)));
 # endif
 }
 
 template <typename RunT>
-void Scheduler::enqueue(PriorityType priority, RunT r) {
+void Scheduler::enqueue(SchedQueue queue, RunT r) {
   bool const is_term = false;
 # if vt_check_enabled(priorities)
-  work_queue_.emplace(UnitType(is_term, std::move(r), priority));
+  enqueueUnit(queue, UnitType(is_term, std::move(r), default_priority));
 # else
-  work_queue_.emplace(UnitType(is_term, std::move(r)));
+  enqueueUnit(queue, UnitType(is_term, std::move(r)));
 # endif
 }
 
+template <typename RunT>
+TimerIDType Scheduler::enqueueAfter(TimeType delay, RunT r) {
+  return enqueueAfter(delay, default_priority, std::move(r));
+}
+
+template <typename RunT>
+TimerIDType Scheduler::enqueueAfter(
+  TimeType delay, PriorityType priority, RunT r
+) {
+  // Keep the enclosing epoch alive while the unit waits on the timer
+  auto const epoch = theMsg()->getEpoch();
+  theTerm()->produce(epoch);
+
+  // Runnables are move-only; share them with the timer's action
+  auto holder = std::make_shared<RunT>(std::move(r));
+  return addTimer(
+    delay,
+    [this, epoch, priority, holder]{
+      enqueue(priority, std::move(*holder));
+      theTerm()->consume(epoch);
+    },
+    [epoch]{ theTerm()->consume(epoch); }
+  );
+}
+
+template <typename MsgT, typename RunT>
+TimerIDType Scheduler::enqueueAfter(
+  TimeType delay, MsgSharedPtr<MsgT> msg, RunT r
+) {
+  auto const epoch = theMsg()->getEpochContextMsg(msg);
+  theTerm()->produce(epoch);
+
+  auto holder = std::make_shared<RunT>(std::move(r));
+  return addTimer(
+    delay,
+    [this, epoch, msg, holder]{
+      enqueue(msg, std::move(*holder));
+      theTerm()->consume(epoch);
+    },
+    [epoch]{ theTerm()->consume(epoch); }
+  );
+}
+
+namespace detail {
+
+/**
+ * \internal \struct DeadlineState
+ *
+ * \brief Shared between the two queued copies of a deadline unit so that only
+ * the first one reached runs the work.
+ */
+template <typename RunT>
+struct DeadlineState {
+  DeadlineState(RunT in_r, TimeType in_deadline)
+    : r_(std::move(in_r)),
+      deadline_(in_deadline)
+  { }
+
+  RunT r_;
+  TimeType deadline_ = 0.;
+  TimerIDType bump_ = no_timer;
+  bool done_ = false;
+};
+
+} /* end namespace detail */
+
+template <typename MsgT, typename RunT>
+void Scheduler::enqueueDeadline(
+  MsgSharedPtr<MsgT> msg, TimeType time_to_deadline, TimeType lead, RunT r
+) {
+  auto const now = timing::getCurrentTime();
+  auto state = std::make_shared<detail::DeadlineState<RunT>>(
+    std::move(r), now + time_to_deadline
+  );
+
+  ActionType run = [this, state]{
+    if (state->done_) {
+      return;
+    }
+    state->done_ = true;
+    cancelTimer(state->bump_);
+    if (timing::getCurrentTime() > state->deadline_) {
+      deadlineMissCount.increment(1);
+    }
+    BaseUnit{std::move(state->r_), false}.execute();
+  };
+
+  // Bump onto the system queue, which is served ahead of user work whether or
+  // not priorities are compiled in
+  auto const bump_delay = std::max(0., time_to_deadline - lead);
+  state->bump_ = addTimer(bump_delay, [this, state, run]{
+    if (not state->done_) {
+      bool const is_term = false;
+#     if vt_check_enabled(priorities)
+      enqueueUnit(SchedQueue::System, UnitType(is_term, run, max_priority));
+#     else
+      enqueueUnit(SchedQueue::System, UnitType(is_term, run));
+#     endif
+    }
+  });
+
+  enqueue(msg, run);
+}
+
 }} /* end namespace vt::sched */
 
 #endif /*INCLUDED_VT_SCHEDULER_SCHEDULER_IMPL_H*/
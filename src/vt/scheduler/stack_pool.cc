@@ -0,0 +1,182 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                stack_pool.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/scheduler/stack_pool.h"
+
+#if vt_check_enabled(fcontext)
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <initializer_list>
+
+#if !defined(MAP_NORESERVE)
+# define MAP_NORESERVE 0
+#endif
+
+#if !defined(MAP_ANONYMOUS)
+# define MAP_ANONYMOUS MAP_ANON
+#endif
+
+namespace vt { namespace sched {
+
+StackPool::StackPool(
+  std::size_t in_max_cached_per_class, std::size_t in_num_hot_per_class
+) : page_size_(static_cast<std::size_t>(sysconf(_SC_PAGESIZE))),
+    max_cached_per_class_(in_max_cached_per_class),
+    num_hot_per_class_(in_num_hot_per_class)
+{ }
+
+StackPool::~StackPool() {
+  clear();
+}
+
+std::size_t StackPool::sizeClass(std::size_t size) const {
+  std::size_t cls = 0;
+  std::size_t cls_size = min_stack_size;
+  while (cls_size < size and cls < num_classes - 1) {
+    cls_size <<= 1;
+    cls++;
+  }
+  return cls;
+}
+
+fcontext_stack_t StackPool::allocate(std::size_t size) {
+  auto const cls = sizeClass(size);
+  auto const cls_size = min_stack_size << cls;
+
+  // Sizes past the largest class are mapped exactly and never cached
+  if (cls_size < size) {
+    auto const rounded = ((size + page_size_ - 1) / page_size_) * page_size_;
+    num_mapped_++;
+    return mapStack(rounded);
+  }
+
+  // Prefer a fully committed stack; fall back to a decommitted one
+  for (auto list : {&hot_[cls], &cold_[cls]}) {
+    if (not list->empty()) {
+      auto stack = list->back();
+      list->pop_back();
+      num_reused_++;
+      return stack;
+    }
+  }
+
+  num_mapped_++;
+  return mapStack(cls_size);
+}
+
+void StackPool::release(fcontext_stack_t stack) {
+  if (stack.sptr == nullptr) {
+    return;
+  }
+
+  auto const cls = sizeClass(stack.ssize);
+  auto& hot = hot_[cls];
+  auto& cold = cold_[cls];
+  if ((min_stack_size << cls) != stack.ssize or
+      hot.size() + cold.size() >= max_cached_per_class_) {
+    unmapStack(stack);
+    return;
+  }
+
+  if (hot.size() < num_hot_per_class_) {
+    hot.push_back(stack);
+  } else {
+    decommit(stack);
+    cold.push_back(stack);
+  }
+}
+
+void StackPool::clear() {
+  for (auto lists : {&hot_, &cold_}) {
+    for (auto&& list : *lists) {
+      for (auto&& stack : list) {
+        unmapStack(stack);
+      }
+      list.clear();
+    }
+  }
+}
+
+std::size_t StackPool::numCached() const {
+  std::size_t num = 0;
+  for (std::size_t cls = 0; cls < num_classes; cls++) {
+    num += hot_[cls].size() + cold_[cls].size();
+  }
+  return num;
+}
+
+fcontext_stack_t StackPool::mapStack(std::size_t size) const {
+  auto const total = size + page_size_;
+  void* const mem = mmap(
+    nullptr, total, PROT_NONE,
+    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0
+  );
+  vtAbortIf(mem == MAP_FAILED, "Failed to map user-level thread stack");
+
+  // The lowest page stays PROT_NONE as a guard against stack overflow
+  auto const usable = static_cast<char*>(mem) + page_size_;
+  auto const ret = mprotect(usable, size, PROT_READ | PROT_WRITE);
+  vtAbortIf(ret != 0, "Failed to protect user-level thread stack");
+
+  return fcontext_stack_t{usable + size, size};
+}
+
+void StackPool::unmapStack(fcontext_stack_t stack) const {
+  auto const base = static_cast<char*>(stack.sptr) - stack.ssize - page_size_;
+  munmap(base, stack.ssize + page_size_);
+}
+
+void StackPool::decommit(fcontext_stack_t stack) const {
+  if (stack.ssize <= hot_bytes) {
+    return;
+  }
+  auto const cold = stack.ssize - hot_bytes;
+  auto const low = static_cast<char*>(stack.sptr) - stack.ssize;
+  madvise(low, cold, MADV_DONTNEED);
+}
+
+}} /* end namespace vt::sched */
+
+#endif /*vt_check_enabled(fcontext)*/
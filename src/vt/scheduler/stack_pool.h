@@ -0,0 +1,185 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 stack_pool.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_STACK_POOL_H
+#define INCLUDED_VT_SCHEDULER_STACK_POOL_H
+
+#include "vt/config.h"
+
+#if vt_check_enabled(fcontext)
+
+#include <context/fcontext.h>
+
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+namespace vt { namespace sched {
+
+/**
+ * \struct StackPool
+ *
+ * \brief Caches user-level thread stacks by size class so that creating and
+ * destroying a \c ThreadAction does not pay for an \c mmap / \c munmap pair
+ * each time.
+ *
+ * Each stack is a private anonymous mapping: a \c PROT_NONE guard page at the
+ * low end (stacks grow down) followed by the usable region. Memory is reserved
+ * with \c MAP_NORESERVE so physical pages are only committed when the thread
+ * actually touches them. Requests are rounded up to a power-of-two number of
+ * pages, which is the size class. When a stack is released it is kept on one
+ * of its class's two free lists, up to \c max_cached_per_class stacks in
+ * total. The hot list holds up to \c num_hot_per_class fully committed stacks;
+ * past that, the deep part of a stack is decommitted with \c madvise and it
+ * goes on the cold list so an idle pool does not pin memory. \c allocate
+ * always prefers a hot stack, so cold stacks (which fault their pages back in)
+ * are only handed out when no hot one is left.
+ *
+ * \note Not thread-safe: owned and used by the \c ThreadManager on the comm
+ * thread.
+ */
+struct StackPool {
+  /// Smallest usable stack size handed out (bytes)
+  static constexpr std::size_t const min_stack_size = 16384;
+  /// Bytes at the top of a cached stack that are never decommitted
+  static constexpr std::size_t const hot_bytes = 65536;
+  /// Number of size classes (class \c i is \c min_stack_size << i)
+  static constexpr std::size_t const num_classes = 16;
+
+  /**
+   * \brief Construct a pool
+   *
+   * \param[in] in_max_cached_per_class max free stacks retained per class
+   * \param[in] in_num_hot_per_class cached stacks per class kept fully
+   * committed
+   */
+  explicit StackPool(
+    std::size_t in_max_cached_per_class = 64,
+    std::size_t in_num_hot_per_class = 8
+  );
+
+  StackPool(StackPool const&) = delete;
+  StackPool& operator=(StackPool const&) = delete;
+
+  ~StackPool();
+
+  /**
+   * \brief Get a stack with at least \c size usable bytes
+   *
+   * \param[in] size the requested usable size
+   *
+   * \return the stack (\c sptr is the high end of the usable region)
+   */
+  fcontext_stack_t allocate(std::size_t size);
+
+  /**
+   * \brief Return a stack obtained from \c allocate to the pool
+   *
+   * \param[in] stack the stack
+   */
+  void release(fcontext_stack_t stack);
+
+  /**
+   * \brief Unmap all cached stacks
+   */
+  void clear();
+
+  /**
+   * \brief Get the number of stacks currently cached (not in use)
+   *
+   * \return number of cached stacks
+   */
+  std::size_t numCached() const;
+
+  /// Number of \c allocate calls satisfied from the cache
+  std::size_t getNumReused() const { return num_reused_; }
+  /// Number of \c allocate calls that had to map a new stack
+  std::size_t getNumMapped() const { return num_mapped_; }
+
+private:
+  /**
+   * \internal \brief Get the size class for a usable size
+   *
+   * \param[in] size the usable size
+   *
+   * \return the size class
+   */
+  std::size_t sizeClass(std::size_t size) const;
+
+  /**
+   * \internal \brief Map a new stack with a guard page
+   *
+   * \param[in] size the usable size (multiple of the page size)
+   *
+   * \return the stack
+   */
+  fcontext_stack_t mapStack(std::size_t size) const;
+
+  /**
+   * \internal \brief Unmap a stack including its guard page
+   *
+   * \param[in] stack the stack
+   */
+  void unmapStack(fcontext_stack_t stack) const;
+
+  /**
+   * \internal \brief Release the physical pages below the hot region
+   *
+   * \param[in] stack the stack
+   */
+  void decommit(fcontext_stack_t stack) const;
+
+private:
+  std::size_t page_size_ = 0;
+  std::size_t max_cached_per_class_ = 0;
+  std::size_t num_hot_per_class_ = 0;
+  std::array<std::vector<fcontext_stack_t>, num_classes> hot_ = {};
+  std::array<std::vector<fcontext_stack_t>, num_classes> cold_ = {};
+  std::size_t num_reused_ = 0;
+  std::size_t num_mapped_ = 0;
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*vt_check_enabled(fcontext)*/
+#endif /*INCLUDED_VT_SCHEDULER_STACK_POOL_H*/
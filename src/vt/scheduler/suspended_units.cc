@@ -62,6 +62,16 @@ void SuspendedUnits::addSuspended(
 }
 
 void SuspendedUnits::resumeRunnable(ThreadIDType tid) {
+  if (isSuspendedActionID(tid)) {
+    auto iter = actions_.find(tid);
+    vtAbortIf(iter == actions_.end(), "Must have valid action ID to resume");
+    auto a = std::move(iter->second.action_);
+    auto p = iter->second.priority_;
+    actions_.erase(iter);
+    theSched()->enqueue(p, std::move(a));
+    return;
+  }
+
   auto iter = units_.find(tid);
   vtAbortIf(iter == units_.end(), "Must have valid thread ID to resume");
   auto r = std::move(iter->second.runnable_);
@@ -70,4 +80,16 @@ void SuspendedUnits::resumeRunnable(ThreadIDType tid) {
   units_.erase(iter);
 }
 
+ThreadIDType SuspendedUnits::addSuspendedAction(
+  ActionType action, PriorityType p
+) {
+  auto const id = suspended_action_bit | next_action_id_++;
+  actions_.emplace(
+    std::piecewise_construct,
+    std::forward_as_tuple(id),
+    std::forward_as_tuple(std::move(action), p)
+  );
+  return id;
+}
+
 }} /* end namespace vt::sched */
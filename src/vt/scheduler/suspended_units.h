@@ -79,6 +79,28 @@ struct SuspendedRunnable {
   PriorityType priority_ = default_priority;   /**< the resumption priority */
 };
 
+/**
+ * \internal \struct SuspendedAction
+ *
+ * \brief A suspended unit without a runnable (e.g., a coroutine) that is
+ * resumed by enqueuing an action
+ */
+struct SuspendedAction {
+  /**
+   * \brief Construct a new suspended action
+   *
+   * \param[in] in_action the action that resumes the unit
+   * \param[in] in_priority the priority to resume with
+   */
+  SuspendedAction(ActionType in_action, PriorityType in_priority)
+    : action_(std::move(in_action)),
+      priority_(in_priority)
+  { }
+
+  ActionType action_ = nullptr;                /**< the resume action */
+  PriorityType priority_ = default_priority;   /**< the resumption priority */
+};
+
 } /* end detail namespace */
 
 /**
@@ -112,14 +134,45 @@ struct SuspendedUnits {
    */
   void resumeRunnable(ThreadIDType tid);
 
+  /**
+   * \brief Add a suspended unit that is resumed by enqueuing an action, such
+   * as a stackless coroutine
+   *
+   * \param[in] action the action that resumes the unit
+   * \param[in] p the priority to resume with (optional)
+   *
+   * \return the ID to pass to \c resumeRunnable
+   */
+  ThreadIDType addSuspendedAction(
+    ActionType action, PriorityType p = default_priority
+  );
+
+  /**
+   * \brief Check whether an ID was handed out by \c addSuspendedAction
+   *
+   * \param[in] tid the ID
+   *
+   * \return whether it identifies a suspended action
+   */
+  static bool isSuspendedActionID(ThreadIDType tid) {
+    return (tid & suspended_action_bit) != 0;
+  }
+
   template <typename SerializerT>
   void serializer(SerializerT& s) {
     s | units_;
   }
 
 private:
+  /// Tag bit that keeps action IDs disjoint from user-level thread IDs
+  static constexpr ThreadIDType const suspended_action_bit = 1ull << 63;
+
   /// A list of suspended runnables that are held here until released to resume
   std::unordered_map<ThreadIDType, detail::SuspendedRunnable> units_;
+  /// Suspended actions that are held here until released to resume
+  std::unordered_map<ThreadIDType, detail::SuspendedAction> actions_;
+  /// The next ID for a suspended action
+  ThreadIDType next_action_id_ = 1;
 };
 
 }} /* end namespace vt::sched */
@@ -42,6 +42,7 @@
 */
 
 #include "vt/scheduler/thread_action.h"
+#include "vt/scheduler/stack_pool.h"
 #include "vt/messaging/active.h"
 #include "vt/configs/arguments/app_config.h"
 
@@ -64,8 +65,25 @@ ThreadAction::ThreadAction(
     )
 { }
 
+ThreadAction::ThreadAction(
+  StackPool* in_pool, ThreadIDType in_tid, ActionType in_action,
+  std::size_t stack_size
+) : pool_(in_pool),
+    tid_(in_tid),
+    action_(in_action),
+    stack_(
+      in_pool->allocate(
+        stack_size == 0 ? theConfig()->vt_ult_stack_size : stack_size
+      )
+    )
+{ }
+
 ThreadAction::~ThreadAction() {
-  destroy_fcontext_stack(stack_);
+  if (pool_ != nullptr) {
+    pool_->release(stack_);
+  } else {
+    destroy_fcontext_stack(stack_);
+  }
 }
 
 /*static*/ ThreadAction* ThreadAction::cur_running_ = nullptr;
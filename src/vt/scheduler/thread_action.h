@@ -52,6 +52,8 @@
 
 namespace vt { namespace sched {
 
+struct StackPool;
+
 /**
  * \struct ThreadAction
  *
@@ -78,9 +80,23 @@ struct ThreadAction final {
     ThreadIDType in_tid, ActionType in_action, std::size_t stack_size = 0
   );
 
-  ThreadAction(ThreadAction&&) = default;
+  /**
+   * \brief Construct a \c ThreadAction with a stack drawn from a pool
+   *
+   * \param[in] in_pool the pool that owns the stack
+   * \param[in] in_id the thread id
+   * \param[in] in_action the action to run
+   * \param[in] stack_size the size of the stack
+   */
+  ThreadAction(
+    StackPool* in_pool, ThreadIDType in_tid, ActionType in_action,
+    std::size_t stack_size = 0
+  );
+
+  // The fcontext holds a pointer to this object once it runs, so it is pinned
+  ThreadAction(ThreadAction&&) = delete;
   ThreadAction(ThreadAction const&) = delete;
-  ThreadAction& operator=(ThreadAction&&) = default;
+  ThreadAction& operator=(ThreadAction&&) = delete;
   ThreadAction& operator=(ThreadAction const&) = delete;
 
   ~ThreadAction();
@@ -147,6 +163,7 @@ private:
 private:
   static ThreadAction* cur_running_; /**< The current running \c ThreadAction */
 
+  StackPool* pool_ = nullptr;               /**< pool owning the stack */
   ThreadIDType tid_ = no_thread_id;         /**< the thread ID */
   ActionType action_ = nullptr;             /**< the action to run  */
   fcontext_stack_t stack_;                  /**< the fcontext stack */
@@ -45,25 +45,74 @@
 
 #if vt_check_enabled(fcontext)
 
+#include "vt/configs/arguments/app_config.h"
+
 #include <memory>
 
 namespace vt { namespace sched {
 
-void ThreadManager::deallocateThread(ThreadIDType tid) {
-  auto iter = threads_.find(tid);
-  if (iter != threads_.end()) {
-    vtAssertExpr(iter->second->isDone());
-    threads_.erase(iter);
+ThreadManager::ThreadManager()
+  : stack_pool_(
+      theConfig()->vt_ult_stack_pool_max, theConfig()->vt_ult_stack_pool_hot
+    )
+{ }
+
+ThreadManager::~ThreadManager() {
+  for (auto&& chunk : chunks_) {
+    for (std::size_t i = 0; i < slots_per_chunk; i++) {
+      if (chunk[i].live_) {
+        chunk[i].get()->~ThreadAction();
+        chunk[i].live_ = false;
+      }
+    }
   }
 }
 
-ThreadAction* ThreadManager::getThread(ThreadIDType tid) {
-  auto iter = threads_.find(tid);
-  if (iter == threads_.end()) {
+uint32_t ThreadManager::acquireSlot() {
+  if (free_slots_.empty()) {
+    auto const base = static_cast<uint32_t>(chunks_.size() * slots_per_chunk);
+    chunks_.emplace_back(std::make_unique<Slot[]>(slots_per_chunk));
+    // Push in reverse so the lowest index is handed out first
+    for (std::size_t i = slots_per_chunk; i > 0; i--) {
+      free_slots_.push_back(base + static_cast<uint32_t>(i - 1));
+    }
+  }
+  auto const idx = free_slots_.back();
+  free_slots_.pop_back();
+  return idx;
+}
+
+ThreadManager::Slot* ThreadManager::findSlot(ThreadIDType tid) {
+  if (tid == no_thread_id) {
+    return nullptr;
+  }
+  auto const idx = static_cast<uint32_t>(tid & 0xFFFFFFFFull) - 1;
+  if (idx >= chunks_.size() * slots_per_chunk) {
     return nullptr;
-  } else {
-    return iter->second.get();
   }
+  auto& s = slot(idx);
+  if (not s.live_ or s.tid_ != tid) {
+    return nullptr;
+  }
+  return &s;
+}
+
+void ThreadManager::deallocateThread(ThreadIDType tid) {
+  auto s = findSlot(tid);
+  if (s != nullptr) {
+    vtAssertExpr(s->get()->isDone());
+    s->get()->~ThreadAction();
+    s->live_ = false;
+    s->tid_ = no_thread_id;
+    s->generation_++;
+    num_live_--;
+    free_slots_.push_back(static_cast<uint32_t>((tid & 0xFFFFFFFFull) - 1));
+  }
+}
+
+ThreadAction* ThreadManager::getThread(ThreadIDType tid) {
+  auto s = findSlot(tid);
+  return s == nullptr ? nullptr : s->get();
 }
 
 }} /* end namespace vt::sched */
@@ -49,9 +49,11 @@
 #if vt_check_enabled(fcontext)
 
 #include "vt/scheduler/thread_action.h"
+#include "vt/scheduler/stack_pool.h"
 
 #include <memory>
-#include <unordered_map>
+#include <type_traits>
+#include <vector>
 
 namespace vt { namespace sched {
 
@@ -61,9 +63,22 @@ namespace vt { namespace sched {
  * \brief Manages/holds allocated user-level threads until deallocation along
  * with the associated \c ThreadAction which contains their stack and other
  * configuration.
+ *
+ * \c ThreadAction objects are placed in a slab of fixed-size chunks and reuse
+ * freed slots, so allocation does not hit the heap in steady state. A thread ID
+ * encodes its slot (low 32 bits) and the slot generation (high 32 bits) so
+ * lookup is a direct index and a stale ID is never resolved to a new thread.
+ * Stacks come from a \c StackPool.
  */
 struct ThreadManager {
 
+  ThreadManager();
+
+  ThreadManager(ThreadManager const&) = delete;
+  ThreadManager& operator=(ThreadManager const&) = delete;
+
+  ~ThreadManager();
+
   /**
    * \brief Allocate a new thread
    *
@@ -100,11 +115,76 @@ struct ThreadManager {
    */
   ThreadAction* getThread(ThreadIDType tid);
 
+  /**
+   * \brief Get the number of live threads
+   *
+   * \return number of live threads
+   */
+  std::size_t numLiveThreads() const { return num_live_; }
+
+  /**
+   * \brief Get the pool that provides thread stacks
+   *
+   * \return the stack pool
+   */
+  StackPool* getStackPool() { return &stack_pool_; }
+
+private:
+  /// Number of slots in each slab chunk
+  static constexpr std::size_t const slots_per_chunk = 256;
+
+  /// A slab slot holding storage for one \c ThreadAction
+  struct Slot {
+    typename std::aligned_storage<
+      sizeof(ThreadAction), alignof(ThreadAction)
+    >::type storage_;
+    ThreadIDType tid_ = no_thread_id;
+    uint32_t generation_ = 0;
+    bool live_ = false;
+
+    ThreadAction* get() {
+      return reinterpret_cast<ThreadAction*>(&storage_);
+    }
+  };
+
+  using ChunkType = std::unique_ptr<Slot[]>;
+
+  /**
+   * \internal \brief Take a free slot, growing the slab if necessary
+   *
+   * \return the slot index
+   */
+  uint32_t acquireSlot();
+
+  /**
+   * \internal \brief Get the slot for an index
+   *
+   * \param[in] idx the slot index
+   *
+   * \return the slot
+   */
+  Slot& slot(uint32_t idx) {
+    return chunks_[idx / slots_per_chunk][idx % slots_per_chunk];
+  }
+
+  /**
+   * \internal \brief Find the live slot for a thread ID
+   *
+   * \param[in] tid the thread ID
+   *
+   * \return the slot or \c nullptr if the thread is not live
+   */
+  Slot* findSlot(ThreadIDType tid);
+
 private:
-  /// The next thread ID for allocation (start at 1 because no_thread_id=0)
-  ThreadIDType next_thread_id_ = 1;
-  /// Holder for live threads contained in \c ThreadAction
-  std::unordered_map<ThreadIDType, std::unique_ptr<ThreadAction>> threads_;
+  /// Chunks of slots; chunks are never moved so slot pointers stay valid
+  std::vector<ChunkType> chunks_;
+  /// Indices of free slots
+  std::vector<uint32_t> free_slots_;
+  /// Number of live threads
+  std::size_t num_live_ = 0;
+  /// Cached thread stacks
+  StackPool stack_pool_;
 };
 
 }} /* end namespace vt::sched */
@@ -46,18 +46,24 @@
 
 #include "vt/scheduler/thread_manager.h"
 
+#include <new>
+
 namespace vt { namespace sched {
 
 template <typename... Args>
 ThreadIDType ThreadManager::allocateThread(Args&&... args) {
-  auto const tid = next_thread_id_++;
-  threads_.emplace(
-    std::piecewise_construct,
-    std::forward_as_tuple(tid),
-    std::forward_as_tuple(
-      std::make_unique<ThreadAction>(tid, std::forward<Args>(args)...)
-    )
+  auto const idx = acquireSlot();
+  auto& s = slot(idx);
+  // Slot index is offset by one so that no thread ID is ever no_thread_id
+  auto const tid =
+    (static_cast<ThreadIDType>(s.generation_) << 32) |
+    static_cast<ThreadIDType>(idx + 1);
+  new (&s.storage_) ThreadAction(
+    &stack_pool_, tid, std::forward<Args>(args)...
   );
+  s.tid_ = tid;
+  s.live_ = true;
+  num_live_++;
   return tid;
 }
 
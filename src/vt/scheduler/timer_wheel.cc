@@ -0,0 +1,288 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                timer_wheel.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/scheduler/timer_wheel.h"
+
+#include <cmath>
+
+namespace vt { namespace sched {
+
+/*static*/ constexpr int const TimerWheel::level_bits;
+/*static*/ constexpr int const TimerWheel::slots_per_level;
+/*static*/ constexpr int const TimerWheel::num_levels;
+/*static*/ constexpr TimerWheel::IndexType const TimerWheel::no_index;
+/*static*/ constexpr int const TimerWheel::overflow_list;
+
+TimerWheel::TimerWheel(TimeType in_tick, TimeType in_origin)
+  : tick_(in_tick),
+    origin_(in_origin)
+{
+  vtAssert(tick_ > 0., "Timer wheel tick must be positive");
+  heads_.fill(no_index);
+  level_count_.fill(0);
+}
+
+uint64_t TimerWheel::toTick(TimeType time) const {
+  if (time <= origin_) {
+    return 0;
+  }
+  return static_cast<uint64_t>((time - origin_) / tick_);
+}
+
+TimerIDType TimerWheel::schedule(
+  TimeType deadline, ActionType action, ActionType on_cancel
+) {
+  auto const idx = allocate();
+  auto& entry = entries_[idx];
+
+  uint64_t expiry = 0;
+  if (deadline > origin_) {
+    expiry = static_cast<uint64_t>(std::ceil((deadline - origin_) / tick_));
+  }
+  // Anything already due fires on the next tick
+  if (expiry <= current_tick_) {
+    expiry = current_tick_ + 1;
+  }
+
+  entry.action_ = std::move(action);
+  entry.on_cancel_ = std::move(on_cancel);
+  entry.expiry_ = expiry;
+  place(idx);
+  size_++;
+
+  return (static_cast<TimerIDType>(entry.generation_) << 32) |
+    static_cast<TimerIDType>(idx + 1);
+}
+
+bool TimerWheel::cancel(TimerIDType id) {
+  if (id == no_timer) {
+    return false;
+  }
+
+  auto const idx = static_cast<IndexType>((id & 0xFFFFFFFFull) - 1);
+  auto const generation = static_cast<uint32_t>(id >> 32);
+  if (idx < 0 or static_cast<std::size_t>(idx) >= entries_.size()) {
+    return false;
+  }
+
+  auto& entry = entries_[idx];
+  if (entry.generation_ != generation or entry.list_ == no_index) {
+    return false;
+  }
+
+  auto on_cancel = std::move(entry.on_cancel_);
+  unlink(idx);
+  release(idx);
+  size_--;
+
+  if (on_cancel) {
+    on_cancel();
+  }
+  return true;
+}
+
+int TimerWheel::advance(TimeType now, int max_ticks) {
+  auto const now_tick = toTick(now);
+  auto const slot_mask = static_cast<uint64_t>(slots_per_level - 1);
+
+  int fired = 0;
+  int ticks = 0;
+  while (current_tick_ < now_tick and ticks < max_ticks) {
+    if (size_ == 0) {
+      current_tick_ = now_tick;
+      break;
+    }
+
+    // Nothing below the lowest occupied level can expire or cascade before
+    // that level's next boundary, so jump straight there
+    int lowest = 0;
+    while (lowest < num_levels and level_count_[lowest] == 0) {
+      lowest++;
+    }
+
+    uint64_t next = 0;
+    if (lowest == 0) {
+      // Level 0 only holds timers in the current block after the current slot
+      auto const block = current_tick_ & ~slot_mask;
+      next = block + slots_per_level;
+      auto const num_slots = static_cast<uint64_t>(slots_per_level);
+      for (auto s = (current_tick_ & slot_mask) + 1; s < num_slots; s++) {
+        if (heads_[s] != no_index) {
+          next = block + s;
+          break;
+        }
+      }
+    } else {
+      auto const shift = level_bits * lowest;
+      next = ((current_tick_ >> shift) + 1) << shift;
+    }
+
+    if (next > now_tick) {
+      current_tick_ = now_tick;
+      break;
+    }
+
+    fired += processTick(next);
+    ticks++;
+  }
+
+  return fired;
+}
+
+int TimerWheel::processTick(uint64_t tick) {
+  current_tick_ = tick;
+
+  auto const slot_mask = static_cast<uint64_t>(slots_per_level - 1);
+  auto const top_shift = level_bits * num_levels;
+
+  if ((tick & ((uint64_t{1} << top_shift) - 1)) == 0) {
+    cascade(overflow_list);
+  }
+
+  // Cascade from the top so timers can fall through several levels at once
+  for (int level = num_levels - 1; level >= 1; level--) {
+    auto const shift = level_bits * level;
+    if ((tick & ((uint64_t{1} << shift) - 1)) == 0) {
+      auto const slot = static_cast<int>((tick >> shift) & slot_mask);
+      cascade(level * slots_per_level + slot);
+    }
+  }
+
+  // Every timer in this level-0 slot expires on this tick
+  int fired = 0;
+  auto const list = static_cast<int>(tick & slot_mask);
+  while (heads_[list] != no_index) {
+    auto const idx = heads_[list];
+    auto action = std::move(entries_[idx].action_);
+    unlink(idx);
+    release(idx);
+    size_--;
+
+    // The action may schedule or cancel timers
+    if (action) {
+      action();
+    }
+    fired++;
+  }
+  return fired;
+}
+
+void TimerWheel::cascade(int list) {
+  std::vector<IndexType> moving;
+  for (auto idx = heads_[list]; idx != no_index; idx = entries_[idx].next_) {
+    moving.push_back(idx);
+  }
+  for (auto&& idx : moving) {
+    unlink(idx);
+    place(idx);
+  }
+}
+
+int TimerWheel::levelOf(int list) const {
+  return list == overflow_list ? num_levels : list / slots_per_level;
+}
+
+void TimerWheel::place(IndexType idx) {
+  auto& entry = entries_[idx];
+  auto const diff = entry.expiry_ ^ current_tick_;
+
+  int level = 0;
+  while (level < num_levels and (diff >> (level_bits * (level + 1))) != 0) {
+    level++;
+  }
+
+  int list = overflow_list;
+  if (level < num_levels) {
+    auto const shift = level_bits * level;
+    auto const slot = static_cast<int>(
+      (entry.expiry_ >> shift) & static_cast<uint64_t>(slots_per_level - 1)
+    );
+    list = level * slots_per_level + slot;
+  }
+
+  entry.list_ = list;
+  entry.prev_ = no_index;
+  entry.next_ = heads_[list];
+  if (heads_[list] != no_index) {
+    entries_[heads_[list]].prev_ = idx;
+  }
+  heads_[list] = idx;
+  level_count_[levelOf(list)]++;
+}
+
+void TimerWheel::unlink(IndexType idx) {
+  auto& entry = entries_[idx];
+  if (entry.prev_ != no_index) {
+    entries_[entry.prev_].next_ = entry.next_;
+  } else {
+    heads_[entry.list_] = entry.next_;
+  }
+  if (entry.next_ != no_index) {
+    entries_[entry.next_].prev_ = entry.prev_;
+  }
+  level_count_[levelOf(entry.list_)]--;
+  entry.prev_ = no_index;
+  entry.next_ = no_index;
+  entry.list_ = no_index;
+}
+
+TimerWheel::IndexType TimerWheel::allocate() {
+  if (not free_.empty()) {
+    auto const idx = free_.back();
+    free_.pop_back();
+    return idx;
+  }
+  entries_.emplace_back();
+  return static_cast<IndexType>(entries_.size() - 1);
+}
+
+void TimerWheel::release(IndexType idx) {
+  auto& entry = entries_[idx];
+  entry.action_ = nullptr;
+  entry.on_cancel_ = nullptr;
+  entry.generation_++;
+  free_.push_back(idx);
+}
+
+}} /* end namespace vt::sched */
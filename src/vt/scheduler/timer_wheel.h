@@ -0,0 +1,210 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                timer_wheel.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_SCHEDULER_TIMER_WHEEL_H
+#define INCLUDED_VT_SCHEDULER_TIMER_WHEEL_H
+
+#include "vt/config.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace vt { namespace sched {
+
+/// Identifies a timer registered with a \c TimerWheel
+using TimerIDType = uint64_t;
+
+/// Sentinel for no timer
+static constexpr TimerIDType const no_timer = 0;
+
+/**
+ * \struct TimerWheel
+ *
+ * \brief A hierarchical timer wheel of one-shot timers with O(1) insertion and
+ * cancellation.
+ *
+ * Time is discretized into ticks of a fixed length. Level \c L of the wheel
+ * has \c slots_per_level slots that each span \c slots_per_level^L ticks;
+ * timers are placed on the lowest level whose span covers their expiration
+ * and cascade down a level each time the wheel reaches the start of their
+ * slot. Timers beyond the top level wait in an overflow list that is
+ * re-examined once per top-level rotation.
+ *
+ * Timer entries live in a pooled vector linked into per-slot lists, so
+ * cancellation unlinks in constant time. A timer ID encodes the entry index
+ * and a generation, which makes cancelling an expired or already cancelled
+ * timer a safe no-op.
+ */
+struct TimerWheel {
+  static constexpr int const level_bits      = 6;
+  static constexpr int const slots_per_level = 1 << level_bits;
+  static constexpr int const num_levels      = 4;
+
+  /**
+   * \brief Construct a timer wheel
+   *
+   * \param[in] in_tick the length of a tick in seconds
+   * \param[in] in_origin the time corresponding to tick zero
+   */
+  explicit TimerWheel(TimeType in_tick = 0.0001, TimeType in_origin = 0.);
+
+  TimerWheel(TimerWheel const&) = delete;
+  TimerWheel& operator=(TimerWheel const&) = delete;
+
+  /**
+   * \brief Schedule an action to run once at or after a point in time
+   *
+   * The action runs from \c advance at most one tick after \c deadline.
+   *
+   * \param[in] deadline the time at which the action becomes due
+   * \param[in] action the action to run when the timer expires
+   * \param[in] on_cancel optional action to run if the timer is cancelled
+   *
+   * \return the timer ID
+   */
+  TimerIDType schedule(
+    TimeType deadline, ActionType action, ActionType on_cancel = nullptr
+  );
+
+  /**
+   * \brief Cancel a pending timer
+   *
+   * \param[in] id the timer to cancel
+   *
+   * \return whether the timer was pending (and is now cancelled)
+   */
+  bool cancel(TimerIDType id);
+
+  /**
+   * \brief Advance the wheel to \c now, running every timer that has expired
+   *
+   * Runs of empty ticks are skipped in bulk, so the cost is bounded by
+   * \c max_ticks non-empty tick boundaries regardless of how much time has
+   * passed. If the bound is hit, the remaining ticks are processed by the
+   * next call.
+   *
+   * \param[in] now the current time
+   * \param[in] max_ticks the maximum number of ticks to process
+   *
+   * \return the number of timers that expired
+   */
+  int advance(TimeType now, int max_ticks = 256);
+
+  /**
+   * \brief Check whether any timers are pending
+   *
+   * \return whether no timers are pending
+   */
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * \brief Get the number of pending timers
+   *
+   * \return the number of pending timers
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * \brief Get the length of a tick
+   *
+   * \return the tick length in seconds
+   */
+  TimeType getTick() const { return tick_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | tick_
+      | origin_
+      | current_tick_
+      | size_
+      | entries_
+      | free_
+      | heads_
+      | level_count_;
+  }
+
+private:
+  using IndexType = int32_t;
+
+  static constexpr IndexType const no_index = -1;
+  static constexpr int const overflow_list = num_levels * slots_per_level;
+
+  struct Entry {
+    ActionType action_    = nullptr;
+    ActionType on_cancel_ = nullptr;
+    uint64_t expiry_      = 0;
+    uint32_t generation_  = 1;
+    IndexType prev_       = no_index;
+    IndexType next_       = no_index;
+    int32_t list_         = no_index;
+
+    template <typename SerializerT>
+    void serialize(SerializerT& s) {
+      s | action_ | on_cancel_ | expiry_ | generation_ | prev_ | next_ | list_;
+    }
+  };
+
+  uint64_t toTick(TimeType time) const;
+  IndexType allocate();
+  void release(IndexType idx);
+  void place(IndexType idx);
+  void unlink(IndexType idx);
+  void cascade(int list);
+  int processTick(uint64_t tick);
+  int levelOf(int list) const;
+
+private:
+  TimeType tick_ = 0.0001;
+  TimeType origin_ = 0.;
+  uint64_t current_tick_ = 0;
+  std::size_t size_ = 0;
+  std::vector<Entry> entries_;
+  std::vector<IndexType> free_;
+  std::array<IndexType, overflow_list + 1> heads_;
+  std::array<std::size_t, num_levels + 1> level_count_;
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*INCLUDED_VT_SCHEDULER_TIMER_WHEEL_H*/
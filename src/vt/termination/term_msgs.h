@@ -48,6 +48,8 @@
 #include "vt/messaging/message.h"
 #include "vt/termination/term_state.h"
 
+#include <vector>
+
 namespace vt { namespace term {
 
 struct TermMsg : vt::ShortMessage {
@@ -102,6 +104,57 @@ struct TermCounterMsg : vt::ShortMessage {
   { }
 };
 
+/**
+ * \struct TermCounterBatchMsg
+ *
+ * \brief The counters of every epoch that became ready to submit to the parent
+ * during one progress tick, sent as a single wave message
+ *
+ * The entries are a fixed-layout array in the extra bytes after the message
+ * (see \c makeMessageSz), so the batch is sent as a plain termination message
+ * without serialization.
+ */
+struct TermCounterBatchMsg : vt::ShortMessage {
+  /// The counters for one epoch, equivalent to a \c TermCounterMsg
+  struct Entry {
+    Entry() = default;
+    Entry(
+      EpochType const in_epoch,
+      TermCounterType const in_prod, TermCounterType const in_cons
+    ) : epoch(in_epoch), prod(in_prod), cons(in_cons)
+    { }
+
+    template <typename SerializerT>
+    void serialize(SerializerT& s) {
+      s | epoch | prod | cons;
+    }
+
+    EpochType epoch = no_epoch;
+    TermCounterType prod = 0, cons = 0;
+  };
+
+  explicit TermCounterBatchMsg(std::size_t in_num_entries)
+    : ShortMessage(), num_entries_(in_num_entries)
+  { }
+
+  /// Get the number of extra bytes needed for \c num entries
+  static std::size_t extraBytes(std::size_t num) { return num * sizeof(Entry); }
+
+  /// Get the entries stored after the message
+  Entry* entries() {
+    return reinterpret_cast<Entry*>(
+      reinterpret_cast<char*>(this) + sizeof(TermCounterBatchMsg)
+    );
+  }
+
+  std::size_t num_entries_ = 0;
+};
+
+static_assert(
+  sizeof(TermCounterBatchMsg) % alignof(TermCounterBatchMsg::Entry) == 0,
+  "Batch entries after the message must be aligned"
+);
+
 struct BuildGraphMsg : vt::ShortMessage { };
 
 }} //end namespace vt::term
@@ -57,6 +57,7 @@
 #include "vt/collective/collective_alg.h"
 #include "vt/pipe/pipe_headers.h"
 
+#include <cstring>
 #include <memory>
 
 namespace vt { namespace term {
@@ -65,7 +66,14 @@ TerminationDetector::TerminationDetector()
   : collective::tree::Tree(collective::tree::tree_cons_tag_t),
   any_epoch_state_(any_epoch_sentinel, false, true, getNumChildren()),
   hang_(no_epoch, true, false, getNumChildren())
-{ }
+{
+  waveMsgCount = registerCounter(
+    "wave_msgs", "coalesced termination wave messages sent"
+  );
+  waveEpochCount = registerCounter(
+    "wave_epochs", "epoch counters sent in termination waves"
+  );
+}
 
 /*static*/ void TerminationDetector::makeRootedHandler(TermMsg* msg) {
   theTerm()->makeRootedHan(msg->new_epoch, false);
@@ -76,6 +84,15 @@ TerminationDetector::propagateEpochHandler(TermCounterMsg* msg) {
   theTerm()->propagateEpochExternal(msg->epoch, msg->prod, msg->cons);
 }
 
+/*static*/ void
+TerminationDetector::propagateEpochBatchHandler(TermCounterBatchMsg* msg) {
+  auto const entries = msg->entries();
+  for (std::size_t i = 0; i < msg->num_entries_; i++) {
+    auto const& c = entries[i];
+    theTerm()->propagateEpochExternal(c.epoch, c.prod, c.cons);
+  }
+}
+
 /*static*/ void TerminationDetector::epochTerminatedHandler(TermMsg* msg) {
   theTerm()->epochTerminated(msg->new_epoch, CallFromEnum::NonRoot);
 }
@@ -96,6 +113,40 @@ TerminationDetector::propagateEpochHandler(TermCounterMsg* msg) {
   theTerm()->replyTerminated(msg->getEpoch(),msg->isTerminated());
 }
 
+int TerminationDetector::progress() {
+  if (pending_counters_.empty()) {
+    return 0;
+  }
+
+  auto const num_epochs = pending_counters_.size();
+
+  vt_debug_print(
+    verbose, term,
+    "progress: sending batch to parent: {}, num_epochs={}\n",
+    getParent(), num_epochs
+  );
+
+  if (num_epochs == 1) {
+    auto const& c = pending_counters_[0];
+    auto msg = makeMessage<TermCounterMsg>(c.epoch, c.prod, c.cons);
+    theMsg()->markAsTermMessage(msg);
+    theMsg()->sendMsg<TermCounterMsg, propagateEpochHandler>(getParent(), msg);
+  } else {
+    auto const extra = TermCounterBatchMsg::extraBytes(num_epochs);
+    auto msg = makeMessageSz<TermCounterBatchMsg>(extra, num_epochs);
+    std::memcpy(msg->entries(), pending_counters_.data(), extra);
+    theMsg()->markAsTermMessage(msg);
+    theMsg()->sendMsgSz<TermCounterBatchMsg, propagateEpochBatchHandler>(
+      getParent(), msg, sizeof(TermCounterBatchMsg) + extra
+    );
+  }
+  pending_counters_.clear();
+
+  waveMsgCount.increment(1);
+  waveEpochCount.increment(num_epochs);
+  return 1;
+}
+
 TermCounterType TerminationDetector::getNumUnits() const {
   return any_epoch_state_.g_cons2;
 }
@@ -403,7 +454,18 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
       state.getRecvChildCount(), state.getNumChildren()
     );
 
-    if (not is_root) {
+    if (not is_root and not theConfig()->vt_term_no_coalesce) {
+      // Coalesce with the other epochs ready this tick; sent in `progress'
+      pending_counters_.emplace_back(
+        state.getEpoch(), state.g_prod1, state.g_cons1
+      );
+
+      vt_debug_print(
+        verbose, term,
+        "propagateEpoch: queue for parent: {}, epoch={:x}, wave={}\n",
+        parent, state.getEpoch(), state.getCurWave()
+      );
+    } else if (not is_root) {
       auto msg = makeMessage<TermCounterMsg>(
         state.getEpoch(), state.g_prod1, state.g_cons1
       );
@@ -415,6 +477,9 @@ bool TerminationDetector::propagateEpoch(TermStateType& state) {
         parent, print_ptr(msg.get()), state.getEpoch(), state.getCurWave()
       );
 
+      waveMsgCount.increment(1);
+      waveEpochCount.increment(1);
+
       theMsg()->sendMsg<TermCounterMsg, propagateEpochHandler>(parent, msg);
     } else /*if (is_root) */ {
       is_term =
@@ -92,7 +92,7 @@ using DijkstraScholtenTerm = term::ds::StateDS;
  * across all nodes) are equal, termination is reached.
  */
 struct TerminationDetector :
-  runtime::component::Component<TerminationDetector>,
+  runtime::component::PollableComponent<TerminationDetector>,
   TermAction, collective::tree::Tree, DijkstraScholtenTerm, TermInterface
 {
   template <typename T>
@@ -112,6 +112,21 @@ struct TerminationDetector :
 
   std::string name() override { return "TerminationDetector"; }
 
+  /**
+   * \internal \brief Send the counters of all epochs that became ready since
+   * the last tick to the parent in a single wave message
+   *
+   * \return number of messages sent
+   */
+  int progress() override;
+
+  /**
+   * \internal \brief Whether any epoch counters are waiting to be sent
+   *
+   * \return whether there are pending counters
+   */
+  bool hasPendingWork() override { return not pending_counters_.empty(); }
+
   /****************************************************************************
    *
    * Termination interface: produce(..)/consume(..) for 4-counter wave-based
@@ -657,7 +672,10 @@ public:
       | epoch_state_
       | epoch_ready_
       | epoch_wait_status_
-      | has_printed_epoch_graph;
+      | has_printed_epoch_graph
+      | pending_counters_
+      | waveMsgCount
+      | waveEpochCount;
   }
 
 private:
@@ -739,6 +757,13 @@ private:
    */
   static void propagateEpochHandler(TermCounterMsg* msg);
 
+  /**
+   * \internal \brief Propagate the counters of a batch of epochs handler
+   *
+   * \param[in] msg the message
+   */
+  static void propagateEpochBatchHandler(TermCounterBatchMsg* msg);
+
   /**
    * \internal \brief Notify an epoch terminated handler
    *
@@ -766,6 +791,12 @@ private:
   std::unordered_set<EpochType> epoch_wait_status_      = {};
   // has printed epoch graph during abort
   bool has_printed_epoch_graph                          = false;
+  // counters ready for the parent, sent together on the next progress tick
+  std::vector<TermCounterBatchMsg::Entry> pending_counters_ = {};
+  // number of coalesced wave messages sent to the parent
+  diagnostic::Counter waveMsgCount;
+  // number of epoch counters carried by those messages
+  diagnostic::Counter waveEpochCount;
 };
 
 }} // end namespace vt::term
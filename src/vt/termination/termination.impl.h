@@ -48,6 +48,7 @@
 #include "vt/termination/termination.h"
 #include "vt/termination/term_common.h"
 #include "vt/epoch/epoch_manip.h"
+#include "vt/worker/fork_join_section.h"
 
 namespace vt { namespace term {
 
@@ -55,6 +56,11 @@ inline void TerminationDetector::produce(
   EpochType epoch, TermCounterType num_units, NodeType node
 ) {
   vt_debug_print(verbose, term, "produce: epoch={:x}, node={}\n", epoch, node);
+  auto section = worker::ForkJoinSection::current();
+  if (section != nullptr) {
+    // Accumulated per worker and applied by the comm thread at the join
+    return section->produceConsume(epoch, num_units, true, node);
+  }
   auto const in_epoch = epoch == no_epoch ? any_epoch_sentinel : epoch;
   return produceConsume(in_epoch, num_units, true, node);
 }
@@ -63,6 +69,11 @@ inline void TerminationDetector::consume(
   EpochType epoch, TermCounterType num_units, NodeType node
 ) {
   vt_debug_print(verbose, term, "consume: epoch={:x}, node={}\n", epoch, node);
+  auto section = worker::ForkJoinSection::current();
+  if (section != nullptr) {
+    // Accumulated per worker and applied by the comm thread at the join
+    return section->produceConsume(epoch, num_units, false, node);
+  }
   auto const in_epoch = epoch == no_epoch ? any_epoch_sentinel : epoch;
   return produceConsume(in_epoch, num_units, false, node);
 }
@@ -65,7 +65,8 @@ void TimeTriggerManager::removeTrigger(int id) {
   removed_.insert(id);
 }
 
-void TimeTriggerManager::triggerReady(TimeType cur_time) {
+int TimeTriggerManager::triggerReady(TimeType cur_time) {
+  int num_run = 0;
   while (not queue_.empty()) {
     if (queue_.top().ready(cur_time)) {
       auto t = queue_.top();
@@ -80,17 +81,22 @@ void TimeTriggerManager::triggerReady(TimeType cur_time) {
       queue_.pop();
       t.runAction(cur_time);
       queue_.push(t);
+      num_run++;
     } else {
       // all other triggers will not be ready if this one isn't
       break;
     }
   }
+  return num_run;
 }
 
 int TimeTriggerManager::progress() {
   auto const cur_time = timing::getCurrentTime();
-  triggerReady(cur_time);
-  return 0;
+  return triggerReady(cur_time);
+}
+
+bool TimeTriggerManager::hasPendingWork() {
+  return not queue_.empty() and queue_.top().ready(timing::getCurrentTime());
 }
 
 }} /* end namespace vt::timetrigger */
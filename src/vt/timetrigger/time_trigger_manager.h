@@ -75,6 +75,13 @@ struct TimeTriggerManager
 
   int progress() override;
 
+  /**
+   * \brief Whether any trigger is due to run
+   *
+   * \return whether a trigger is ready now
+   */
+  bool hasPendingWork() override;
+
   /**
    * \brief Register a time-based trigger with a specific period
    *
@@ -102,8 +109,10 @@ struct TimeTriggerManager
    * \brief Trigger any read time-based triggers
    *
    * \param[in] cur_time the current time
+   *
+   * \return the number of triggers that ran
    */
-  void triggerReady(TimeType cur_time);
+  int triggerReady(TimeType cur_time);
 
   template <typename SerializerT>
   void serialize(SerializerT& s) {
@@ -314,6 +314,16 @@ struct EntityLocationCoord : LocationCoord {
    */
   bool isCached(EntityID const& id) const;
 
+  /**
+   * \internal \brief Get the purported location of an entity from the cache
+   * without sending any messages
+   *
+   * \param[in] id the entity ID
+   *
+   * \return the cached node, or \c uninitialized_destination if not cached
+   */
+  NodeType getCachedNode(EntityID const& id);
+
   /**
    * \internal \brief Clear the cache
    */
@@ -174,6 +174,7 @@ void EntityLocationCoord<EntityID>::registerEntity(
       );
       msg->setResolvedNode(this_node);
       theMsg()->markAsLocationMessage(msg);
+      theMsg()->markAsSystemMessage(msg);
       theMsg()->sendMsg<LocMsgType, updateLocation>(home, msg);
     }
   }
@@ -272,6 +273,17 @@ bool EntityLocationCoord<EntityID>::isCached(EntityID const& id) const {
   return recs_.exists(id);
 }
 
+template <typename EntityID>
+NodeType EntityLocationCoord<EntityID>::getCachedNode(EntityID const& id) {
+  if (local_registered_.find(id) != local_registered_.end()) {
+    return theContext()->getNode();
+  }
+  if (recs_.exists(id)) {
+    return recs_.get(id).getRemoteNode();
+  }
+  return uninitialized_destination;
+}
+
 template <typename EntityID>
 void EntityLocationCoord<EntityID>::clearCache() {
   recs_.clearCache();
@@ -401,6 +413,7 @@ void EntityLocationCoord<EntityID>::getLocation(
           this_inst, id, event_id, this_node, home_node
         );
         theMsg()->markAsLocationMessage(msg);
+        theMsg()->markAsSystemMessage(msg);
         theMsg()->sendMsg<LocMsgType, getLocationHandler>(home_node, msg);
         // save a pending action when information about location arrives
         pending_actions_.emplace(
@@ -853,6 +866,7 @@ template <typename EntityID>
         );
         msg2->setResolvedNode(node);
         theMsg()->markAsLocationMessage(msg2);
+        theMsg()->markAsSystemMessage(msg2);
         theMsg()->sendMsg<LocMsgType, updateLocation>(ask_node, msg2);
       });
       theMsg()->popEpoch(epoch);
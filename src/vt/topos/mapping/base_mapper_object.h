@@ -44,6 +44,8 @@
 #if !defined INCLUDED_VT_TOPOS_MAPPING_BASE_MAPPER_OBJECT_H
 #define INCLUDED_VT_TOPOS_MAPPING_BASE_MAPPER_OBJECT_H
 
+#include <functional>
+
 namespace vt { namespace mapping {
 
 /**
@@ -55,9 +57,43 @@ namespace vt { namespace mapping {
 template <typename IdxT>
 struct BaseMapper {
   using BaseIndexType = IdxT;
+  using LocalFnType   = std::function<void(IdxT const&)>;
+  using OrderFnType   = std::function<uint64_t(IdxT const&)>;
 
   virtual ~BaseMapper() = default;
   virtual NodeType map(IdxT* idx, int ndim, NodeType num_nodes) = 0;
+
+  /**
+   * \brief Enumerate the indices in a dense range that \c map assigns to a
+   * node without visiting the others.
+   *
+   * Mappers that can invert their mapping cheaply should override this so
+   * collection construction is proportional to the local element count. The
+   * default has no inverse.
+   *
+   * \param[in] range the range (every index below it in each dimension)
+   * \param[in] node the node to enumerate
+   * \param[in] num_nodes the number of nodes
+   * \param[in] fn applied to each index mapped to \c node
+   *
+   * \return whether the indices were enumerated; if not, the caller must call
+   * \c map on each index in the range
+   */
+  virtual bool mapLocal(
+    IdxT const& /*range*/, NodeType /*node*/, NodeType /*num_nodes*/,
+    LocalFnType const& /*fn*/
+  ) {
+    return false;
+  }
+
+  /**
+   * \brief Get a key ordering the iteration over the local elements, so
+   * elements that are neighbors under the mapping are also visited (and
+   * allocated) together. The default leaves the order unspecified.
+   *
+   * \return the ordering key function, or empty for no ordering
+   */
+  virtual OrderFnType getLocalOrder() { return nullptr; }
 };
 
 }} /* end namespace vt::mapping */
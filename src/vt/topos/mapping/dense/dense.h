@@ -68,6 +68,34 @@ Idx linearizeDenseIndexRowMajor(
   DenseIndex<Idx, ndim> *idx, DenseIndex<Idx, ndim> *max_idx
 );
 
+/**
+ * \brief Inverse of \c linearizeDenseIndexColMajor
+ *
+ * \param[in] flat_idx the linearized index
+ * \param[in] max_idx the bounds
+ * \param[out] idx the index that linearizes to \c flat_idx
+ */
+template <typename Idx, index::NumDimensionsType ndim>
+void delinearizeDenseIndexColMajor(
+  Idx flat_idx, DenseIndex<Idx, ndim> *max_idx, DenseIndex<Idx, ndim> *idx
+);
+
+/**
+ * \brief Get the contiguous flat range \c [lo,hi) that
+ * \c blockMapDenseFlatIndex assigns to a resource
+ *
+ * \param[in] num_elems the number of flat indices
+ * \param[in] resource the resource
+ * \param[in] num_resources the number of resources
+ * \param[out] lo first flat index
+ * \param[out] hi one past the last flat index
+ */
+template <typename IndexElmType, typename PhysicalType>
+void blockMapDenseFlatRange(
+  IndexElmType num_elems, PhysicalType resource, PhysicalType num_resources,
+  IndexElmType* lo, IndexElmType* hi
+);
+
 template <typename Index>
 using IdxPtr = Index*;
 
@@ -78,6 +106,24 @@ template <typename T = IdxBase> using Idx3DPtr = IdxType3D<T>*;
 template <typename Idx, index::NumDimensionsType ndim>
 NodeType denseBlockMap(IdxPtr<Idx> idx, IdxPtr<Idx> max_idx, NodeType nnodes);
 
+/**
+ * \brief Apply \c fn to every index within \c max_idx that \c denseBlockMap
+ * assigns to \c node, in O(indices on node)
+ */
+template <typename Idx, index::NumDimensionsType ndim, typename Fn>
+void denseBlockMapLocal(
+  IdxPtr<Idx> max_idx, NodeType node, NodeType nnodes, Fn&& fn
+);
+
+/**
+ * \brief Apply \c fn to every index within \c max_idx that the dense
+ * round-robin maps assign to \c node, in O(indices on node)
+ */
+template <typename Idx, index::NumDimensionsType ndim, typename Fn>
+void denseRoundRobinMapLocal(
+  IdxPtr<Idx> max_idx, NodeType node, NodeType nnodes, Fn&& fn
+);
+
 template <typename T = IdxBase>
 NodeType defaultDenseIndex1DMap(Idx1DPtr<T> idx, Idx1DPtr<T> max, NodeType n);
 template <typename T = IdxBase>
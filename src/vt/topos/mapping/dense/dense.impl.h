@@ -174,6 +174,72 @@ Idx linearizeDenseIndexRowMajor(
   return val;
 }
 
+template <typename Idx, index::NumDimensionsType ndim>
+void delinearizeDenseIndexColMajor(
+  Idx flat_idx, DenseIndex <Idx, ndim> *max_idx, DenseIndex <Idx, ndim> *idx
+) {
+  auto const& max_idx_ = *max_idx;
+  auto& idx_ = *idx;
+
+  // The last dimension varies fastest, matching linearizeDenseIndexColMajor
+  for (auto i = ndim - 1; i >= 0; i--) {
+    idx_[i] = flat_idx % max_idx_[i];
+    flat_idx /= max_idx_[i];
+  }
+}
+
+template <typename IndexElmType, typename PhysicalType>
+inline void blockMapDenseFlatRange(
+  IndexElmType num_elems, PhysicalType resource, PhysicalType num_resources,
+  IndexElmType* lo, IndexElmType* hi
+) {
+  IndexElmType const bin_size_floor = num_elems / num_resources;
+  IndexElmType const rem_elms = num_elems % num_resources;
+  IndexElmType const res = static_cast<IndexElmType>(resource);
+
+  // The first rem_elms resources each get one extra element
+  if (res < rem_elms) {
+    *lo = res * (bin_size_floor + 1);
+    *hi = *lo + bin_size_floor + 1;
+  } else {
+    *lo = rem_elms * (bin_size_floor + 1) + (res - rem_elms) * bin_size_floor;
+    *hi = *lo + bin_size_floor;
+  }
+}
+
+template <typename Idx, index::NumDimensionsType ndim, typename Fn>
+void denseBlockMapLocal(
+  IdxPtr<Idx> max_idx, NodeType node, NodeType nnodes, Fn&& fn
+) {
+  using IndexElmType = typename Idx::DenseIndexType;
+
+  IndexElmType lo = 0, hi = 0;
+  blockMapDenseFlatRange<IndexElmType, NodeType>(
+    max_idx->getSize(), node, nnodes, &lo, &hi
+  );
+
+  Idx idx = *max_idx;
+  for (IndexElmType flat_idx = lo; flat_idx < hi; flat_idx++) {
+    delinearizeDenseIndexColMajor<IndexElmType, ndim>(flat_idx, max_idx, &idx);
+    fn(idx);
+  }
+}
+
+template <typename Idx, index::NumDimensionsType ndim, typename Fn>
+void denseRoundRobinMapLocal(
+  IdxPtr<Idx> max_idx, NodeType node, NodeType nnodes, Fn&& fn
+) {
+  using IndexElmType = typename Idx::DenseIndexType;
+
+  IndexElmType const total_elems = max_idx->getSize();
+
+  Idx idx = *max_idx;
+  for (IndexElmType flat_idx = node; flat_idx < total_elems; flat_idx += nnodes) {
+    delinearizeDenseIndexColMajor<IndexElmType, ndim>(flat_idx, max_idx, &idx);
+    fn(idx);
+  }
+}
+
 template <typename Idx, index::NumDimensionsType ndim>
 NodeType denseBlockMap(IdxPtr<Idx> idx, IdxPtr<Idx> max_idx, NodeType nnodes) {
   using IndexElmType = typename Idx::DenseIndexType;
@@ -0,0 +1,200 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               space_filling.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_H
+#define INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_H
+
+#include "vt/config.h"
+#include "vt/topos/mapping/dense/dense.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace vt { namespace mapping {
+
+/**
+ * \enum SpaceFillingCurve
+ *
+ * \brief The space-filling curve used to linearize a dense index space
+ */
+enum struct SpaceFillingCurve : int8_t {
+  Morton  = 0,            /**< Z-order: interleave the coordinate bits */
+  Hilbert = 1             /**< Hilbert: consecutive keys are always neighbors */
+};
+
+/**
+ * \brief Get the number of bits needed to represent coordinates in [0,extent)
+ */
+template <typename T>
+int curveBits(T extent);
+
+/**
+ * \brief Compute the Morton (Z-order) key of an index whose coordinates each
+ * fit in \c bits bits; dimension 0 supplies the most significant bit
+ */
+template <typename T, index::NumDimensionsType ndim>
+uint64_t mortonKey(DenseIndex<T, ndim> const& idx, int bits);
+
+/**
+ * \brief Compute the Hilbert key of an index whose coordinates each fit in
+ * \c bits bits, using Skilling's transpose construction
+ */
+template <typename T, index::NumDimensionsType ndim>
+uint64_t hilbertKey(DenseIndex<T, ndim> const& idx, int bits);
+
+/**
+ * \brief Compute the key of an index along \c curve
+ */
+template <typename T, index::NumDimensionsType ndim>
+uint64_t curveKey(
+  SpaceFillingCurve curve, DenseIndex<T, ndim> const& idx, int bits
+);
+
+/**
+ * \struct CurvePartition
+ *
+ * \brief Partition a dense index space into contiguous, element-balanced
+ * segments of a space-filling curve, one per node
+ *
+ * The bounds are cut into tiles of \c grain indices per dimension and the
+ * tiles are ordered along the curve, so a tile is never split across nodes. A
+ * larger grain gives coarser balance. Construction never enumerates the
+ * tiles: every aligned cube of tiles covers one run of keys sharing a prefix,
+ * so its element count is known in closed form and only cubes holding one of
+ * the \c num_nodes - 1 segment boundaries are subdivided. Both construction
+ * and \c mapLocal cost O(num_nodes * 2^ndim * log(extent)) beyond the local
+ * elements, independent of the size of the index space.
+ */
+template <typename T, index::NumDimensionsType ndim>
+struct CurvePartition {
+  using IndexType = DenseIndex<T, ndim>;
+
+  CurvePartition() = default;
+  CurvePartition(
+    IndexType bounds, SpaceFillingCurve curve, T grain, NodeType num_nodes
+  );
+
+  /**
+   * \brief Whether this partition was built for these bounds and node count
+   */
+  bool matches(IndexType const& bounds, NodeType num_nodes) const;
+
+  /**
+   * \brief Get the node an index is mapped to
+   */
+  NodeType map(IndexType const& idx) const;
+
+  /**
+   * \brief Apply \c fn to every index below \c range that is mapped to
+   * \c node, in curve order; only the cubes overlapping the node's key range
+   * are visited
+   */
+  template <typename Fn>
+  void mapLocal(IndexType const& range, NodeType node, Fn&& fn) const;
+
+  /**
+   * \brief Get the key ordering an index along the curve: by tile and then by
+   * position within the tile
+   */
+  uint64_t elementKey(IndexType const& idx) const;
+
+private:
+  uint64_t tileKey(IndexType const& tile) const;
+
+  /**
+   * \brief Count the elements below \c range in the aligned cube of tiles at
+   * \c level (the root is level 0) with lowest corner \c corner
+   */
+  uint64_t cubeWeight(
+    int level, IndexType const& corner, IndexType const& range
+  ) const;
+
+  /**
+   * \brief Visit the non-empty cubes below \c range in curve order; \c visit
+   * gets the level, corner, key range and element count of a cube and returns
+   * whether to descend into it
+   */
+  template <typename Visit>
+  void descend(
+    int level, IndexType const& corner, IndexType const& range, Visit&& visit
+  ) const;
+
+private:
+  IndexType bounds_ = {};
+  SpaceFillingCurve curve_ = SpaceFillingCurve::Hilbert;
+  T grain_ = 1;
+  int tile_bits_ = 0;
+  int grain_bits_ = 0;
+  NodeType num_nodes_ = 0;
+  std::vector<uint64_t> splitters_ = {};
+};
+
+template <typename T, index::NumDimensionsType ndim>
+NodeType denseCurveMap(
+  IdxPtr<DenseIndex<T, ndim>> idx, IdxPtr<DenseIndex<T, ndim>> max,
+  NodeType nnodes, SpaceFillingCurve curve
+);
+
+template <typename T = IdxBase>
+NodeType dense2DHilbertMap(     Idx2DPtr<T> idx, Idx2DPtr<T> max, NodeType n);
+template <typename T = IdxBase>
+NodeType dense3DHilbertMap(     Idx3DPtr<T> idx, Idx3DPtr<T> max, NodeType n);
+template <typename T = IdxBase>
+NodeType dense2DMortonMap(      Idx2DPtr<T> idx, Idx2DPtr<T> max, NodeType n);
+template <typename T = IdxBase>
+NodeType dense3DMortonMap(      Idx3DPtr<T> idx, Idx3DPtr<T> max, NodeType n);
+
+template <typename T = IdxBase>
+using dense2DHilbertMapFn = Adapt<MapAdapter<i2D<T>>, dense2DHilbertMap<T>, i2D<T>>;
+template <typename T = IdxBase>
+using dense3DHilbertMapFn = Adapt<MapAdapter<i3D<T>>, dense3DHilbertMap<T>, i3D<T>>;
+template <typename T = IdxBase>
+using dense2DMortonMapFn  = Adapt<MapAdapter<i2D<T>>, dense2DMortonMap<T>, i2D<T>>;
+template <typename T = IdxBase>
+using dense3DMortonMapFn  = Adapt<MapAdapter<i3D<T>>, dense3DMortonMap<T>, i3D<T>>;
+
+}}  // end namespace vt::mapping
+
+#include "vt/topos/mapping/dense/space_filling.impl.h"
+
+#endif /*INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_H*/
@@ -0,0 +1,378 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             space_filling.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_IMPL_H
+#define INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_IMPL_H
+
+#include "vt/config.h"
+#include "vt/topos/mapping/dense/space_filling.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <tuple>
+
+namespace vt { namespace mapping {
+
+template <typename T>
+int curveBits(T extent) {
+  int bits = 0;
+  while ((static_cast<uint64_t>(1) << bits) < static_cast<uint64_t>(extent)) {
+    bits++;
+  }
+  return bits;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+uint64_t mortonKey(DenseIndex<T, ndim> const& idx, int bits) {
+  uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; b--) {
+    for (int i = 0; i < ndim; i++) {
+      key = (key << 1) | ((static_cast<uint64_t>(idx[i]) >> b) & 1);
+    }
+  }
+  return key;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+uint64_t hilbertKey(DenseIndex<T, ndim> const& idx, int bits) {
+  if (bits == 0) {
+    return 0;
+  }
+
+  std::array<uint32_t, ndim> x;
+  for (int i = 0; i < ndim; i++) {
+    x[i] = static_cast<uint32_t>(idx[i]);
+  }
+
+  // Undo the excess rotations and reflections, most significant bit first
+  uint32_t const m = static_cast<uint32_t>(1) << (bits - 1);
+  for (uint32_t q = m; q > 1; q >>= 1) {
+    uint32_t const p = q - 1;
+    for (int i = 0; i < ndim; i++) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        uint32_t const t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < ndim; i++) {
+    x[i] ^= x[i - 1];
+  }
+  uint32_t t = 0;
+  for (uint32_t q = m; q > 1; q >>= 1) {
+    if (x[ndim - 1] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (int i = 0; i < ndim; i++) {
+    x[i] ^= t;
+  }
+
+  // The key is the transposed form with its bits interleaved
+  uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; b--) {
+    for (int i = 0; i < ndim; i++) {
+      key = (key << 1) | ((x[i] >> b) & 1);
+    }
+  }
+  return key;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+uint64_t curveKey(
+  SpaceFillingCurve curve, DenseIndex<T, ndim> const& idx, int bits
+) {
+  switch (curve) {
+  case SpaceFillingCurve::Morton:  return mortonKey<T, ndim>(idx, bits);
+  case SpaceFillingCurve::Hilbert: return hilbertKey<T, ndim>(idx, bits);
+  default:
+    vtAbort("Unknown space-filling curve");
+    return 0;
+  }
+}
+
+template <typename T, index::NumDimensionsType ndim>
+CurvePartition<T, ndim>::CurvePartition(
+  IndexType bounds, SpaceFillingCurve curve, T grain, NodeType num_nodes
+) : bounds_(bounds),
+    curve_(curve),
+    grain_(grain),
+    num_nodes_(num_nodes),
+    splitters_(
+      num_nodes > 0 ? num_nodes - 1 : 0, std::numeric_limits<uint64_t>::max()
+    )
+{
+  vtAssert(grain_ > 0, "Space-filling curve grain must be positive");
+  vtAssert(num_nodes_ > 0, "Must have at least one node");
+
+  T max_tiles = 1;
+  for (int i = 0; i < ndim; i++) {
+    max_tiles = std::max<T>(max_tiles, (bounds_[i] + grain_ - 1) / grain_);
+  }
+  tile_bits_ = curveBits(max_tiles);
+  grain_bits_ = curveBits(grain_);
+  vtAssert(
+    ndim * (tile_bits_ + grain_bits_) <= 64 and tile_bits_ <= 32,
+    "Index space too large for a 64-bit space-filling curve key"
+  );
+
+  uint64_t const total = bounds_.getSize();
+  if (total == 0) {
+    return;
+  }
+
+  // A tile goes to the node owning the element count before it, so node n
+  // starts at the first tile with at least ceil(n * total / num_nodes_)
+  // elements before it; split the product so it cannot overflow
+  uint64_t const per_node = total / num_nodes_;
+  uint64_t const remainder = total % num_nodes_;
+  auto const threshold = [&](NodeType n) -> uint64_t {
+    return n * per_node + (n * remainder + num_nodes_ - 1) / num_nodes_;
+  };
+
+  // Walk the cubes in curve order, skipping over any cube that does not
+  // contain the next segment boundary, and record the first key of each
+  // node's segment
+  uint64_t before = 0;
+  NodeType next = 1;
+  IndexType const origin = {};
+  descend(
+    0, origin, bounds_,
+    [&](int level, IndexType const&, uint64_t lo, uint64_t, uint64_t weight) {
+      if (level < tile_bits_) {
+        if (next < num_nodes_ and threshold(next) < before + weight) {
+          return true;
+        }
+        before += weight;
+        return false;
+      }
+      for (; next < num_nodes_ and threshold(next) <= before; next++) {
+        splitters_[next - 1] = lo;
+      }
+      before += weight;
+      return false;
+    }
+  );
+}
+
+template <typename T, index::NumDimensionsType ndim>
+bool CurvePartition<T, ndim>::matches(
+  IndexType const& bounds, NodeType num_nodes
+) const {
+  return num_nodes_ == num_nodes and bounds_ == bounds;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+uint64_t CurvePartition<T, ndim>::tileKey(IndexType const& tile) const {
+  return curveKey<T, ndim>(curve_, tile, tile_bits_);
+}
+
+template <typename T, index::NumDimensionsType ndim>
+uint64_t CurvePartition<T, ndim>::cubeWeight(
+  int level, IndexType const& corner, IndexType const& range
+) const {
+  int64_t const side = static_cast<int64_t>(1) << (tile_bits_ - level);
+  uint64_t weight = 1;
+  for (int i = 0; i < ndim; i++) {
+    int64_t const limit = std::min<int64_t>(range[i], bounds_[i]);
+    int64_t const lo = static_cast<int64_t>(corner[i]) * grain_;
+    int64_t const hi = std::min<int64_t>(
+      (static_cast<int64_t>(corner[i]) + side) * grain_, limit
+    );
+    if (hi <= lo) {
+      return 0;
+    }
+    weight *= static_cast<uint64_t>(hi - lo);
+  }
+  return weight;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+template <typename Visit>
+void CurvePartition<T, ndim>::descend(
+  int level, IndexType const& corner, IndexType const& range, Visit&& visit
+) const {
+  auto const weight = cubeWeight(level, corner, range);
+  if (weight == 0) {
+    return;
+  }
+
+  // Every tile in an aligned cube shares the cube's key prefix, so the cube
+  // covers one contiguous run of keys
+  int const shift = ndim * (tile_bits_ - level);
+  uint64_t const key = tileKey(corner);
+  uint64_t const lo = shift >= 64 ? 0 : (key >> shift) << shift;
+  uint64_t const hi = shift >= 64 ?
+    std::numeric_limits<uint64_t>::max() :
+    lo | ((static_cast<uint64_t>(1) << shift) - 1);
+
+  if (not visit(level, corner, lo, hi, weight) or level == tile_bits_) {
+    return;
+  }
+
+  T const half = static_cast<T>(1) << (tile_bits_ - level - 1);
+  std::array<std::tuple<uint64_t, IndexType>, (1 << ndim)> children;
+  for (int c = 0; c < (1 << ndim); c++) {
+    IndexType child = corner;
+    for (int i = 0; i < ndim; i++) {
+      if ((c >> i) & 1) {
+        child[i] += half;
+      }
+    }
+    children[c] = std::make_tuple(tileKey(child), child);
+  }
+  std::sort(
+    children.begin(), children.end(), [](auto const& a, auto const& b) {
+      return std::get<0>(a) < std::get<0>(b);
+    }
+  );
+  for (auto&& child : children) {
+    descend(level + 1, std::get<1>(child), range, visit);
+  }
+}
+
+template <typename T, index::NumDimensionsType ndim>
+NodeType CurvePartition<T, ndim>::map(IndexType const& idx) const {
+  IndexType tile = idx;
+  for (int i = 0; i < ndim; i++) {
+    tile[i] = idx[i] / grain_;
+  }
+  auto const key = tileKey(tile);
+  auto const iter = std::upper_bound(splitters_.begin(), splitters_.end(), key);
+  return static_cast<NodeType>(iter - splitters_.begin());
+}
+
+template <typename T, index::NumDimensionsType ndim>
+template <typename Fn>
+void CurvePartition<T, ndim>::mapLocal(
+  IndexType const& range, NodeType node, Fn&& fn
+) const {
+  // The keys on node are [splitters_[node - 1], splitters_[node]), matching
+  // the upper bound search in map
+  bool const has_lo = node > 0;
+  bool const has_hi = node + 1 < num_nodes_;
+  uint64_t const key_lo = has_lo ? splitters_[node - 1] : 0;
+  uint64_t const key_hi = has_hi ? splitters_[node] : 0;
+  if (has_lo and has_hi and key_lo >= key_hi) {
+    return;
+  }
+
+  IndexType const origin = {};
+  descend(
+    0, origin, range,
+    [&](int level, IndexType const& corner, uint64_t lo, uint64_t hi, uint64_t) {
+      if ((has_lo and hi < key_lo) or (has_hi and lo >= key_hi)) {
+        return false;
+      }
+      if (level < tile_bits_) {
+        return true;
+      }
+      IndexType base = corner, extent = corner;
+      for (int i = 0; i < ndim; i++) {
+        base[i] = corner[i] * grain_;
+        extent[i] = std::max<T>(
+          std::min<T>(base[i] + grain_, range[i]) - base[i], 0
+        );
+      }
+      extent.foreach([&](IndexType off) { fn(base + off); });
+      return false;
+    }
+  );
+}
+
+template <typename T, index::NumDimensionsType ndim>
+uint64_t CurvePartition<T, ndim>::elementKey(IndexType const& idx) const {
+  IndexType tile = idx, inner = idx;
+  for (int i = 0; i < ndim; i++) {
+    tile[i] = idx[i] / grain_;
+    inner[i] = idx[i] % grain_;
+  }
+  return
+    (tileKey(tile) << (ndim * grain_bits_)) |
+    curveKey<T, ndim>(curve_, inner, grain_bits_);
+}
+
+template <typename T, index::NumDimensionsType ndim>
+NodeType denseCurveMap(
+  IdxPtr<DenseIndex<T, ndim>> idx, IdxPtr<DenseIndex<T, ndim>> max,
+  NodeType nnodes, SpaceFillingCurve curve
+) {
+  // Map functions are called once per index with the same bounds, so each
+  // thread keeps the last partition per curve rather than rebuilding it
+  static thread_local std::array<CurvePartition<T, ndim>, 2> partitions;
+  auto& part = partitions[static_cast<int>(curve)];
+  if (not part.matches(*max, nnodes)) {
+    part = CurvePartition<T, ndim>(*max, curve, 1, nnodes);
+  }
+  return part.map(*idx);
+}
+
+template <typename T>
+NodeType dense2DHilbertMap(Idx2DPtr<T> idx, Idx2DPtr<T> max, NodeType nx) {
+  return denseCurveMap<T, 2>(idx, max, nx, SpaceFillingCurve::Hilbert);
+}
+
+template <typename T>
+NodeType dense3DHilbertMap(Idx3DPtr<T> idx, Idx3DPtr<T> max, NodeType nx) {
+  return denseCurveMap<T, 3>(idx, max, nx, SpaceFillingCurve::Hilbert);
+}
+
+template <typename T>
+NodeType dense2DMortonMap(Idx2DPtr<T> idx, Idx2DPtr<T> max, NodeType nx) {
+  return denseCurveMap<T, 2>(idx, max, nx, SpaceFillingCurve::Morton);
+}
+
+template <typename T>
+NodeType dense3DMortonMap(Idx3DPtr<T> idx, Idx3DPtr<T> max, NodeType nx) {
+  return denseCurveMap<T, 3>(idx, max, nx, SpaceFillingCurve::Morton);
+}
+
+}}  // end namespace vt::mapping
+
+#endif /*INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_IMPL_H*/
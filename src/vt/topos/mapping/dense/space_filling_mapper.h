@@ -0,0 +1,119 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            space_filling_mapper.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_MAPPER_H
+#define INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_MAPPER_H
+
+#include "vt/config.h"
+#include "vt/topos/mapping/base_mapper_object.h"
+#include "vt/topos/mapping/dense/space_filling.h"
+
+namespace vt { namespace mapping {
+
+template <typename IdxT>
+struct SpaceFillingMapper;
+
+/**
+ * \struct SpaceFillingMapper
+ *
+ * \brief Object group mapper that assigns each node a contiguous segment of a
+ * Hilbert or Morton curve through the bounds of a dense collection
+ *
+ * Neighboring indices land on the same node far more often than with a block
+ * map when the node count does not factor evenly over the dimensions. The
+ * \c grain sets the tile edge that is kept together on one node; larger tiles
+ * build faster and keep more neighbors local, at the cost of balance. With
+ * \c order_local, local elements are constructed and iterated in curve order.
+ */
+template <typename T, index::NumDimensionsType ndim>
+struct SpaceFillingMapper<index::DenseIndexArray<T, ndim>>
+  : BaseMapper<index::DenseIndexArray<T, ndim>>
+{
+  using IndexType     = index::DenseIndexArray<T, ndim>;
+  using BaseType      = BaseMapper<IndexType>;
+  using PartitionType = CurvePartition<T, ndim>;
+
+  SpaceFillingMapper(
+    IndexType bounds, SpaceFillingCurve curve, T grain, bool order_local
+  );
+
+  /**
+   * \brief Construct the mapper collectively
+   *
+   * \param[in] bounds the bounds of the collection
+   * \param[in] curve the space-filling curve
+   * \param[in] grain tile edge length kept on one node
+   * \param[in] order_local whether to order local elements along the curve
+   *
+   * \return the object group proxy
+   */
+  static ObjGroupProxyType construct(
+    IndexType bounds, SpaceFillingCurve curve = SpaceFillingCurve::Hilbert,
+    T grain = 1, bool order_local = true
+  );
+
+  NodeType map(IndexType* idx, int ndim_, NodeType num_nodes) override;
+
+  bool mapLocal(
+    IndexType const& range, NodeType node, NodeType num_nodes,
+    typename BaseType::LocalFnType const& fn
+  ) override;
+
+  typename BaseType::OrderFnType getLocalOrder() override;
+
+private:
+  PartitionType const& getPartition(NodeType num_nodes);
+
+private:
+  IndexType bounds_ = {};
+  SpaceFillingCurve curve_ = SpaceFillingCurve::Hilbert;
+  T grain_ = 1;
+  bool order_local_ = true;
+  PartitionType partition_ = {};
+};
+
+}} /* end namespace vt::mapping */
+
+#include "vt/topos/mapping/dense/space_filling_mapper.impl.h"
+
+#endif /*INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_MAPPER_H*/
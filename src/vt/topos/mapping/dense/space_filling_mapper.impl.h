@@ -0,0 +1,112 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                         space_filling_mapper.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_MAPPER_IMPL_H
+#define INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_MAPPER_IMPL_H
+
+#include "vt/topos/mapping/dense/space_filling_mapper.h"
+#include "vt/objgroup/manager.h"
+
+namespace vt { namespace mapping {
+
+template <typename T, index::NumDimensionsType ndim>
+SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::SpaceFillingMapper(
+  IndexType bounds, SpaceFillingCurve curve, T grain, bool order_local
+) : bounds_(bounds),
+    curve_(curve),
+    grain_(grain),
+    order_local_(order_local)
+{ }
+
+template <typename T, index::NumDimensionsType ndim>
+/*static*/ ObjGroupProxyType
+SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::construct(
+  IndexType bounds, SpaceFillingCurve curve, T grain, bool order_local
+) {
+  auto proxy = theObjGroup()->makeCollective<SpaceFillingMapper<IndexType>>(
+    bounds, curve, grain, order_local
+  );
+  return proxy.getProxy();
+}
+
+template <typename T, index::NumDimensionsType ndim>
+typename SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::PartitionType const&
+SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::getPartition(
+  NodeType num_nodes
+) {
+  if (not partition_.matches(bounds_, num_nodes)) {
+    partition_ = PartitionType(bounds_, curve_, grain_, num_nodes);
+  }
+  return partition_;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+NodeType SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::map(
+  IndexType* idx, int, NodeType num_nodes
+) {
+  return getPartition(num_nodes).map(*idx);
+}
+
+template <typename T, index::NumDimensionsType ndim>
+bool SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::mapLocal(
+  IndexType const& range, NodeType node, NodeType num_nodes,
+  typename BaseType::LocalFnType const& fn
+) {
+  getPartition(num_nodes).mapLocal(range, node, fn);
+  return true;
+}
+
+template <typename T, index::NumDimensionsType ndim>
+typename SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::BaseType::OrderFnType
+SpaceFillingMapper<index::DenseIndexArray<T, ndim>>::getLocalOrder() {
+  if (not order_local_) {
+    return nullptr;
+  }
+  // The element key does not depend on the node count
+  auto const part = getPartition(theContext()->getNumNodes());
+  return [part](IndexType const& idx) { return part.elementKey(idx); };
+}
+
+}} /* end namespace vt::mapping */
+
+#endif /*INCLUDED_VT_TOPOS_MAPPING_DENSE_SPACE_FILLING_MAPPER_IMPL_H*/
@@ -58,6 +58,11 @@ struct UnboundedDefaultMap : BaseMapper<IdxT> {
   static ObjGroupProxyType construct();
 
   NodeType map(IdxT* idx, int ndim, NodeType num_nodes) override;
+
+  bool mapLocal(
+    IdxT const& range, NodeType node, NodeType num_nodes,
+    typename BaseMapper<IdxT>::LocalFnType const& fn
+  ) override;
 };
 
 }} /* end namespace vt::mapping */
@@ -57,6 +57,27 @@ NodeType UnboundedDefaultMap<IdxT>::map(IdxT* idx, int ndim, NodeType num_nodes)
   return val % num_nodes;
 }
 
+template <typename IdxT>
+bool UnboundedDefaultMap<IdxT>::mapLocal(
+  IdxT const& range, NodeType node, NodeType num_nodes,
+  typename BaseMapper<IdxT>::LocalFnType const& fn
+) {
+  // With one dimension the map is round-robin; the XOR of several dimensions
+  // has no cheap inverse
+  if (range.ndims() != 1) {
+    return false;
+  }
+
+  using IndexElmType = typename IdxT::DenseIndexType;
+
+  IdxT idx = range;
+  for (IndexElmType x = node; x < range.get(0); x += num_nodes) {
+    idx[0] = x;
+    fn(idx);
+  }
+  return true;
+}
+
 template <typename IdxT>
 /*static*/ ObjGroupProxyType UnboundedDefaultMap<IdxT>::construct() {
   auto proxy = theObjGroup()->makeCollective<UnboundedDefaultMap<IdxT>>();
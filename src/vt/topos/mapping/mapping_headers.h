@@ -46,6 +46,7 @@
 
 #include "vt/topos/mapping/mapping.h"
 #include "vt/topos/mapping/dense/dense.h"
+#include "vt/topos/mapping/dense/space_filling.h"
 #include "vt/topos/mapping/mapping_function.h"
 
 #endif  /*INCLUDED_VT_TOPOS_MAPPING_MAPPING_HEADERS_H*/
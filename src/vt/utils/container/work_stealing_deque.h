@@ -0,0 +1,170 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            work_stealing_deque.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_UTILS_CONTAINER_WORK_STEALING_DEQUE_H
+#define INCLUDED_VT_UTILS_CONTAINER_WORK_STEALING_DEQUE_H
+
+#include "vt/config.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+namespace vt { namespace util { namespace container {
+
+/**
+ * \struct WorkStealingDeque
+ *
+ * \brief A lock-free Chase-Lev work-stealing deque.
+ *
+ * The owning thread pushes and pops at the bottom without contention; any
+ * other thread may concurrently steal from the top. The circular buffer grows
+ * on demand and retired buffers are kept alive until the deque is destroyed
+ * because a thief may still be reading from them.
+ *
+ * Elements must be trivially copyable (typically pointers to work units).
+ */
+template <typename T>
+struct WorkStealingDeque {
+  using IndexType = int64_t;
+
+  static_assert(
+    std::is_trivially_copyable<T>::value,
+    "WorkStealingDeque elements must be trivially copyable"
+  );
+
+  /**
+   * \brief Construct the deque
+   *
+   * \param[in] in_capacity initial capacity, rounded up to a power of two
+   */
+  explicit WorkStealingDeque(IndexType in_capacity = 256);
+  WorkStealingDeque(WorkStealingDeque const&) = delete;
+  WorkStealingDeque& operator=(WorkStealingDeque const&) = delete;
+
+  ~WorkStealingDeque();
+
+  /**
+   * \brief Push an element at the bottom (owner thread only)
+   *
+   * \param[in] elm the element
+   */
+  void pushBottom(T elm);
+
+  /**
+   * \brief Pop an element from the bottom (owner thread only)
+   *
+   * \param[out] out the popped element
+   *
+   * \return whether an element was popped
+   */
+  bool popBottom(T& out);
+
+  /**
+   * \brief Steal an element from the top (any thread)
+   *
+   * \param[out] out the stolen element
+   *
+   * \return whether an element was stolen; may spuriously fail when racing
+   * with another thief or the owner
+   */
+  bool steal(T& out);
+
+  /**
+   * \brief Approximate number of elements in the deque
+   *
+   * \return the size
+   */
+  IndexType size() const;
+
+  /**
+   * \brief Whether the deque is (approximately) empty
+   *
+   * \return whether it is empty
+   */
+  bool empty() const { return size() <= 0; }
+
+  /**
+   * \brief Current capacity of the underlying buffer
+   *
+   * \return the capacity
+   */
+  IndexType capacity() const;
+
+private:
+  struct Buffer {
+    explicit Buffer(IndexType in_capacity)
+      : capacity_(in_capacity),
+        mask_(in_capacity - 1),
+        elms_(new std::atomic<T>[in_capacity])
+    { }
+
+    T get(IndexType i) const {
+      return elms_[i & mask_].load(std::memory_order_relaxed);
+    }
+
+    void put(IndexType i, T elm) {
+      elms_[i & mask_].store(elm, std::memory_order_relaxed);
+    }
+
+    Buffer* grow(IndexType bottom, IndexType top) const;
+
+    IndexType capacity_ = 0;
+    IndexType mask_ = 0;
+    std::unique_ptr<std::atomic<T>[]> elms_;
+  };
+
+private:
+  alignas(64) std::atomic<IndexType> top_ = {0};
+  alignas(64) std::atomic<IndexType> bottom_ = {0};
+  std::atomic<Buffer*> buffer_ = {nullptr};
+  std::vector<std::unique_ptr<Buffer>> retired_ = {};
+};
+
+}}} /* end namespace vt::util::container */
+
+#include "vt/utils/container/work_stealing_deque.impl.h"
+
+#endif /*INCLUDED_VT_UTILS_CONTAINER_WORK_STEALING_DEQUE_H*/
@@ -0,0 +1,162 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          work_stealing_deque.impl.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_UTILS_CONTAINER_WORK_STEALING_DEQUE_IMPL_H
+#define INCLUDED_VT_UTILS_CONTAINER_WORK_STEALING_DEQUE_IMPL_H
+
+#include "vt/config.h"
+#include "vt/utils/container/work_stealing_deque.h"
+
+namespace vt { namespace util { namespace container {
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(IndexType in_capacity) {
+  IndexType capacity = 1;
+  while (capacity < in_capacity) {
+    capacity <<= 1;
+  }
+  buffer_.store(new Buffer(capacity), std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+  delete buffer_.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Buffer*
+WorkStealingDeque<T>::Buffer::grow(IndexType bottom, IndexType top) const {
+  auto buf = new Buffer(capacity_ * 2);
+  for (IndexType i = top; i < bottom; i++) {
+    buf->put(i, get(i));
+  }
+  return buf;
+}
+
+template <typename T>
+void WorkStealingDeque<T>::pushBottom(T elm) {
+  auto const b = bottom_.load(std::memory_order_relaxed);
+  auto const t = top_.load(std::memory_order_acquire);
+  auto buf = buffer_.load(std::memory_order_relaxed);
+
+  if (b - t > buf->capacity_ - 1) {
+    auto new_buf = buf->grow(b, t);
+    retired_.emplace_back(buf);
+    buffer_.store(new_buf, std::memory_order_release);
+    buf = new_buf;
+  }
+
+  buf->put(b, elm);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(b + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::popBottom(T& out) {
+  auto const b = bottom_.load(std::memory_order_relaxed) - 1;
+  auto buf = buffer_.load(std::memory_order_relaxed);
+  bottom_.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto t = top_.load(std::memory_order_relaxed);
+
+  if (t > b) {
+    // Deque was empty; restore bottom
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  out = buf->get(b);
+
+  if (t == b) {
+    // Last element: race against thieves for it
+    bool const won = top_.compare_exchange_strong(
+      t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+    );
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return won;
+  }
+
+  return true;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(T& out) {
+  auto t = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto const b = bottom_.load(std::memory_order_acquire);
+
+  if (t >= b) {
+    return false;
+  }
+
+  auto buf = buffer_.load(std::memory_order_acquire);
+  auto const elm = buf->get(t);
+
+  if (
+    not top_.compare_exchange_strong(
+      t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+    )
+  ) {
+    return false;
+  }
+
+  out = elm;
+  return true;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::IndexType WorkStealingDeque<T>::size() const {
+  auto const b = bottom_.load(std::memory_order_relaxed);
+  auto const t = top_.load(std::memory_order_relaxed);
+  return b - t;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::IndexType
+WorkStealingDeque<T>::capacity() const {
+  return buffer_.load(std::memory_order_relaxed)->capacity_;
+}
+
+}}} /* end namespace vt::util::container */
+
+#endif /*INCLUDED_VT_UTILS_CONTAINER_WORK_STEALING_DEQUE_IMPL_H*/
@@ -0,0 +1,79 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               diffusion_msgs.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_DIFFUSIONLB_DIFFUSION_MSGS_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_DIFFUSIONLB_DIFFUSION_MSGS_H
+
+#include "vt/config.h"
+#include "vt/messaging/message.h"
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+struct DiffusionLoadMsg : vt::Message {
+  using LoadType = double;
+
+  DiffusionLoadMsg() = default;
+  DiffusionLoadMsg(
+    NodeType in_from_node, LoadType in_load, int32_t in_num_neighbors,
+    bool in_reply
+  ) : from_node_(in_from_node),
+      load_(in_load),
+      num_neighbors_(in_num_neighbors),
+      reply_(in_reply)
+  { }
+
+  NodeType getFromNode() const { return from_node_; }
+  LoadType getLoad() const { return load_; }
+  int32_t getNumNeighbors() const { return num_neighbors_; }
+  bool isReply() const { return reply_; }
+
+private:
+  NodeType from_node_    = uninitialized_destination;
+  LoadType load_         = 0.;
+  int32_t num_neighbors_ = 0;
+  bool reply_            = false;
+};
+
+}}}} /* end namespace vt::vrt::collection::balance */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_DIFFUSIONLB_DIFFUSION_MSGS_H*/
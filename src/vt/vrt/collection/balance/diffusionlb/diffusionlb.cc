@@ -0,0 +1,458 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                diffusionlb.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/diffusionlb/diffusionlb.h"
+#include "vt/vrt/collection/balance/model/load_model.h"
+#include "vt/context/context.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+void DiffusionLB::init(objgroup::proxy::Proxy<DiffusionLB> in_proxy) {
+  proxy_ = in_proxy;
+}
+
+/*static*/ std::unordered_map<std::string, std::string>
+DiffusionLB::getInputKeysWithHelp() {
+  std::unordered_map<std::string, std::string> const keys_help = {
+    {
+      "iters",
+      R"(
+Values: <int>
+Default: 8
+Description:
+  The number of diffusion rounds. In each round every node exchanges its load
+  with its neighbors in the communication graph and decides which objects to
+  move to them. More rounds let load travel further from overloaded nodes.
+)"
+    },
+    {
+      "tolerance",
+      R"(
+Values: <double>
+Default: 0.05
+Description:
+  The allowed imbalance above the average processor load. A node is
+  overloaded when its load exceeds (1 + tolerance) * average, and no object
+  is moved to a node if it would push that node above this bound.
+)"
+    },
+    {
+      "min_gain",
+      R"(
+Values: <double>
+Default: 0.0
+Description:
+  The minimum reduction in off-node communication bytes that an object must
+  gain for it to be moved purely to reduce the edge cut (i.e., when the
+  source node is not overloaded). Raising this reduces migration volume.
+)"
+    },
+    {
+      "refine",
+      R"(
+Values: {true, false}
+Default: true
+Description:
+  Whether to move objects from nodes that are not overloaded in order to
+  reduce the edge cut. When false, objects only move to relieve overloaded
+  nodes (still preferring destinations that reduce the edge cut).
+)"
+    }
+  };
+  return keys_help;
+}
+
+void DiffusionLB::inputParams(balance::SpecEntry* spec) {
+  auto keys_help = getInputKeysWithHelp();
+
+  std::vector<std::string> allowed;
+  for (auto&& elm : keys_help) {
+    allowed.push_back(elm.first);
+  }
+  spec->checkAllowedKeys(allowed);
+  num_iters_ = spec->getOrDefault<int32_t>("iters", num_iters_);
+  tolerance_ = spec->getOrDefault<double>("tolerance", tolerance_);
+  min_gain_  = spec->getOrDefault<double>("min_gain", min_gain_);
+  refine_    = spec->getOrDefault<bool>("refine", refine_);
+
+  vtAbortIf(num_iters_ < 0, "DiffusionLB: iters must be non-negative");
+  vtAbortIf(tolerance_ < 0.0, "DiffusionLB: tolerance must be non-negative");
+}
+
+void DiffusionLB::runLB(TimeType total_load) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  auto const& stats = *getStats();
+  avg_load_ = stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::avg);
+  target_max_load_ = avg_load_ * (1.0 + tolerance_);
+  this_load_ = total_load;
+
+  if (this_node == 0) {
+    vt_print(
+      lb,
+      "DiffusionLB: runLB: iters={}, tolerance={}, min_gain={}, refine={}, "
+      "avg={}\n",
+      num_iters_, tolerance_, min_gain_, refine_, TimeTypeWrapper(avg_load_)
+    );
+    fflush(stdout);
+  }
+
+  if (num_nodes == 1) {
+    return;
+  }
+
+  buildGraph();
+
+  for (int32_t round = 0; round < num_iters_; round++) {
+    exchangeLoads();
+    diffuse(round);
+  }
+
+  for (auto&& move : moves_) {
+    migrateObjectTo(move.first, move.second);
+  }
+}
+
+void DiffusionLB::buildGraph() {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  for (auto obj : *load_model_) {
+    obj_node_[obj] = this_node;
+    edges_[obj];
+    if (obj.isMigratable()) {
+      movable_[obj] = load_model_->getWork(
+        obj, {balance::PhaseOffset::NEXT_PHASE, balance::PhaseOffset::WHOLE_PHASE}
+      );
+    }
+  }
+
+  auto is_local = [this](ObjIDType const& obj) {
+    return edges_.find(obj) != edges_.end();
+  };
+  auto valid_node = [num_nodes](NodeType node) {
+    return node >= 0 and node < num_nodes;
+  };
+
+  // Ring neighbors guarantee load can diffuse even without communication
+  neighbors_.insert((this_node + 1) % num_nodes);
+  neighbors_.insert((this_node + num_nodes - 1) % num_nodes);
+  neighbors_.erase(this_node);
+
+  // Edges are recorded on only one side; make the graph symmetric by sending
+  // each edge with a remote endpoint to the node that holds it
+  std::map<NodeType, std::vector<EdgeType>> remote_edges;
+
+  auto add_edge = [&](ObjIDType const& local, ObjIDType const& other, double b) {
+    if (is_local(other)) {
+      edges_[local].emplace_back(other, b);
+    } else if (valid_node(other.curr_node)) {
+      edges_[local].emplace_back(other, b);
+      obj_node_[other] = other.curr_node;
+      neighbors_.insert(other.curr_node);
+      remote_edges[other.curr_node].emplace_back(
+        other, local, this_node, b
+      );
+    }
+  };
+
+  for (auto&& elm : *comm_data) {
+    auto const& key = elm.first;
+    if (key.cat_ != elm::CommCategory::SendRecv or key.selfEdge()) {
+      continue;
+    }
+    auto const from = key.fromObj();
+    auto const to = key.toObj();
+    auto const bytes = elm.second.bytes;
+    if (is_local(to)) {
+      add_edge(to, from, bytes);
+    }
+    if (is_local(from)) {
+      add_edge(from, to, bytes);
+    }
+  }
+
+  runInEpochCollective("DiffusionLB::buildGraph -> edges", [&]{
+    for (auto&& elm : remote_edges) {
+      proxy_[elm.first].template send<
+        EdgeMsgType, &DiffusionLB::edgesHandler
+      >(elm.second);
+    }
+  });
+
+  vt_debug_print(
+    normal, lb,
+    "DiffusionLB::buildGraph: objs={}, movable={}, neighbors={}\n",
+    edges_.size(), movable_.size(), neighbors_.size()
+  );
+}
+
+void DiffusionLB::edgesHandler(EdgeMsgType* msg) {
+  for (auto&& edge : msg->getTransfer()) {
+    auto const& local = std::get<0>(edge);
+    auto const& other = std::get<1>(edge);
+    auto const other_node = std::get<2>(edge);
+    auto const bytes = std::get<3>(edge);
+
+    auto iter = edges_.find(local);
+    if (iter == edges_.end()) {
+      // the recorded location was stale; the edge cannot be used here
+      continue;
+    }
+    iter->second.emplace_back(other, bytes);
+    obj_node_[other] = other_node;
+    neighbors_.insert(other_node);
+  }
+}
+
+void DiffusionLB::exchangeLoads() {
+  auto const this_node = theContext()->getNode();
+
+  neighbor_info_.clear();
+
+  runInEpochCollective("DiffusionLB::exchangeLoads", [&]{
+    auto const num_neighbors = static_cast<int32_t>(neighbors_.size());
+    for (auto&& node : neighbors_) {
+      proxy_[node].template send<LoadMsgType, &DiffusionLB::loadHandler>(
+        this_node, this_load_, num_neighbors, false
+      );
+    }
+  });
+}
+
+void DiffusionLB::loadHandler(LoadMsgType* msg) {
+  auto const from = msg->getFromNode();
+  auto& info = neighbor_info_[from];
+  info.load_ = msg->getLoad();
+  info.num_neighbors_ = std::max(msg->getNumNeighbors(), 1);
+
+  // Neighbor relations may be one-sided (e.g., ring or stale edges); reply so
+  // both sides have each other's load and treat each other as neighbors
+  if (not msg->isReply()) {
+    neighbors_.insert(from);
+    auto const this_node = theContext()->getNode();
+    auto const num_neighbors = static_cast<int32_t>(neighbors_.size());
+    proxy_[from].template send<LoadMsgType, &DiffusionLB::loadHandler>(
+      this_node, this_load_, num_neighbors, true
+    );
+  }
+}
+
+std::map<NodeType, double> DiffusionLB::commByNode(ObjIDType const& obj) const {
+  std::map<NodeType, double> volume;
+  auto iter = edges_.find(obj);
+  if (iter == edges_.end()) {
+    return volume;
+  }
+  for (auto&& nbr : iter->second) {
+    auto node_iter = obj_node_.find(std::get<0>(nbr));
+    if (node_iter != obj_node_.end()) {
+      volume[node_iter->second] += std::get<1>(nbr);
+    }
+  }
+  return volume;
+}
+
+void DiffusionLB::diffuse(int32_t round) {
+  auto const this_node = theContext()->getNode();
+
+  // Split each neighbor's spare capacity among the nodes that may send to it
+  // this round so that concurrent decisions cannot overload it
+  std::map<NodeType, LoadType> budget;
+  for (auto&& elm : neighbor_info_) {
+    auto const spare = target_max_load_ - elm.second.load_;
+    budget[elm.first] = spare > 0. ? spare / elm.second.num_neighbors_ : 0.;
+  }
+
+  // Deterministic order over the candidates
+  std::vector<ObjIDType> candidates;
+  for (auto&& elm : movable_) {
+    candidates.push_back(elm.first);
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  struct Choice {
+    NodeType dest = uninitialized_destination;
+    double gain = 0.;
+  };
+
+  auto best_dest = [&](ObjIDType const& obj, LoadType load, bool refining) {
+    Choice best;
+    auto volume = commByNode(obj);
+    auto const internal = volume[this_node];
+    for (auto&& elm : budget) {
+      auto const node = elm.first;
+      if (elm.second < load) {
+        continue;
+      }
+      // Alternate the direction of refinement moves each round so two nodes
+      // do not swap objects back and forth
+      if (refining and ((this_node < node) != (round % 2 == 0))) {
+        continue;
+      }
+      auto const gain = volume[node] - internal;
+      if (refining and gain <= min_gain_) {
+        continue;
+      }
+      bool const better =
+        best.dest == uninitialized_destination or gain > best.gain or
+        (gain == best.gain and
+         neighbor_info_[node].load_ < neighbor_info_[best.dest].load_);
+      if (better) {
+        best.dest = node;
+        best.gain = gain;
+      }
+    }
+    return best;
+  };
+
+  std::map<NodeType, LoadType> arrivals;
+  std::map<NodeType, std::vector<LocationType>> locations;
+
+  auto do_move = [&](ObjIDType const& obj, NodeType dest) {
+    auto const load = movable_[obj];
+    movable_.erase(obj);
+    this_load_ -= load;
+    budget[dest] -= load;
+    arrivals[dest] += load;
+    obj_node_[obj] = dest;
+    moves_[obj] = dest;
+
+    // Tell every node holding a neighbor of obj where it went
+    for (auto&& nbr : edges_[obj]) {
+      auto const node = obj_node_[std::get<0>(nbr)];
+      if (node != this_node) {
+        locations[node].emplace_back(obj, dest);
+      }
+    }
+  };
+
+  // Shed load when overloaded, taking the moves that best reduce the cut
+  if (this_load_ > target_max_load_) {
+    std::vector<std::tuple<double, ObjIDType>> ranked;
+    for (auto&& obj : candidates) {
+      auto const choice = best_dest(obj, movable_[obj], false);
+      if (choice.dest != uninitialized_destination) {
+        ranked.emplace_back(choice.gain, obj);
+      }
+    }
+    std::stable_sort(
+      ranked.begin(), ranked.end(),
+      [](std::tuple<double, ObjIDType> const& a,
+         std::tuple<double, ObjIDType> const& b) {
+        return std::get<0>(a) > std::get<0>(b);
+      }
+    );
+    for (auto&& elm : ranked) {
+      if (this_load_ <= target_max_load_) {
+        break;
+      }
+      auto const& obj = std::get<1>(elm);
+      // budgets change as objects are assigned, so re-evaluate
+      auto const choice = best_dest(obj, movable_[obj], false);
+      if (choice.dest != uninitialized_destination) {
+        do_move(obj, choice.dest);
+      }
+    }
+  }
+
+  // Refine the cut with moves that keep both sides within tolerance
+  if (refine_) {
+    auto const floor_load = avg_load_ * (1.0 - tolerance_);
+    for (auto&& obj : candidates) {
+      auto iter = movable_.find(obj);
+      if (iter == movable_.end()) {
+        continue;
+      }
+      auto const load = iter->second;
+      if (this_load_ - load < floor_load) {
+        continue;
+      }
+      auto const choice = best_dest(obj, load, true);
+      if (choice.dest != uninitialized_destination) {
+        do_move(obj, choice.dest);
+      }
+    }
+  }
+
+  vt_debug_print(
+    verbose, lb,
+    "DiffusionLB::diffuse: round={}, load={}, moves={}\n",
+    round, TimeTypeWrapper(this_load_), moves_.size()
+  );
+
+  runInEpochCollective("DiffusionLB::diffuse -> notify", [&]{
+    for (auto&& elm : arrivals) {
+      proxy_[elm.first].template send<
+        ArrivalMsgType, &DiffusionLB::arrivalHandler
+      >(elm.second);
+    }
+    for (auto&& elm : locations) {
+      proxy_[elm.first].template send<
+        LocationMsgType, &DiffusionLB::locationHandler
+      >(elm.second);
+    }
+  });
+}
+
+void DiffusionLB::arrivalHandler(ArrivalMsgType* msg) {
+  this_load_ += msg->getTransfer();
+}
+
+void DiffusionLB::locationHandler(LocationMsgType* msg) {
+  auto const this_node = theContext()->getNode();
+  for (auto&& loc : msg->getTransfer()) {
+    auto const node = std::get<1>(loc);
+    obj_node_[std::get<0>(loc)] = node;
+    if (node != this_node) {
+      neighbors_.insert(node);
+    }
+  }
+}
+
+}}}} /* end namespace vt::vrt::collection::lb */
@@ -0,0 +1,150 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                diffusionlb.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_DIFFUSIONLB_DIFFUSIONLB_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_DIFFUSIONLB_DIFFUSIONLB_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/diffusionlb/diffusion_msgs.h"
+
+#include <map>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/**
+ * \struct DiffusionLB
+ *
+ * \brief A communication-aware, distributed diffusion load balancer.
+ *
+ * The element communication graph recorded by \c NodeStats is made symmetric
+ * and each node learns where the neighbors of its objects live. Then, for a
+ * number of rounds, every node exchanges its load with the nodes it shares
+ * edges with and moves objects to those neighbors:
+ *
+ *  - an overloaded node sheds load to underloaded neighbors, preferring the
+ *    objects and destinations that most reduce the off-node edge cut;
+ *  - any node may move an object to a neighbor that holds more of its
+ *    communication volume (a positive cut gain) as long as the destination
+ *    stays within the imbalance tolerance.
+ *
+ * Each object moves at most once per invocation to bound migration volume,
+ * and the capacity of a destination is split among the nodes that may send
+ * to it in a round so concurrent decisions do not overload it.
+ */
+struct DiffusionLB : BaseLB {
+  using LoadMsgType      = balance::DiffusionLoadMsg;
+  using EdgeType         = std::tuple<ObjIDType, ObjIDType, NodeType, double>;
+  using EdgeMsgType      = TransferMsg<std::vector<EdgeType>>;
+  using LocationType     = std::tuple<ObjIDType, NodeType>;
+  using LocationMsgType  = TransferMsg<std::vector<LocationType>>;
+  using ArrivalMsgType   = TransferMsg<LoadType>;
+  using NeighborListType = std::vector<std::tuple<ObjIDType, double>>;
+
+  /// Most recent load information about a neighboring node
+  struct NeighborInfo {
+    LoadType load_ = 0.;
+    int32_t num_neighbors_ = 1;
+  };
+
+  DiffusionLB() = default;
+  DiffusionLB(DiffusionLB const&) = delete;
+
+  virtual ~DiffusionLB() {}
+
+public:
+  void init(objgroup::proxy::Proxy<DiffusionLB> in_proxy);
+  void runLB(TimeType total_load) override;
+  void inputParams(balance::SpecEntry* spec) override;
+
+  static std::unordered_map<std::string, std::string> getInputKeysWithHelp();
+
+protected:
+  void buildGraph();
+  void exchangeLoads();
+  void diffuse(int32_t round);
+
+  /**
+   * \brief Compute the communication volume between an object and each node
+   * given the currently known object locations
+   *
+   * \param[in] obj the local object
+   *
+   * \return map from node to bytes exchanged with objects on that node
+   */
+  std::map<NodeType, double> commByNode(ObjIDType const& obj) const;
+
+  void edgesHandler(EdgeMsgType* msg);
+  void loadHandler(LoadMsgType* msg);
+  void arrivalHandler(ArrivalMsgType* msg);
+  void locationHandler(LocationMsgType* msg);
+
+private:
+  int32_t num_iters_                                  = 8;
+  double tolerance_                                   = 0.05;
+  double min_gain_                                    = 0.0;
+  bool refine_                                        = true;
+  LoadType avg_load_                                  = 0.;
+  LoadType target_max_load_                           = 0.;
+  LoadType this_load_                                 = 0.;
+  /// Objects that are still on this node and may move
+  std::unordered_map<ObjIDType, LoadType> movable_    = {};
+  /// Symmetric communication edges for each local object
+  std::unordered_map<ObjIDType, NeighborListType> edges_ = {};
+  /// Last known node of every object adjacent to a local object
+  std::unordered_map<ObjIDType, NodeType> obj_node_   = {};
+  /// Nodes sharing at least one edge with this node (plus ring neighbors)
+  std::set<NodeType> neighbors_                       = {};
+  std::map<NodeType, NeighborInfo> neighbor_info_     = {};
+  /// Decided migrations: object to destination
+  std::map<ObjIDType, NodeType> moves_                = {};
+  objgroup::proxy::Proxy<DiffusionLB> proxy_          = {};
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_DIFFUSIONLB_DIFFUSIONLB_H*/
@@ -58,6 +58,8 @@
 #include "vt/vrt/collection/balance/stats_restart_reader.h"
 #include "vt/vrt/collection/balance/zoltanlb/zoltanlb.h"
 #include "vt/vrt/collection/balance/randomlb/randomlb.h"
+#include "vt/vrt/collection/balance/diffusionlb/diffusionlb.h"
+#include "vt/vrt/collection/balance/twolevellb/twolevellb.h"
 #include "vt/vrt/collection/messages/system_create.h"
 #include "vt/vrt/collection/manager.fwd.h"
 #include "vt/utils/memory/memory_usage.h"
@@ -66,8 +68,11 @@
 #include "vt/vrt/collection/balance/model/raw_data.h"
 #include "vt/vrt/collection/balance/model/proposed_reassignment.h"
 #include "vt/phase/phase_manager.h"
+#include "vt/timing/timing.h"
 #include "vt/vrt/collection/manager.h"
 
+#include <algorithm>
+
 namespace vt { namespace vrt { namespace collection { namespace balance {
 
 /*static*/ std::unique_ptr<LBManager> LBManager::construct() {
@@ -83,6 +88,25 @@ namespace vt { namespace vrt { namespace collection { namespace balance {
   return ptr;
 }
 
+LBManager::LBManager() {
+  adaptive_run_count_ = registerCounter(
+    "adaptive_lb_run", "phases where the adaptive policy ran the LB"
+  );
+  adaptive_skip_count_ = registerCounter(
+    "adaptive_lb_skip", "phases where the adaptive policy skipped the LB"
+  );
+  adaptive_imbalance_ = registerGaugeT<double>(
+    "adaptive_lb_imbalance", "predicted max/avg - 1 at each adaptive decision"
+  );
+  adaptive_gain_ = registerGaugeT<double>(
+    "adaptive_lb_gain", "predicted gain over the horizon at each decision",
+    DiagnosticUnit::Seconds
+  );
+  lb_cost_timer_ = registerTimer(
+    "lb_cost", "time spent in the LB strategy and migration"
+  );
+}
+
 LBManager::~LBManager() = default;
 
 LBType LBManager::decideLBToRun(PhaseType phase, bool try_file) {
@@ -120,7 +144,10 @@ LBType LBManager::decideLBToRun(PhaseType phase, bool try_file) {
   } else {
     auto interval = theConfig()->vt_lb_interval;
     vtAssert(interval != 0, "LB Interval must not be 0");
-    if (phase % interval == 1 || (interval == 1 && phase != 0)) {
+    bool const at_interval =
+      phase % interval == 1 || (interval == 1 && phase != 0);
+    if (at_interval and
+        (not theConfig()->vt_lb_adaptive or adaptiveShouldRun(phase))) {
       bool name_match = false;
       for (auto&& elm : get_lb_names()) {
         if (elm.second == theConfig()->vt_lb_name) {
@@ -170,8 +197,80 @@ LBManager::makeLB() {
   return base_proxy;
 }
 
+bool LBManager::adaptiveShouldRun(PhaseType phase) {
+  using ReduceOp = collective::PlusOp<std::vector<balance::LoadData>>;
+
+  runInEpochCollective("LBManager::adaptiveShouldRun -> updateLoads", [=] {
+    model_->updateLoads(phase);
+  });
+
+  TimeType load = 0.;
+  for (auto elm : *model_) {
+    load += model_->getWork(
+      elm, {balance::PhaseOffset::NEXT_PHASE, balance::PhaseOffset::WHOLE_PHASE}
+    );
+  }
+
+  // The cost is local wall time; reduce it so every node decides alike
+  std::vector<LoadData> lstats;
+  lstats.emplace_back(LoadData{lb::Statistic::P_l, load});
+  lstats.emplace_back(LoadData{lb::Statistic::P_t, lb_cost_});
+
+  runInEpochCollective("LBManager::adaptiveShouldRun -> reduce", [&] {
+    auto cb = vt::theCB()->makeBcast<
+      LBManager, StatsMsgType, &LBManager::adaptiveStatsHandler
+    >(proxy_);
+    auto msg = makeMessage<StatsMsgType>(std::move(lstats));
+    proxy_.template reduce<ReduceOp>(msg,cb);
+  });
+
+  auto const horizon = theConfig()->vt_lb_adaptive_horizon;
+  auto const excess = adaptive_max_ - adaptive_avg_;
+  auto const imb = adaptive_avg_ > 0. ? adaptive_max_ / adaptive_avg_ - 1. : 0.;
+  auto const gain = horizon * lb_efficiency_ * excess;
+  bool const run = gain > adaptive_cost_;
+
+  adaptive_imbalance_.update(imb);
+  adaptive_gain_.update(gain);
+  if (run) {
+    adaptive_run_count_.increment(1);
+  } else {
+    adaptive_skip_count_.increment(1);
+    // The efficiency is only measured when the LB runs, so recover it while
+    // skipping: otherwise one ineffective invocation could keep the predicted
+    // gain below the cost for good. Every node skips alike, so it stays
+    // consistent across nodes.
+    lb_efficiency_ = 0.5 * lb_efficiency_ + 0.5;
+  }
+
+  if (theContext()->getNode() == 0 and not theConfig()->vt_lb_quiet) {
+    vt_print(
+      lb,
+      "LBManager: adaptive: phase={}, imb={:.3f}, predicted gain={:.6f}s "
+      "over {} phases (efficiency={:.2f}), cost={:.6f}s: {}\n",
+      phase, imb, gain, horizon, lb_efficiency_, adaptive_cost_,
+      run ? "running LB" : "skipping LB"
+    );
+  }
+
+  return run;
+}
+
+void LBManager::adaptiveStatsHandler(StatsMsgType* msg) {
+  for (auto&& st : msg->getConstVal()) {
+    if (st.stat_ == lb::Statistic::P_l) {
+      adaptive_max_ = st.max();
+      adaptive_avg_ = st.avg();
+    } else if (st.stat_ == lb::Statistic::P_t) {
+      adaptive_cost_ = st.max();
+    }
+  }
+}
+
 void
 LBManager::runLB(LBProxyType base_proxy, PhaseType phase) {
+  auto const start_time = timing::getCurrentTime();
+
   runInEpochCollective("LBManager::runLB -> updateLoads", [=] {
     model_->updateLoads(phase);
   });
@@ -187,6 +286,9 @@ LBManager::runLB(LBProxyType base_proxy, PhaseType phase) {
     comm = &iter->second;
   }
 
+  auto const max_before = stats[lb::Statistic::P_l][lb::StatisticQuantity::max];
+  auto const avg_before = stats[lb::Statistic::P_l][lb::StatisticQuantity::avg];
+
   vt_debug_print(terse, lb, "LBManager: running strategy\n");
 
   lb::BaseLB* strat = base_proxy.get();
@@ -206,6 +308,21 @@ LBManager::runLB(LBProxyType base_proxy, PhaseType phase) {
     theCollection()->getTypelessHolder().invokeAllGroupConstructors();
   }
 
+  // Record what this invocation cost and achieved for the adaptive policy;
+  // the statistics are global so every node computes the same efficiency
+  auto const end_time = timing::getCurrentTime();
+  lb_cost_ = end_time - start_time;
+  lb_cost_timer_.update(start_time, end_time);
+
+  auto const max_after = stats[lb::Statistic::P_l][lb::StatisticQuantity::max];
+  if (max_before > avg_before) {
+    auto const measured = std::max(
+      0., std::min(1., (max_before - max_after) / (max_before - avg_before))
+    );
+    // Smooth so that one ineffective invocation does not disable the LB
+    lb_efficiency_ = 0.5 * lb_efficiency_ + 0.5 * measured;
+  }
+
   vt_debug_print(
     terse, lb,
     "LBManager: finished migrations\n"
@@ -240,15 +357,24 @@ void LBManager::startLB(PhaseType phase, LBType lb) {
     return;
   }
 
+  lb_instances_["chosen"] = makeLB(lb);
+
+  LBProxyType base_proxy = lb_instances_["chosen"];
+  runLB(base_proxy, phase);
+}
+
+LBManager::LBProxyType LBManager::makeLB(LBType lb) {
   switch (lb) {
-  case LBType::HierarchicalLB: lb_instances_["chosen"] = makeLB<lb::HierarchicalLB>(); break;
-  case LBType::GreedyLB:       lb_instances_["chosen"] = makeLB<lb::GreedyLB>();       break;
-  case LBType::RotateLB:       lb_instances_["chosen"] = makeLB<lb::RotateLB>();       break;
-  case LBType::TemperedLB:     lb_instances_["chosen"] = makeLB<lb::TemperedLB>();     break;
-  case LBType::StatsMapLB:     lb_instances_["chosen"] = makeLB<lb::StatsMapLB>();     break;
-  case LBType::RandomLB:       lb_instances_["chosen"] = makeLB<lb::RandomLB>();       break;
+  case LBType::HierarchicalLB: return makeLB<lb::HierarchicalLB>();
+  case LBType::GreedyLB:       return makeLB<lb::GreedyLB>();
+  case LBType::RotateLB:       return makeLB<lb::RotateLB>();
+  case LBType::TemperedLB:     return makeLB<lb::TemperedLB>();
+  case LBType::StatsMapLB:     return makeLB<lb::StatsMapLB>();
+  case LBType::RandomLB:       return makeLB<lb::RandomLB>();
+  case LBType::DiffusionLB:    return makeLB<lb::DiffusionLB>();
+  case LBType::TwoLevelLB:     return makeLB<lb::TwoLevelLB>();
 #   if vt_check_enabled(zoltan)
-  case LBType::ZoltanLB:       lb_instances_["chosen"] = makeLB<lb::ZoltanLB>();       break;
+  case LBType::ZoltanLB:       return makeLB<lb::ZoltanLB>();
 #   endif
   case LBType::NoLB:
     vtAssert(false, "LBType::NoLB is not a valid LB for collectiveImpl");
@@ -257,9 +383,49 @@ void LBManager::startLB(PhaseType phase, LBType lb) {
     vtAssert(false, "A valid LB must be passed to collectiveImpl");
     break;
   }
+  return LBProxyType{};
+}
 
-  LBProxyType base_proxy = lb_instances_["chosen"];
-  runLB(base_proxy, phase);
+LBProposal LBManager::proposeLB(
+  PhaseType phase, LBType lb, std::shared_ptr<LoadModel> model,
+  elm::CommMapType const& comm
+) {
+  vtAssert(lb != LBType::NoLB, "A valid LB must be passed to proposeLB");
+
+  LBProposal proposal;
+
+  runInEpochCollective("LBManager::proposeLB -> updateLoads", [=] {
+    model->updateLoads(phase);
+  });
+
+  runInEpochCollective("LBManager::proposeLB -> computeStats", [&] {
+    computeStatistics(model, false, phase, &comm);
+  });
+  proposal.before_ = stats;
+
+  auto base_proxy = makeLB(lb);
+  lb::BaseLB* strat = base_proxy.get();
+
+  auto const start_time = timing::getCurrentTime();
+  proposal.reassignment_ = strat->startLB(
+    phase, base_proxy, model.get(), stats, comm, total_load
+  );
+  proposal.strategy_time_ = timing::getCurrentTime() - start_time;
+
+  auto proposed = std::make_shared<ProposedReassignment>(
+    model, proposal.reassignment_
+  );
+  runInEpochCollective("LBManager::proposeLB -> computeStats", [&] {
+    computeStatistics(proposed, false, phase, &comm);
+  });
+  proposal.after_ = stats;
+
+  if (destroy_lb_ != nullptr) {
+    destroy_lb_();
+    destroy_lb_ = nullptr;
+  }
+
+  return proposal;
 }
 
 /*static*/
@@ -292,6 +458,12 @@ void LBManager::printLBArgsHelp(LBType lb) {
   case LBType::RandomLB:
     help = lb::RandomLB::getInputKeysWithHelp();
     break;
+  case LBType::DiffusionLB:
+    help = lb::DiffusionLB::getInputKeysWithHelp();
+    break;
+  case LBType::TwoLevelLB:
+    help = lb::TwoLevelLB::getInputKeysWithHelp();
+    break;
   case LBType::StatsMapLB:
     help = lb::StatsMapLB::getInputKeysWithHelp();
     break;
@@ -426,7 +598,8 @@ balance::LoadData reduceVec(
 }
 
 void LBManager::computeStatistics(
-  std::shared_ptr<LoadModel> model, bool comm_collectives, PhaseType phase
+  std::shared_ptr<LoadModel> model, bool comm_collectives, PhaseType phase,
+  elm::CommMapType const* comm
 ) {
   vt_debug_print(
     normal, lb,
@@ -450,10 +623,12 @@ void LBManager::computeStatistics(
   }
 
   elm::CommMapType empty_comm;
-  elm::CommMapType const* comm_data = &empty_comm;
-  auto iter = theNodeStats()->getNodeComm()->find(phase);
-  if (iter != theNodeStats()->getNodeComm()->end()) {
-    comm_data = &iter->second;
+  elm::CommMapType const* comm_data = comm != nullptr ? comm : &empty_comm;
+  if (comm == nullptr) {
+    auto iter = theNodeStats()->getNodeComm()->find(phase);
+    if (iter != theNodeStats()->getNodeComm()->end()) {
+      comm_data = &iter->second;
+    }
   }
 
   std::vector<LoadData> lstats;
@@ -62,6 +62,22 @@ namespace vt { namespace vrt { namespace collection { namespace balance {
 struct LoadModel;
 struct NodeStatsMsg;
 
+/**
+ * \struct LBProposal
+ *
+ * \brief The outcome of running a load balancer without applying its
+ * reassignment: the statistics before and after along with the strategy time
+ */
+struct LBProposal {
+  using QuantityType     = std::map<lb::StatisticQuantity, double>;
+  using StatisticMapType = std::unordered_map<lb::Statistic, QuantityType>;
+
+  std::shared_ptr<const Reassignment> reassignment_ = nullptr;
+  StatisticMapType before_;        /**< Statistics over the input loads */
+  StatisticMapType after_;         /**< Statistics if reassignment applied */
+  TimeType strategy_time_ = 0.;    /**< Time spent in the strategy */
+};
+
 /**
  * \struct LBManager
  *
@@ -80,7 +96,7 @@ struct LBManager : runtime::component::Component<LBManager> {
   /**
    * \internal \brief System call to construct a \c LBManager
    */
-  LBManager() = default;
+  LBManager();
   LBManager(LBManager const&) = delete;
   LBManager(LBManager&&) = default;
   virtual ~LBManager();
@@ -96,6 +112,11 @@ public:
    * \internal
    * \brief Decide which LB to invoke given a certain phase
    *
+   * With \c --vt_lb_adaptive, deciding at an LB interval phase runs
+   * \c adaptiveShouldRun, which is collective: it must then be called on all
+   * nodes for the same phase. The result is cached per phase, so only the
+   * first call for a phase participates.
+   *
    * \param[in] phase the phase in question
    * \param[in] try_file whether to try to read from file
    *
@@ -140,6 +161,27 @@ public:
    */
   void startLB(PhaseType phase, LBType lb);
 
+  /**
+   * \brief Collectively run a load balancer over a load model and
+   * communication graph that are not backed by live objects, without applying
+   * the resulting reassignment.
+   *
+   * This is used to evaluate strategies offline against recorded LB
+   * statistics. The strategy reads its arguments from \c --vt_lb_args or
+   * \c --vt_lb_file_name exactly as it would during a real run.
+   *
+   * \param[in] phase the phase of \c model to balance
+   * \param[in] lb the load balancer to run
+   * \param[in] model the load model over the recorded loads
+   * \param[in] comm the recorded communication graph for \c phase
+   *
+   * \return the proposed reassignment and statistics
+   */
+  LBProposal proposeLB(
+    PhaseType phase, LBType lb, std::shared_ptr<LoadModel> model,
+    elm::CommMapType const& comm
+  );
+
   /**
    * \internal
    * \brief Print documentation for LB args for the chosen LB
@@ -195,7 +237,17 @@ public:
       | base_model_
       | model_
       | lb_instances_
-      | stats;
+      | stats
+      | lb_cost_
+      | lb_efficiency_
+      | adaptive_max_
+      | adaptive_avg_
+      | adaptive_cost_
+      | adaptive_run_count_
+      | adaptive_skip_count_
+      | adaptive_imbalance_
+      | adaptive_gain_
+      | lb_cost_timer_;
   }
 
 protected:
@@ -209,13 +261,41 @@ protected:
   template <typename LB>
   LBProxyType makeLB();
 
+  /**
+   * \internal \brief Collectively construct a new load balancer by type
+   *
+   * \param[in] lb the type of strategy to instantiate
+   *
+   * \return objgroup proxy to the new load balancer
+   */
+  LBProxyType makeLB(LBType lb);
+
   void runLB(LBProxyType base_proxy, PhaseType phase);
 
+  /**
+   * \internal \brief Collectively decide whether running the LB this phase
+   * pays off.
+   *
+   * The imbalance predicted by the load model is reduced across nodes and the
+   * gain of balancing, \c (max - avg) over the next
+   * \c --vt_lb_adaptive_horizon phases scaled by how much of the excess the
+   * last invocation actually removed, is compared against the measured cost
+   * (strategy plus migration time) of the last invocation. Each skipped
+   * phase moves the efficiency halfway back to 1 so that the LB is retried.
+   *
+   * \param[in] phase the phase that just completed
+   *
+   * \return whether to run the LB
+   */
+  bool adaptiveShouldRun(PhaseType phase);
+
 private:
   void computeStatistics(
-    std::shared_ptr<LoadModel> model, bool comm_collectives, PhaseType phase
+    std::shared_ptr<LoadModel> model, bool comm_collectives, PhaseType phase,
+    elm::CommMapType const* comm = nullptr
   );
   void statsHandler(StatsMsgType* msg);
+  void adaptiveStatsHandler(StatsMsgType* msg);
   bool isCollectiveComm(elm::CommCategory cat) const;
 
 private:
@@ -228,6 +308,18 @@ private:
   std::unordered_map<std::string, LBProxyType> lb_instances_;
   StatisticMapType stats;
   TimeType total_load = 0.;
+  /// Wall time of the last LB invocation on this node, including migration
+  TimeType lb_cost_                        = 0.;
+  /// Fraction of the excess load (max - avg) the last invocation removed
+  double lb_efficiency_                    = 1.;
+  TimeType adaptive_max_                   = 0.;
+  TimeType adaptive_avg_                   = 0.;
+  TimeType adaptive_cost_                  = 0.;
+  diagnostic::Counter adaptive_run_count_;
+  diagnostic::Counter adaptive_skip_count_;
+  diagnostic::GaugeT<double> adaptive_imbalance_;
+  diagnostic::GaugeT<double> adaptive_gain_;
+  diagnostic::Timer lb_cost_timer_;
 };
 
 }}}} /* end namespace vt::vrt::collection::balance */
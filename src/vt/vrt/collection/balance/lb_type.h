@@ -63,6 +63,8 @@ enum struct LBType : int8_t {
   , ZoltanLB         = 6
 # endif
   , RandomLB         = 7
+  , DiffusionLB      = 8
+  , TwoLevelLB       = 9
 };
 
 }}}} /* end namespace vt::vrt::collection::balance */
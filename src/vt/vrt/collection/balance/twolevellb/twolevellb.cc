@@ -0,0 +1,493 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                twolevellb.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/twolevellb/twolevellb.h"
+#include "vt/vrt/collection/balance/model/load_model.h"
+#include "vt/context/context.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+void TwoLevelLB::init(objgroup::proxy::Proxy<TwoLevelLB> in_proxy) {
+  proxy_ = in_proxy;
+}
+
+/*static*/ std::unordered_map<std::string, std::string>
+TwoLevelLB::getInputKeysWithHelp() {
+  std::unordered_map<std::string, std::string> const keys_help = {
+    {
+      "inter_threshold",
+      R"(
+Values: <double>
+Default: 0.1
+Description:
+  The inter-host imbalance, max(host load per rank) / avg(load per rank) - 1,
+  above which load is moved across hosts. Below it only cheap intra-host
+  migrations are performed.
+)"
+    },
+    {
+      "intra_tolerance",
+      R"(
+Values: <double>
+Default: 0.05
+Description:
+  The allowed imbalance within a host. Ranks on a host are rebalanced until
+  the most loaded one is within (1 + intra_tolerance) of the host average or
+  no further migration reduces it.
+)"
+    },
+    {
+      "inter_cost",
+      R"(
+Values: <double>
+Default: 4.0
+Description:
+  The cost of migrating an object across hosts relative to migrating it
+  within a host. Reported as part of the weighted migration cost; donor hosts
+  cover their quota with the fewest objects to minimize it.
+)"
+    },
+    {
+      "ranks_per_host",
+      R"(
+Values: <int>
+Default: 0
+Description:
+  When positive, treat consecutive blocks of this many ranks as a host
+  instead of using the shared-memory topology detected at startup. Useful to
+  emulate multi-host runs on a single machine.
+)"
+    }
+  };
+  return keys_help;
+}
+
+void TwoLevelLB::inputParams(balance::SpecEntry* spec) {
+  auto keys_help = getInputKeysWithHelp();
+
+  std::vector<std::string> allowed;
+  for (auto&& elm : keys_help) {
+    allowed.push_back(elm.first);
+  }
+  spec->checkAllowedKeys(allowed);
+  inter_threshold_ = spec->getOrDefault<double>(
+    "inter_threshold", inter_threshold_
+  );
+  intra_tolerance_ = spec->getOrDefault<double>(
+    "intra_tolerance", intra_tolerance_
+  );
+  inter_cost_ = spec->getOrDefault<double>("inter_cost", inter_cost_);
+  ranks_per_host_ = spec->getOrDefault<int32_t>(
+    "ranks_per_host", ranks_per_host_
+  );
+
+  vtAbortIf(
+    ranks_per_host_ < 0, "TwoLevelLB: ranks_per_host must be non-negative"
+  );
+}
+
+NodeType TwoLevelLB::hostOf(NodeType node) const {
+  if (ranks_per_host_ > 0) {
+    return static_cast<NodeType>(node / ranks_per_host_);
+  }
+  return theContext()->getHost(node);
+}
+
+NodeType TwoLevelLB::leaderOf(NodeType host) const {
+  return leaders_[host];
+}
+
+void TwoLevelLB::setupTopology() {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  if (ranks_per_host_ > 0) {
+    num_hosts_ = static_cast<NodeType>(
+      (num_nodes + ranks_per_host_ - 1) / ranks_per_host_
+    );
+  } else {
+    num_hosts_ = theContext()->getNumHosts();
+  }
+
+  leaders_.assign(num_hosts_, uninitialized_destination);
+  for (NodeType node = num_nodes - 1; node >= 0; node--) {
+    leaders_[hostOf(node)] = node;
+  }
+
+  this_host_ = hostOf(this_node);
+  is_leader_ = leaderOf(this_host_) == this_node;
+}
+
+void TwoLevelLB::runLB(TimeType total_load) {
+  auto const this_node = theContext()->getNode();
+
+  setupTopology();
+
+  rank_info_.clear();
+  outgoing_.clear();
+  incoming_.clear();
+  host_loads_.clear();
+  summaries_.clear();
+  assignments_.clear();
+  inter_triggered_ = false;
+  inter_imb_before_ = 0.;
+
+  ObjLoadList objs;
+  for (auto obj : *load_model_) {
+    if (obj.isMigratable()) {
+      objs.emplace_back(
+        obj, load_model_->getWork(
+          obj, {balance::PhaseOffset::NEXT_PHASE, balance::PhaseOffset::WHOLE_PHASE}
+        )
+      );
+    }
+  }
+
+  runInEpochCollective("TwoLevelLB::runLB -> gather", [&]{
+    proxy_[leaderOf(this_host_)].template send<
+      RankInfoMsg, &TwoLevelLB::rankInfoHandler
+    >(RankInfoType{this_node, total_load, objs});
+  });
+
+  runInEpochCollective("TwoLevelLB::runLB -> host loads", [&]{
+    if (is_leader_) {
+      LoadType host_load = 0.;
+      for (auto&& elm : rank_info_) {
+        host_load += std::get<0>(elm.second);
+      }
+      auto const num_ranks = static_cast<int32_t>(rank_info_.size());
+      proxy_[0].template send<HostLoadMsg, &TwoLevelLB::hostLoadHandler>(
+        HostLoadType{this_host_, host_load, num_ranks}
+      );
+    }
+  });
+
+  runInEpochCollective("TwoLevelLB::runLB -> inter-host", [&]{
+    if (this_node == 0) {
+      planInterHost();
+    }
+  });
+
+  runInEpochCollective("TwoLevelLB::runLB -> intra-host", [&]{
+    if (is_leader_) {
+      balanceHost();
+    }
+  });
+
+  if (this_node == 0) {
+    double intra_before = 0., intra_after = 0., max_per_rank = 0.;
+    LoadType total = 0.;
+    int32_t num_ranks = 0, intra_moves = 0, inter_moves = 0;
+    for (auto&& summary : summaries_) {
+      intra_before = std::max(intra_before, summary.imb_before_);
+      intra_after = std::max(intra_after, summary.imb_after_);
+      if (summary.num_ranks_ > 0) {
+        max_per_rank = std::max(
+          max_per_rank, summary.load_after_ / summary.num_ranks_
+        );
+      }
+      total += summary.load_after_;
+      num_ranks += summary.num_ranks_;
+      intra_moves += summary.intra_moves_;
+      inter_moves += summary.inter_moves_;
+    }
+    auto const avg = num_ranks > 0 ? total / num_ranks : 0.;
+    auto const inter_after = avg > 0. ? max_per_rank / avg - 1. : 0.;
+    vt_print(
+      lb,
+      "TwoLevelLB: hosts={}, inter-host imbalance {:.3f} -> {:.3f} ({}), "
+      "max intra-host imbalance {:.3f} -> {:.3f}, migrations: intra={}, "
+      "inter={}, weighted cost={}\n",
+      num_hosts_, inter_imb_before_, inter_after,
+      inter_triggered_ ? "rebalanced" : "below threshold",
+      intra_before, intra_after, intra_moves, inter_moves,
+      intra_moves + inter_cost_ * inter_moves
+    );
+  }
+
+  for (auto&& assign : assignments_) {
+    migrateObjectTo(std::get<0>(assign), std::get<1>(assign));
+  }
+}
+
+void TwoLevelLB::rankInfoHandler(RankInfoMsg* msg) {
+  auto const& info = msg->getTransfer();
+  rank_info_[std::get<0>(info)] = std::make_tuple(
+    std::get<1>(info), std::get<2>(info)
+  );
+}
+
+void TwoLevelLB::hostLoadHandler(HostLoadMsg* msg) {
+  auto const& info = msg->getTransfer();
+  host_loads_[std::get<0>(info)] = std::make_tuple(
+    std::get<1>(info), std::get<2>(info)
+  );
+}
+
+void TwoLevelLB::planInterHost() {
+  LoadType total = 0.;
+  int32_t num_ranks = 0;
+  double max_per_rank = 0.;
+  for (auto&& elm : host_loads_) {
+    auto const load = std::get<0>(elm.second);
+    auto const n = std::get<1>(elm.second);
+    total += load;
+    num_ranks += n;
+    max_per_rank = std::max(max_per_rank, n > 0 ? load / n : 0.);
+  }
+  auto const avg_per_rank = num_ranks > 0 ? total / num_ranks : 0.;
+  inter_imb_before_ = avg_per_rank > 0. ? max_per_rank / avg_per_rank - 1. : 0.;
+  inter_triggered_ = num_hosts_ > 1 and inter_imb_before_ > inter_threshold_;
+
+  if (not inter_triggered_) {
+    return;
+  }
+
+  // Hosts may have different numbers of ranks, so each host's fair share is
+  // proportional to its rank count
+  using AmountType = std::tuple<LoadType, NodeType>;
+  std::vector<AmountType> donors, receivers;
+  for (auto&& elm : host_loads_) {
+    auto const excess =
+      std::get<0>(elm.second) - avg_per_rank * std::get<1>(elm.second);
+    if (excess > 0.) {
+      donors.emplace_back(excess, elm.first);
+    } else if (excess < 0.) {
+      receivers.emplace_back(-excess, elm.first);
+    }
+  }
+  std::sort(donors.rbegin(), donors.rend());
+  std::sort(receivers.rbegin(), receivers.rend());
+
+  std::map<NodeType, std::vector<QuotaType>> quotas;
+  std::size_t r = 0;
+  for (auto&& donor : donors) {
+    auto remaining = std::get<0>(donor);
+    while (remaining > 0. and r < receivers.size()) {
+      auto& recv = receivers[r];
+      auto const amount = std::min(remaining, std::get<0>(recv));
+      quotas[std::get<1>(donor)].emplace_back(
+        leaderOf(std::get<1>(recv)), amount
+      );
+      remaining -= amount;
+      std::get<0>(recv) -= amount;
+      if (std::get<0>(recv) <= 0.) {
+        r++;
+      }
+    }
+  }
+
+  for (auto&& elm : quotas) {
+    proxy_[leaderOf(elm.first)].template send<
+      QuotaMsg, &TwoLevelLB::quotaHandler
+    >(elm.second);
+  }
+}
+
+void TwoLevelLB::quotaHandler(QuotaMsg* msg) {
+  // Every off-host migration costs inter_cost_, so cover each quota with the
+  // fewest objects: consider the largest ones first
+  std::vector<std::tuple<LoadType, ObjIDType, NodeType>> candidates;
+  for (auto&& elm : rank_info_) {
+    for (auto&& obj : std::get<1>(elm.second)) {
+      if (std::get<1>(obj) > 0.) {
+        candidates.emplace_back(std::get<1>(obj), std::get<0>(obj), elm.first);
+      }
+    }
+  }
+  std::sort(candidates.rbegin(), candidates.rend());
+
+  for (auto&& quota : msg->getTransfer()) {
+    auto remaining = std::get<1>(quota);
+    std::vector<IncomingType> sending;
+    for (auto&& c : candidates) {
+      if (remaining <= 0.) {
+        break;
+      }
+      auto const load = std::get<0>(c);
+      auto const& obj = std::get<1>(c);
+      if (load > remaining or outgoing_.find(obj) != outgoing_.end()) {
+        continue;
+      }
+      outgoing_.insert(obj);
+      remaining -= load;
+      sending.emplace_back(obj, load, std::get<2>(c));
+    }
+
+    if (sending.size() > 0) {
+      proxy_[std::get<0>(quota)].template send<
+        IncomingMsg, &TwoLevelLB::incomingHandler
+      >(sending);
+    }
+  }
+}
+
+void TwoLevelLB::incomingHandler(IncomingMsg* msg) {
+  auto const& in = msg->getTransfer();
+  incoming_.insert(incoming_.end(), in.begin(), in.end());
+}
+
+void TwoLevelLB::balanceHost() {
+  std::map<NodeType, LoadType> load;
+  std::map<NodeType, ObjLoadList> resident;
+  LoadType load_before = 0.;
+  LoadType max_before = 0.;
+  for (auto&& elm : rank_info_) {
+    auto const rank = elm.first;
+    auto rank_load = std::get<0>(elm.second);
+    load_before += rank_load;
+    max_before = std::max(max_before, rank_load);
+    for (auto&& obj : std::get<1>(elm.second)) {
+      if (outgoing_.find(std::get<0>(obj)) != outgoing_.end()) {
+        rank_load -= std::get<1>(obj);
+      } else {
+        resident[rank].push_back(obj);
+      }
+    }
+    load[rank] = rank_load;
+  }
+
+  if (load.empty()) {
+    return;
+  }
+
+  auto by_load = [](
+    std::pair<NodeType const, LoadType> const& a,
+    std::pair<NodeType const, LoadType> const& b
+  ) { return a.second < b.second; };
+
+  // Assignments grouped by the rank that currently holds the object
+  std::map<NodeType, std::vector<AssignType>> assign;
+
+  // Incoming objects migrate regardless, so place them first on the least
+  // loaded ranks at no additional cost
+  std::sort(
+    incoming_.begin(), incoming_.end(),
+    [](IncomingType const& a, IncomingType const& b) {
+      return std::get<1>(a) > std::get<1>(b);
+    }
+  );
+  for (auto&& in : incoming_) {
+    auto dest = std::min_element(load.begin(), load.end(), by_load)->first;
+    load[dest] += std::get<1>(in);
+    assign[std::get<2>(in)].emplace_back(std::get<0>(in), dest);
+  }
+
+  LoadType total = 0.;
+  for (auto&& elm : load) {
+    total += elm.second;
+  }
+  auto const n = static_cast<double>(load.size());
+  auto const avg = total / n;
+  auto const target = avg * (1. + intra_tolerance_);
+
+  for (auto&& elm : resident) {
+    std::sort(
+      elm.second.begin(), elm.second.end(),
+      [](ObjLoadType const& a, ObjLoadType const& b) {
+        return std::get<1>(a) > std::get<1>(b);
+      }
+    );
+  }
+
+  // Move the largest object from the most loaded rank to the least loaded one
+  // that lowers the pair's maximum; each object moves at most once
+  int32_t intra_moves = 0;
+  while (true) {
+    auto max_iter = std::max_element(load.begin(), load.end(), by_load);
+    auto min_iter = std::min_element(load.begin(), load.end(), by_load);
+    if (max_iter->second <= target or max_iter->first == min_iter->first) {
+      break;
+    }
+    auto const gap = max_iter->second - min_iter->second;
+    auto& objs = resident[max_iter->first];
+    auto iter = std::find_if(
+      objs.begin(), objs.end(), [gap](ObjLoadType const& obj) {
+        return std::get<1>(obj) > 0. and std::get<1>(obj) < gap;
+      }
+    );
+    if (iter == objs.end()) {
+      break;
+    }
+    auto const obj_load = std::get<1>(*iter);
+    assign[max_iter->first].emplace_back(std::get<0>(*iter), min_iter->first);
+    max_iter->second -= obj_load;
+    min_iter->second += obj_load;
+    objs.erase(iter);
+    intra_moves++;
+  }
+
+  for (auto&& elm : assign) {
+    proxy_[elm.first].template send<AssignMsg, &TwoLevelLB::assignHandler>(
+      elm.second
+    );
+  }
+
+  auto const max_after =
+    std::max_element(load.begin(), load.end(), by_load)->second;
+  auto const avg_before = load_before / n;
+
+  HostSummary summary;
+  summary.load_after_ = total;
+  summary.num_ranks_ = static_cast<int32_t>(load.size());
+  summary.imb_before_ = avg_before > 0. ? max_before / avg_before - 1. : 0.;
+  summary.imb_after_ = avg > 0. ? max_after / avg - 1. : 0.;
+  summary.intra_moves_ = intra_moves;
+  summary.inter_moves_ = static_cast<int32_t>(outgoing_.size());
+  proxy_[0].template send<SummaryMsg, &TwoLevelLB::summaryHandler>(summary);
+}
+
+void TwoLevelLB::assignHandler(AssignMsg* msg) {
+  auto const& in = msg->getTransfer();
+  assignments_.insert(assignments_.end(), in.begin(), in.end());
+}
+
+void TwoLevelLB::summaryHandler(SummaryMsg* msg) {
+  summaries_.push_back(msg->getTransfer());
+}
+
+}}}} /* end namespace vt::vrt::collection::lb */
@@ -0,0 +1,170 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 twolevellb.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_TWOLEVELLB_TWOLEVELLB_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_TWOLEVELLB_TWOLEVELLB_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/baselb/baselb.h"
+
+#include <map>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/**
+ * \struct TwoLevelLB
+ *
+ * \brief A topology-aware load balancer that balances within each host
+ * (shared-memory node) every invocation and across hosts only when the
+ * inter-host imbalance exceeds a threshold.
+ *
+ * Each rank sends its migratable objects to the leader (lowest rank) of its
+ * host. Leaders report host loads to node 0, which decides whether an
+ * inter-host step is warranted and, if so, how much load each overloaded host
+ * should send to each underloaded one. Donor leaders pick the fewest objects
+ * that cover their quota since every off-host migration is weighted by
+ * \c inter_cost. Every leader then places incoming objects (which must move
+ * anyway) on its least loaded ranks before rebalancing the remaining ranks
+ * on the host with cheap intra-host migrations.
+ */
+struct TwoLevelLB : BaseLB {
+  using ObjLoadType    = std::tuple<ObjIDType, LoadType>;
+  using ObjLoadList    = std::vector<ObjLoadType>;
+  /// The objects and total load of a rank, sent to its host leader
+  using RankInfoType   = std::tuple<NodeType, LoadType, ObjLoadList>;
+  using RankInfoMsg    = TransferMsg<RankInfoType>;
+  /// Host index, host load, and number of ranks, sent to node 0
+  using HostLoadType   = std::tuple<NodeType, LoadType, int32_t>;
+  using HostLoadMsg    = TransferMsg<HostLoadType>;
+  /// Receiver host leader and the amount of load to send to it
+  using QuotaType      = std::tuple<NodeType, LoadType>;
+  using QuotaMsg       = TransferMsg<std::vector<QuotaType>>;
+  /// An object leaving its host: id, load, and current rank
+  using IncomingType   = std::tuple<ObjIDType, LoadType, NodeType>;
+  using IncomingMsg    = TransferMsg<std::vector<IncomingType>>;
+  using AssignType     = std::tuple<ObjIDType, NodeType>;
+  using AssignMsg      = TransferMsg<std::vector<AssignType>>;
+
+  /// Per-host outcome of the intra-host step, reported to node 0
+  struct HostSummary {
+    LoadType load_after_ = 0.;
+    int32_t num_ranks_ = 0;
+    double imb_before_ = 0.;
+    double imb_after_ = 0.;
+    int32_t intra_moves_ = 0;
+    int32_t inter_moves_ = 0;
+
+    template <typename SerializerT>
+    void serialize(SerializerT& s) {
+      s | load_after_ | num_ranks_ | imb_before_ | imb_after_
+        | intra_moves_ | inter_moves_;
+    }
+  };
+  using SummaryMsg = TransferMsg<HostSummary>;
+
+  TwoLevelLB() = default;
+  TwoLevelLB(TwoLevelLB const&) = delete;
+
+  virtual ~TwoLevelLB() {}
+
+public:
+  void init(objgroup::proxy::Proxy<TwoLevelLB> in_proxy);
+  void runLB(TimeType total_load) override;
+  void inputParams(balance::SpecEntry* spec) override;
+
+  static std::unordered_map<std::string, std::string> getInputKeysWithHelp();
+
+protected:
+  /// Compute the host grouping, honoring \c ranks_per_host when set
+  void setupTopology();
+  NodeType hostOf(NodeType node) const;
+  NodeType leaderOf(NodeType host) const;
+
+  /// Node 0: decide whether to rebalance across hosts and send quotas
+  void planInterHost();
+  /// Host leader: assign every object on (or arriving at) the host to a rank
+  void balanceHost();
+
+  void rankInfoHandler(RankInfoMsg* msg);
+  void hostLoadHandler(HostLoadMsg* msg);
+  void quotaHandler(QuotaMsg* msg);
+  void incomingHandler(IncomingMsg* msg);
+  void assignHandler(AssignMsg* msg);
+  void summaryHandler(SummaryMsg* msg);
+
+private:
+  double inter_threshold_                              = 0.1;
+  double intra_tolerance_                              = 0.05;
+  double inter_cost_                                   = 4.0;
+  int32_t ranks_per_host_                              = 0;
+
+  NodeType this_host_                                  = 0;
+  NodeType num_hosts_                                  = 1;
+  /// Lowest rank on each host, which acts as the host leader
+  std::vector<NodeType> leaders_                       = {};
+  bool is_leader_                                      = false;
+
+  /// Leader: rank -> (total load, migratable objects)
+  std::map<NodeType, std::tuple<LoadType, ObjLoadList>> rank_info_ = {};
+  /// Leader: objects chosen to leave this host
+  std::set<ObjIDType> outgoing_                        = {};
+  /// Leader: objects arriving from other hosts
+  std::vector<IncomingType> incoming_                  = {};
+  /// Node 0: host -> (load, number of ranks)
+  std::map<NodeType, std::tuple<LoadType, int32_t>> host_loads_ = {};
+  std::vector<HostSummary> summaries_                  = {};
+  bool inter_triggered_                                = false;
+  double inter_imb_before_                             = 0.;
+  /// Objects this rank must migrate
+  std::vector<AssignType> assignments_                 = {};
+
+  objgroup::proxy::Proxy<TwoLevelLB> proxy_            = {};
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_TWOLEVELLB_TWOLEVELLB_H*/
@@ -48,6 +48,7 @@
 #include "vt/vrt/proxy/base_collection_proxy.h"
 #include "vt/activefn/activefn.h"
 #include "vt/vrt/collection/active/active_funcs.h"
+#include "vt/vrt/collection/broadcast/region.h"
 #include "vt/messaging/message/smart_ptr.h"
 #include "vt/messaging/pending_send.h"
 
@@ -172,6 +173,68 @@ struct Broadcastable : BaseProxyT {
     typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f, typename... Args
   >
   messaging::PendingSend broadcastCollective(Args&&... args) const;
+
+  /**
+   * \brief Broadcast with action function handler to only the elements
+   * selected by a region (range, list, stencil, or predicate)
+   * \note Takes ownership of the supplied message
+   *
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   *
+   * \return a pending send
+   */
+  template <typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f>
+  messaging::PendingSend broadcastRegionMsg(
+    Region<IndexT> const& region, messaging::MsgPtrThief<MsgT> msg
+  ) const;
+
+  /**
+   * \brief Create message (with action function handler) and broadcast it to
+   * only the elements selected by a region
+   *
+   * \param[in] region the selected indices
+   * \param[in] args arguments needed for creating the message
+   *
+   * \return a pending send
+   */
+  template <
+    typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f, typename... Args
+  >
+  messaging::PendingSend broadcastRegion(
+    Region<IndexT> const& region, Args&&... args
+  ) const;
+
+  /**
+   * \brief Broadcast with action member handler to only the elements selected
+   * by a region (range, list, stencil, or predicate)
+   * \note Takes ownership of the supplied message
+   *
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   *
+   * \return a pending send
+   */
+  template <typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f>
+  messaging::PendingSend broadcastRegionMsg(
+    Region<IndexT> const& region, messaging::MsgPtrThief<MsgT> msg
+  ) const;
+
+  /**
+   * \brief Create message (with action member handler) and broadcast it to
+   * only the elements selected by a region
+   *
+   * \param[in] region the selected indices
+   * \param[in] args arguments needed for creating the message
+   *
+   * \return a pending send
+   */
+  template <
+    typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f, typename... Args
+  >
+  messaging::PendingSend broadcastRegion(
+    Region<IndexT> const& region, Args&&... args
+  ) const;
 };
 
 }}} /* end namespace vt::vrt::collection */
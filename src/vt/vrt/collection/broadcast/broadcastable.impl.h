@@ -154,6 +154,56 @@ Broadcastable<ColT, IndexT, BaseProxyT>::broadcastCollective(Args&&... args) con
   return broadcastCollectiveMsg<MsgT, f>(makeMessage<MsgT>(std::forward<Args>(args)...));
 }
 
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f>
+messaging::PendingSend
+Broadcastable<ColT, IndexT, BaseProxyT>::broadcastRegionMsg(
+  Region<IndexT> const& region, messaging::MsgPtrThief<MsgT> msg
+) const {
+  auto proxy = this->getProxy();
+  return theCollection()->broadcastRegionMsg<MsgT, ColT, f>(
+    proxy, region, msg.msg_.get()
+  );
+}
+
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <
+  typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f, typename... Args
+>
+messaging::PendingSend
+Broadcastable<ColT, IndexT, BaseProxyT>::broadcastRegion(
+  Region<IndexT> const& region, Args&&... args
+) const {
+  return broadcastRegionMsg<MsgT, f>(
+    region, makeMessage<MsgT>(std::forward<Args>(args)...)
+  );
+}
+
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f>
+messaging::PendingSend
+Broadcastable<ColT, IndexT, BaseProxyT>::broadcastRegionMsg(
+  Region<IndexT> const& region, messaging::MsgPtrThief<MsgT> msg
+) const {
+  auto proxy = this->getProxy();
+  return theCollection()->broadcastRegionMsg<MsgT, ColT, f>(
+    proxy, region, msg.msg_.get()
+  );
+}
+
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <
+  typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f, typename... Args
+>
+messaging::PendingSend
+Broadcastable<ColT, IndexT, BaseProxyT>::broadcastRegion(
+  Region<IndexT> const& region, Args&&... args
+) const {
+  return broadcastRegionMsg<MsgT, f>(
+    region, makeMessage<MsgT>(std::forward<Args>(args)...)
+  );
+}
+
 }}} /* end namespace vt::vrt::collection */
 
 #endif /*INCLUDED_VT_VRT_COLLECTION_BROADCAST_BROADCASTABLE_IMPL_H*/
@@ -0,0 +1,199 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                   region.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BROADCAST_REGION_H
+#define INCLUDED_VT_VRT_COLLECTION_BROADCAST_REGION_H
+
+#include "vt/config.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection {
+
+/**
+ * \struct Region
+ *
+ * \brief A selection of indices within a collection that a region broadcast
+ * targets.
+ *
+ * A region is either a dense box of indices (\c range), an explicit list of
+ * indices (\c list), a stencil of offsets around a center index (\c stencil),
+ * or an arbitrary predicate over the collection's bounds (\c predicate). The
+ * region is always expanded on the sending node, so predicates never need to
+ * be serializable. Indices that fall outside the collection's bounds are
+ * dropped.
+ */
+template <typename IndexT>
+struct Region {
+  using IndexType     = IndexT;
+  using ListType      = std::vector<IndexT>;
+  using PredicateType = std::function<bool(IndexT const&)>;
+
+  /**
+   * \brief Select the dense box of indices [lo, hi) in every dimension
+   *
+   * \param[in] lo the lower corner (inclusive)
+   * \param[in] hi the upper corner (exclusive)
+   *
+   * \return the region
+   */
+  static Region range(IndexT const& lo, IndexT const& hi) {
+    Region r;
+    r.kind_ = eRegionKind::Range;
+    r.lo_ = lo;
+    r.hi_ = hi;
+    return r;
+  }
+
+  /**
+   * \brief Select an explicit list of indices
+   *
+   * \param[in] idxs the indices
+   *
+   * \return the region
+   */
+  static Region list(ListType idxs) {
+    Region r;
+    r.kind_ = eRegionKind::List;
+    std::sort(idxs.begin(), idxs.end());
+    idxs.erase(std::unique(idxs.begin(), idxs.end()), idxs.end());
+    r.list_ = std::move(idxs);
+    return r;
+  }
+
+  /**
+   * \brief Select the indices at \c center plus each of \c offsets
+   *
+   * \param[in] center the center index
+   * \param[in] offsets the stencil offsets (may be negative)
+   *
+   * \return the region
+   */
+  static Region stencil(IndexT const& center, ListType const& offsets) {
+    ListType idxs;
+    idxs.reserve(offsets.size());
+    for (auto&& off : offsets) {
+      idxs.push_back(center + off);
+    }
+    return list(std::move(idxs));
+  }
+
+  /**
+   * \brief Select every index in the collection's bounds for which \c fn
+   * returns true
+   *
+   * \param[in] fn the predicate
+   *
+   * \return the region
+   */
+  static Region predicate(PredicateType fn) {
+    Region r;
+    r.kind_ = eRegionKind::Predicate;
+    r.pred_ = std::move(fn);
+    return r;
+  }
+
+  /**
+   * \brief Apply \c fn to every selected index within \c bounds
+   *
+   * \param[in] bounds the collection bounds
+   * \param[in] fn the function to apply
+   */
+  template <typename Callable>
+  void foreach(IndexT const& bounds, Callable&& fn) const {
+    switch (kind_) {
+    case eRegionKind::Range: {
+      IndexT lo = lo_;
+      IndexT extent = hi_;
+      for (int i = 0; i < bounds.ndims(); i++) {
+        lo[i] = std::max<typename IndexT::DenseIndexType>(lo[i], 0);
+        extent[i] = std::min(hi_[i], bounds[i]) - lo[i];
+        if (extent[i] <= 0) {
+          return;
+        }
+      }
+      extent.foreach([&](IndexT const& off) { fn(lo + off); });
+      break;
+    }
+    case eRegionKind::List:
+      for (auto&& idx : list_) {
+        if (inBounds(idx, bounds)) {
+          fn(idx);
+        }
+      }
+      break;
+    case eRegionKind::Predicate:
+      bounds.foreach([&](IndexT const& idx) {
+        if (pred_(idx)) {
+          fn(idx);
+        }
+      });
+      break;
+    }
+  }
+
+private:
+  static bool inBounds(IndexT const& idx, IndexT const& bounds) {
+    for (int i = 0; i < bounds.ndims(); i++) {
+      if (idx[i] < 0 or idx[i] >= bounds[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  enum struct eRegionKind : int8_t { Range, List, Predicate };
+
+  eRegionKind kind_ = eRegionKind::List;
+  IndexT lo_ = {};
+  IndexT hi_ = {};
+  ListType list_ = {};
+  PredicateType pred_ = nullptr;
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BROADCAST_REGION_H*/
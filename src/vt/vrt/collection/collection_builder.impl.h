@@ -47,6 +47,11 @@
 #include "vt/vrt/collection/manager.h"
 #include "vt/vrt/collection/param/construct_params.h"
 #include "vt/topos/mapping/dense/unbounded_default.h"
+#include "vt/topos/mapping/dense/space_filling_mapper.h"
+#include "vt/vrt/collection/defaults/inverse_map.h"
+#include "vt/worker/worker_fork_join.h"
+
+#include <algorithm>
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -144,6 +149,17 @@ void CollectionManager::makeCollectionImpl(param::ConstructParams<ColT>& po) {
     proxy, map_han, has_dynamic_membership, map_object, has_bounds, bounds
   );
 
+  // A mapper may order the local elements, e.g. along its space-filling curve,
+  // so they are constructed and iterated in that order
+  typename mapping::BaseMapper<IndexType>::OrderFnType order_fn = nullptr;
+  if (map_object != no_obj_group) {
+    objgroup::proxy::Proxy<mapping::BaseMapper<IndexType>> p{map_object};
+    order_fn = p.get()->getLocalOrder();
+    if (order_fn) {
+      findElmHolder<IndexType>(proxy)->setOrder(order_fn);
+    }
+  }
+
   std::size_t global_constructed_elms = 0;
 
   if (po.bulk_insert_bounds_) {
@@ -163,15 +179,35 @@ void CollectionManager::makeCollectionImpl(param::ConstructParams<ColT>& po) {
 
   auto cons_fn = po.template getConsFn<ColT>();
 
-  // Do all bulk insertions
+  // Do all bulk insertions: gather the indices mapped here, through the map's
+  // inverse when it has one so this is proportional to the local elements
+  std::vector<IndexType> bulk_here;
+  auto add_here = [&](IndexType const& idx) { bulk_here.push_back(idx); };
   for (auto&& range : po.bulk_inserts_) {
-    range.foreach([&](IndexType idx) {
-      if (elementMappedHere(map_han, map_object, idx, bounds)) {
-        makeCollectionElement<ColT>(proxy, idx, this_node, cons_fn);
+    // Without bounds, map functions are evaluated against an empty index; only
+    // map objects can be inverted then
+    bool const invertible = has_bounds or map_han == uninitialized_handler;
+    bool const inverted = invertible and foreachMappedHere(
+      map_han, map_object, range, bounds, add_here
+    );
+    if (not inverted) {
+      range.foreach([&](IndexType idx) {
+        if (elementMappedHere(map_han, map_object, idx, bounds)) {
+          add_here(idx);
+        }
+      });
+    }
+    global_constructed_elms += range.getSize();
+  }
+  if (order_fn) {
+    std::sort(
+      bulk_here.begin(), bulk_here.end(),
+      [&](IndexType const& a, IndexType const& b) {
+        return order_fn(a) < order_fn(b);
       }
-      global_constructed_elms++;
-    });
+    );
   }
+  makeCollectionElements<ColT>(proxy, bulk_here, cons_fn);
 
   // Do all list insertions
   for (auto&& list_fn : po.list_inserts_) {
@@ -235,6 +271,79 @@ void CollectionManager::makeCollectionElement(
   IdxContextHolder::set(prev_index, prev_proxy);
 }
 
+template <typename ColT, typename Callable>
+void CollectionManager::makeCollectionElements(
+  VirtualProxyType const proxy,
+  std::vector<typename ColT::IndexType> const& idxs, Callable& cons_fn
+) {
+  using IndexType        = typename ColT::IndexType;
+  using IdxContextHolder = CollectionContextHolder<IndexType>;
+
+  auto const this_node = theContext()->getNode();
+  auto const num_elms = idxs.size();
+
+  if (not useParallelConstruct(num_elms)) {
+    for (auto&& idx : idxs) {
+      makeCollectionElement<ColT>(proxy, idx, this_node, cons_fn);
+    }
+    return;
+  }
+
+  // Run the (thread-safe) constructors concurrently; the context holder is
+  // thread-local so each worker sees the index it is constructing
+  std::vector<std::unique_ptr<ColT>> elms(num_elms);
+  std::vector<ActionType> work;
+  work.reserve(num_elms);
+  for (std::size_t i = 0; i < num_elms; i++) {
+    work.emplace_back([&, i]{
+      auto idx = idxs[i];
+      IdxContextHolder::set(&idx, proxy);
+      elms[i] = cons_fn(idx);
+      IdxContextHolder::clear();
+    });
+  }
+  worker::forkJoin(work);
+
+  // Insert into the holder and location manager serially
+  for (std::size_t i = 0; i < num_elms; i++) {
+    detail::ContainableElementFn<ColT> c{std::move(elms[i])};
+    makeCollectionElement<ColT>(proxy, idxs[i], this_node, std::move(c));
+  }
+}
+
+template <typename IdxT, typename Fn>
+bool CollectionManager::foreachMappedHere(
+  HandlerType map_han, ObjGroupProxyType map_object, IdxT range, IdxT bounds,
+  Fn&& fn
+) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  if (map_han != uninitialized_handler) {
+    // The inverse enumerates the whole bounds; keep the indices in the range
+    bool const whole = range == bounds;
+    return InverseMap<IdxT>::mapLocal(
+      map_han, bounds, this_node, num_nodes, [&](IdxT const& idx) {
+        if (not whole) {
+          for (int i = 0; i < idx.ndims(); i++) {
+            if (idx.get(i) >= range.get(i)) {
+              return;
+            }
+          }
+        }
+        fn(idx);
+      }
+    );
+  }
+
+  if (map_object != no_obj_group) {
+    objgroup::proxy::Proxy<mapping::BaseMapper<IdxT>> p{map_object};
+    return p.get()->mapLocal(range, this_node, num_nodes, fn);
+  }
+
+  return false;
+}
+
 template <typename IdxT>
 bool CollectionManager::elementMappedHere(
   HandlerType map_han, ObjGroupProxyType map_object, IdxT idx, IdxT bounds
@@ -0,0 +1,166 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                inverse_map.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_DEFAULTS_INVERSE_MAP_H
+#define INCLUDED_VT_VRT_COLLECTION_DEFAULTS_INVERSE_MAP_H
+
+#include "vt/config.h"
+#include "vt/topos/mapping/mapping_headers.h"
+#include "vt/topos/mapping/dense/dense.h"
+#include "vt/registry/auto/map/auto_registry_map.h"
+
+namespace vt { namespace vrt { namespace collection {
+
+/**
+ * \struct DenseMapHandlers
+ *
+ * \brief Recognizes the registered handlers of the built-in dense maps for an
+ * index type, in both their function and functor forms
+ */
+template <
+  typename IndexT, typename DefaultMapT, typename BlockMapT, typename RRMapT,
+  mapping::ActiveMapTypedFnType<IndexT>* default_fn,
+  mapping::ActiveMapTypedFnType<IndexT>* block_fn,
+  mapping::ActiveMapTypedFnType<IndexT>* rr_fn
+>
+struct DenseMapHandlers {
+  using IndexPtrType = IndexT*;
+
+  template <typename MapT>
+  static HandlerType functorHandler() {
+    return auto_registry::makeAutoHandlerFunctorMap<
+      MapT, IndexPtrType, IndexPtrType, NodeType
+    >();
+  }
+
+  static bool isBlockMap(HandlerType han) {
+    return
+      han == functorHandler<DefaultMapT>() or
+      han == functorHandler<BlockMapT>() or
+      han == auto_registry::makeAutoHandlerMap<IndexT, default_fn>() or
+      han == auto_registry::makeAutoHandlerMap<IndexT, block_fn>();
+  }
+
+  static bool isRoundRobinMap(HandlerType han) {
+    return
+      han == functorHandler<RRMapT>() or
+      han == auto_registry::makeAutoHandlerMap<IndexT, rr_fn>();
+  }
+};
+
+template <typename IndexT>
+struct DenseBuiltinMaps {
+  static bool isBlockMap(HandlerType) { return false; }
+  static bool isRoundRobinMap(HandlerType) { return false; }
+};
+
+template <typename T>
+struct DenseBuiltinMaps<index::Index1D<T>> : DenseMapHandlers<
+  index::Index1D<T>, mapping::dense1DMapFn<T>, mapping::dense1DBlkMapFn<T>,
+  mapping::dense1DRRMapFn<T>, mapping::defaultDenseIndex1DMap<T>,
+  mapping::dense1DBlockMap<T>, mapping::dense1DRoundRobinMap<T>
+> { };
+
+template <typename T>
+struct DenseBuiltinMaps<index::Index2D<T>> : DenseMapHandlers<
+  index::Index2D<T>, mapping::dense2DMapFn<T>, mapping::dense2DBlkMapFn<T>,
+  mapping::dense2DRRMapFn<T>, mapping::defaultDenseIndex2DMap<T>,
+  mapping::dense2DBlockMap<T>, mapping::dense2DRoundRobinMap<T>
+> { };
+
+template <typename T>
+struct DenseBuiltinMaps<index::Index3D<T>> : DenseMapHandlers<
+  index::Index3D<T>, mapping::dense3DMapFn<T>, mapping::dense3DBlkMapFn<T>,
+  mapping::dense3DRRMapFn<T>, mapping::defaultDenseIndex3DMap<T>,
+  mapping::dense3DBlockMap<T>, mapping::dense3DRoundRobinMap<T>
+> { };
+
+/**
+ * \struct InverseMap
+ *
+ * \brief Enumerates the indices a map handler assigns to a node without
+ * evaluating the map on every index in the bounds. Only the built-in dense
+ * block and round-robin maps are invertible; user map functions are not.
+ */
+template <typename IndexT>
+struct InverseMap {
+  template <typename Fn>
+  static bool mapLocal(HandlerType, IndexT, NodeType, NodeType, Fn&&) {
+    return false;
+  }
+};
+
+template <typename T, index::NumDimensionsType ndim>
+struct InverseMap<index::DenseIndexArray<T, ndim>> {
+  using IndexType = index::DenseIndexArray<T, ndim>;
+
+  /**
+   * \brief Apply \c fn to each index within \c bounds that \c map_han assigns
+   * to \c node
+   *
+   * \return whether \c map_han is invertible; if not, nothing was enumerated
+   */
+  template <typename Fn>
+  static bool mapLocal(
+    HandlerType map_han, IndexType bounds, NodeType node, NodeType num_nodes,
+    Fn&& fn
+  ) {
+    using MapsType = DenseBuiltinMaps<IndexType>;
+    if (MapsType::isBlockMap(map_han)) {
+      mapping::denseBlockMapLocal<IndexType, ndim>(
+        &bounds, node, num_nodes, std::forward<Fn>(fn)
+      );
+      return true;
+    } else if (MapsType::isRoundRobinMap(map_han)) {
+      mapping::denseRoundRobinMapLocal<IndexType, ndim>(
+        &bounds, node, num_nodes, std::forward<Fn>(fn)
+      );
+      return true;
+    }
+    return false;
+  }
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_DEFAULTS_INVERSE_MAP_H*/
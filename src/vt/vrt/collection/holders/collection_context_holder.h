@@ -76,15 +76,16 @@ struct CollectionContextHolder {
   }
 
 private:
-  static IndexT* ctx_idx;
-  static VirtualProxyType ctx_proxy;
+  // Thread-local so collection handlers may execute concurrently on workers
+  static thread_local IndexT* ctx_idx;
+  static thread_local VirtualProxyType ctx_proxy;
 };
 
 template <typename IndexT>
-/*static*/ IndexT* CollectionContextHolder<IndexT>::ctx_idx = nullptr;
+/*static*/ thread_local IndexT* CollectionContextHolder<IndexT>::ctx_idx = nullptr;
 
 template <typename IndexT>
-/*static*/ VirtualProxyType
+/*static*/ thread_local VirtualProxyType
 CollectionContextHolder<IndexT>::ctx_proxy = no_vrt_proxy;
 
 }}} /* end namespace vt::vrt::collection */
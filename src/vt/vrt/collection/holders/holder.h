@@ -58,6 +58,7 @@
 #include <list>
 #include <memory>
 #include <functional>
+#include <vector>
 #include <cstdlib>
 
 namespace vt { namespace vrt { namespace collection {
@@ -85,6 +86,7 @@ struct Holder {
   using TypedLBContainer    = ContType<LookupElementType, LBContListType>;
   using FuncApplyType       = std::function<void(IndexT const&, CollectionType*)>;
   using FuncExprType        = std::function<bool(IndexT const&)>;
+  using OrderFnType         = std::function<uint64_t(IndexT const&)>;
   using CountType           = uint64_t;
 
   /**
@@ -153,6 +155,14 @@ struct Holder {
    */
   void foreach(FuncApplyType fn);
 
+  /**
+   * \brief Order \c foreach by a key over the indices instead of the
+   * unspecified hash order
+   *
+   * \param[in] fn the ordering key; empty to restore the default order
+   */
+  void setOrder(OrderFnType fn);
+
   /**
    * \brief Count number of elements
    *
@@ -262,6 +272,9 @@ private:
   NodeType group_root_                                            = 0;
   CountType num_erased_not_removed_                               = 0;
   std::vector<listener::ListenFnType<IndexT>> event_listeners_    = {};
+  OrderFnType order_fn_                                           = nullptr;
+  std::vector<std::tuple<uint64_t, IndexT>> order_                = {};
+  bool order_dirty_                                               = true;
 };
 
 }}} /* end namespace vt::vrt::collection */
@@ -51,6 +51,7 @@
 #include <unordered_map>
 #include <tuple>
 #include <cassert>
+#include <algorithm>
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -92,6 +93,7 @@ void Holder<IndexT>::insert(IndexT const& idx, InnerHolder&& inner) {
     std::forward_as_tuple(lookup),
     std::forward_as_tuple(std::move(inner))
   );
+  order_dirty_ = true;
 }
 
 template <typename IndexT>
@@ -121,6 +123,7 @@ typename Holder<IndexT>::VirtualPtrType Holder<IndexT>::remove(
   vtAssert(iter->second.erased_ == false, "Must not be erased already");
   iter->second.erased_ = true;
   num_erased_not_removed_++;
+  order_dirty_ = true;
   return owned_ptr;
 }
 
@@ -156,12 +159,38 @@ void Holder<IndexT>::foreach(FuncApplyType fn) {
 
   num_reentrant++;
   auto& container = vc_container_;
-  for (auto& elm : container) {
-    if (!elm.second.erased_) {
-      auto const& idx = elm.first;
-      auto const& holder = elm.second;
-      auto const col_ptr = holder.getRawPtr();
-      fn(idx, col_ptr);
+  if (order_fn_ and (not order_dirty_ or num_reentrant == 1)) {
+    // Only the outermost foreach may rebuild the order being iterated
+    if (order_dirty_) {
+      order_.clear();
+      order_.reserve(container.size());
+      for (auto& elm : container) {
+        if (!elm.second.erased_) {
+          order_.emplace_back(order_fn_(elm.first), elm.first);
+        }
+      }
+      std::sort(
+        order_.begin(), order_.end(), [](auto const& a, auto const& b) {
+          return std::get<0>(a) < std::get<0>(b);
+        }
+      );
+      order_dirty_ = false;
+    }
+    for (std::size_t i = 0; i < order_.size(); i++) {
+      auto const idx = std::get<1>(order_[i]);
+      auto iter = container.find(idx);
+      if (iter != container.end() and !iter->second.erased_) {
+        fn(idx, iter->second.getRawPtr());
+      }
+    }
+  } else {
+    for (auto& elm : container) {
+      if (!elm.second.erased_) {
+        auto const& idx = elm.first;
+        auto const& holder = elm.second;
+        auto const col_ptr = holder.getRawPtr();
+        fn(idx, col_ptr);
+      }
     }
   }
   num_reentrant--;
@@ -171,6 +200,13 @@ void Holder<IndexT>::foreach(FuncApplyType fn) {
   }
 }
 
+template <typename IndexT>
+void Holder<IndexT>::setOrder(OrderFnType fn) {
+  order_fn_ = fn;
+  order_.clear();
+  order_dirty_ = true;
+}
+
 template <typename IndexT>
 typename Holder<IndexT>::TypedIndexContainer::size_type
 Holder<IndexT>::numElements() const {
@@ -48,6 +48,9 @@
 #include "vt/vrt/base/base.h"
 #include "vt/vrt/collection/manager.h"
 #include "vt/vrt/collection/balance/lb_invoke/lb_manager.h"
+#include "vt/worker/worker_fork_join.h"
+
+#include <algorithm>
 
 namespace vt { namespace vrt { namespace collection {
 
@@ -99,6 +102,22 @@ void CollectionManager::schedule(ActionType action) {
   theSched()->enqueue(action);
 }
 
+/*static*/ bool CollectionManager::useParallelDeliver(std::size_t num_elms) {
+  auto const min_elms = theConfig()->vt_coll_parallel_min_elms;
+  return
+    theConfig()->vt_coll_parallel_deliver and
+    num_elms >= static_cast<std::size_t>(std::max<int32_t>(min_elms, 2)) and
+    worker::canForkJoin();
+}
+
+/*static*/ bool CollectionManager::useParallelConstruct(std::size_t num_elms) {
+  auto const min_elms = theConfig()->vt_coll_parallel_min_elms;
+  return
+    theConfig()->vt_coll_parallel_construct and
+    num_elms >= static_cast<std::size_t>(std::max<int32_t>(min_elms, 2)) and
+    worker::canForkJoin();
+}
+
 VirtualProxyType CollectionManager::makeCollectionProxy(
   bool is_collective, bool is_migratable
 ) {
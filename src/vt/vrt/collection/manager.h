@@ -57,6 +57,8 @@
 #include "vt/vrt/collection/migrate/migrate_status.h"
 #include "vt/vrt/collection/destroy/manager_destroy_attorney.fwd.h"
 #include "vt/vrt/collection/messages/user_wrap.h"
+#include "vt/vrt/collection/messages/region_bcast.h"
+#include "vt/vrt/collection/broadcast/region.h"
 #include "vt/vrt/collection/traits/coll_msg.h"
 #include "vt/vrt/collection/dispatch/dispatch.h"
 #include "vt/vrt/collection/dispatch/registry.h"
@@ -71,6 +73,7 @@
 #include "vt/vrt/collection/balance/lb_common.h"
 #include "vt/runtime/component/component_pack.h"
 #include "vt/runnable/invoke.h"
+#include "vt/runnable/runnable.fwd.h"
 #include "vt/context/runnable_context/lb_stats.fwd.h"
 #include "vt/vrt/collection/param/construct_params.h"
 #include "vt/vrt/collection/param/construct_params_msg.h"
@@ -868,6 +871,104 @@ struct CollectionManager
     HandlerType const handler, bool instrument
   );
 
+  /**
+   * \brief Broadcast a message with action function handler to the elements
+   * selected by a region
+   *
+   * Only nodes believed to host a selected element (by the location cache or,
+   * failing that, the mapping function) receive the message, through a
+   * spanning tree built over just those nodes.
+   *
+   * \param[in] proxy the collection proxy
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   * \param[in] instrument whether to instrument the broadcast for load
+   * balancing (some system calls use this to disable instrumentation)
+   *
+   * \return a pending send
+   */
+  template <typename MsgT, typename ColT, ActiveColTypedFnType<MsgT, ColT>* f>
+  messaging::PendingSend broadcastRegionMsg(
+    CollectionProxyWrapType<ColT> const& proxy,
+    Region<typename ColT::IndexType> const& region, MsgT* msg,
+    bool instrument = true
+  );
+
+  /**
+   * \brief Broadcast a message with action member handler to the elements
+   * selected by a region
+   *
+   * \param[in] proxy the collection proxy
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   * \param[in] instrument whether to instrument the broadcast for load
+   * balancing (some system calls use this to disable instrumentation)
+   *
+   * \return a pending send
+   */
+  template <
+    typename MsgT, typename ColT, ActiveColMemberTypedFnType<MsgT, ColT> f
+  >
+  messaging::PendingSend broadcastRegionMsg(
+    CollectionProxyWrapType<ColT> const& proxy,
+    Region<typename ColT::IndexType> const& region, MsgT* msg,
+    bool instrument = true
+  );
+
+  /**
+   * \internal \brief Region broadcast of a normal message, which is wrapped
+   *
+   * \param[in] proxy the collection proxy
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   * \param[in] handler the handler to invoke
+   * \param[in] instrument whether to instrument the broadcast
+   *
+   * \return a pending send
+   */
+  template <typename MsgT, typename ColT>
+  IsNotColMsgType<MsgT> broadcastRegionWithHan(
+    CollectionProxyWrapType<ColT> const& proxy,
+    Region<typename ColT::IndexType> const& region, MsgT* msg,
+    HandlerType const handler, bool instrument
+  );
+
+  /**
+   * \internal \brief Region broadcast of a collection message
+   *
+   * \param[in] proxy the collection proxy
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   * \param[in] handler the handler to invoke
+   * \param[in] instrument whether to instrument the broadcast
+   *
+   * \return a pending send
+   */
+  template <typename MsgT, typename ColT>
+  IsColMsgType<MsgT> broadcastRegionWithHan(
+    CollectionProxyWrapType<ColT> const& proxy,
+    Region<typename ColT::IndexType> const& region, MsgT* msg,
+    HandlerType const handler, bool instrument
+  );
+
+  /**
+   * \internal \brief Region broadcast of a message with type-erased handler
+   *
+   * \param[in] proxy the collection proxy
+   * \param[in] region the selected indices
+   * \param[in] msg the message
+   * \param[in] handler the handler to invoke
+   * \param[in] instrument whether to instrument the broadcast
+   *
+   * \return a pending send
+   */
+  template <typename MsgT, typename ColT, typename IdxT>
+  messaging::PendingSend broadcastRegionUntypedHandler(
+    CollectionProxyWrapType<ColT, IdxT> const& proxy,
+    Region<IdxT> const& region, MsgT* msg, HandlerType const handler,
+    bool instrument
+  );
+
   /**
    * \brief Broadcast collective a message with action function handler
    * \note Takes ownership of the supplied message
@@ -1141,6 +1242,91 @@ public:
     NodeType from, trace::TraceEventIDType event, bool immediate
   );
 
+  /**
+   * \internal \brief Build a runnable that delivers a promoted/wrapped message
+   * to a collection element on a worker thread during a concurrent delivery
+   *
+   * \param[in] msg the message
+   * \param[in] col the collection element pointer
+   * \param[in] han the handler to invoke
+   * \param[in] from the node that sent it
+   * \param[in] event the associated trace event
+   *
+   * \return the runnable, ready to run
+   */
+  template <typename ColT, typename IndexT, typename MsgT, typename UserMsgT>
+  static IsWrapType<
+    ColT, UserMsgT, MsgT, std::unique_ptr<runnable::RunnableNew>
+  > collectionAutoMsgRunnable(
+    MsgT* msg, Indexable<IndexT>* col, HandlerType han, NodeType from,
+    trace::TraceEventIDType event
+  );
+
+  /**
+   * \internal \brief Build a runnable that delivers a regular collection
+   * message to a collection element on a worker thread during a concurrent
+   * delivery
+   *
+   * \param[in] msg the message
+   * \param[in] col the collection element pointer
+   * \param[in] han the handler to invoke
+   * \param[in] from the node that sent it
+   * \param[in] event the associated trace event
+   *
+   * \return the runnable, ready to run
+   */
+  template <typename ColT, typename IndexT, typename MsgT, typename UserMsgT>
+  static IsNotWrapType<
+    ColT, UserMsgT, MsgT, std::unique_ptr<runnable::RunnableNew>
+  > collectionAutoMsgRunnable(
+    MsgT* msg, Indexable<IndexT>* col, HandlerType han, NodeType from,
+    trace::TraceEventIDType event
+  );
+
+  /**
+   * \internal \brief Copy a message for one chunk of a concurrent delivery.
+   * Handlers may take and drop references to their message and the reference
+   * count is not atomic, so the workers must never share a message.
+   *
+   * \param[in] msg the message
+   *
+   * \return the copy
+   */
+  template <typename MsgT>
+  static std::enable_if_t<
+    std::is_copy_constructible<MsgT>::value, MsgPtr<MsgT>
+  > copyDeliverMsg(MsgT* msg);
+
+  /**
+   * \internal \brief Messages that can not be copied are never delivered
+   * concurrently; see \c collectionAutoMsgDeliverLocal
+   *
+   * \param[in] msg the message
+   *
+   * \return never returns
+   */
+  template <typename MsgT>
+  static std::enable_if_t<
+    not std::is_copy_constructible<MsgT>::value, MsgPtr<MsgT>
+  > copyDeliverMsg(MsgT* msg);
+
+  /**
+   * \internal \brief Deliver a message to a set of local elements: enqueued
+   * one by one, or run concurrently across the worker threads when \c
+   * useParallelDeliver allows it
+   *
+   * \param[in] msg the message
+   * \param[in] bases the local element pointers
+   * \param[in] han the handler to invoke
+   * \param[in] from the node that sent it
+   * \param[in] event the associated trace event
+   */
+  template <typename ColT, typename IndexT, typename MsgT>
+  static void collectionAutoMsgDeliverLocal(
+    MsgT* msg, std::vector<Indexable<IndexT>*> const& bases, HandlerType han,
+    NodeType from, trace::TraceEventIDType event
+  );
+
   /**
    * \internal \brief Receive a broadcast to a collection
    *
@@ -1149,6 +1335,26 @@ public:
   template <typename ColT, typename IndexT, typename MsgT>
   static void collectionBcastHandler(MsgT* msg);
 
+  /**
+   * \internal \brief Whether a broadcast to \c num_elms local elements should
+   * be delivered concurrently across the worker threads
+   *
+   * \param[in] num_elms the number of local elements
+   *
+   * \return whether to deliver concurrently
+   */
+  static bool useParallelDeliver(std::size_t num_elms);
+
+  /**
+   * \internal \brief Whether \c num_elms local elements should be constructed
+   * concurrently across the worker threads
+   *
+   * \param[in] num_elms the number of local elements
+   *
+   * \return whether to construct concurrently
+   */
+  static bool useParallelConstruct(std::size_t num_elms);
+
   /**
    * \internal \brief Receive a broadcast at the root for stamping
    *
@@ -1157,6 +1363,48 @@ public:
   template <typename ColT, typename IndexT, typename MsgT>
   static void broadcastRootHandler(MsgT* msg);
 
+  /**
+   * \internal \brief Receive a region broadcast: forward it down the subtree
+   * and deliver to the targeted local elements
+   *
+   * \param[in] msg the region broadcast message
+   */
+  template <typename ColT, typename IndexT, typename MsgT>
+  static void regionBcastHandler(RegionBcastMsg<ColT, MsgT>* msg);
+
+  /**
+   * \internal \brief Forward a region broadcast to the subtrees rooted in
+   * \c nodes[begin,end), splitting them into at most \c region_bcast_fanout
+   * contiguous chunks
+   *
+   * \param[in] proxy the collection proxy bits
+   * \param[in] nodes the target nodes
+   * \param[in] idxs the targeted indices on each node
+   * \param[in] begin the first node to forward to
+   * \param[in] payload the packed user message
+   */
+  template <typename ColT, typename IndexT, typename MsgT>
+  static void regionBcastForward(
+    VirtualProxyType proxy, std::vector<NodeType> const& nodes,
+    std::vector<std::vector<IndexT>> const& idxs, std::size_t begin,
+    std::vector<char> const& payload
+  );
+
+  /**
+   * \internal \brief Deliver a region broadcast to the targeted local
+   * elements, re-routing any that are no longer here
+   *
+   * \param[in] proxy the collection proxy bits
+   * \param[in] msg the user message
+   * \param[in] idxs the targeted indices on this node
+   * \param[in] payload the packed user message, for re-routed copies
+   */
+  template <typename ColT, typename IndexT, typename MsgT>
+  static void regionBcastDeliver(
+    VirtualProxyType proxy, MsgT* msg, std::vector<IndexT> const& idxs,
+    std::vector<char> const& payload
+  );
+
   /**
    * \internal \brief Count the number of elements for a collection on this node
    *
@@ -1768,6 +2016,38 @@ private:
     bool zero_reduce_stamp = false
   );
 
+  /**
+   * \internal \brief Construct the collection elements for a set of indices
+   * mapped to this node, concurrently across the workers if enabled
+   *
+   * \param[in] proxy the virtual proxy
+   * \param[in] idxs the indices of the elements
+   * \param[in] cons_fn the construct function/functor
+   */
+  template <typename ColT, typename Callable>
+  void makeCollectionElements(
+    VirtualProxyType const proxy,
+    std::vector<typename ColT::IndexType> const& idxs, Callable& cons_fn
+  );
+
+  /**
+   * \brief Apply a function to the indices in a range that are mapped here,
+   * enumerated through the inverse of the map
+   *
+   * \param[in] map_han The map handler
+   * \param[in] map_object The map object
+   * \param[in] range The range of indices
+   * \param[in] bounds The bounds of the collection
+   * \param[in] fn The function to apply
+   *
+   * \return whether the map is invertible; if not, nothing was enumerated
+   */
+  template <typename IdxT, typename Fn>
+  bool foreachMappedHere(
+    HandlerType map_han, ObjGroupProxyType map_object, IdxT range, IdxT bounds,
+    Fn&& fn
+  );
+
   /**
    * \brief Check if an element is mapped here (to this node)
    *
@@ -80,12 +80,16 @@
 #include "vt/phase/phase_manager.h"
 #include "vt/runnable/invoke.h"
 #include "vt/runnable/make_runnable.h"
+#include "vt/runnable/runnable.h"
+#include "vt/worker/worker_fork_join.h"
+#include "vt/worker/fork_join_section.h"
 
 #include <tuple>
 #include <utility>
 #include <functional>
 #include <cassert>
 #include <memory>
+#include <map>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -260,6 +264,139 @@ CollectionManager::collectionAutoMsgDeliver(
     .runOrEnqueue(immediate);
 }
 
+template <typename ColT, typename IndexT, typename MsgT, typename UserMsgT>
+/*static*/ CollectionManager::IsWrapType<
+  ColT, UserMsgT, MsgT, std::unique_ptr<runnable::RunnableNew>
+> CollectionManager::collectionAutoMsgRunnable(
+  MsgT* msg, Indexable<IndexT>* base, HandlerType han, NodeType from,
+  trace::TraceEventIDType event
+) {
+  auto user_msg = makeMessage<UserMsgT>(std::move(msg->getMsg()));
+
+  // Expand out the index for tracing purposes; Projections takes up to
+  // 4-dimensions
+  auto idx = base->getIndex();
+  uint64_t const idx1 = idx.ndims() > 0 ? idx[0] : 0;
+  uint64_t const idx2 = idx.ndims() > 1 ? idx[1] : 0;
+  uint64_t const idx3 = idx.ndims() > 2 ? idx[2] : 0;
+  uint64_t const idx4 = idx.ndims() > 3 ? idx[3] : 0;
+
+  auto const member = HandlerManager::isHandlerMember(han);
+  auto reg = member ?
+    auto_registry::RegistryTypeEnum::RegVrtCollectionMember :
+    auto_registry::RegistryTypeEnum::RegVrtCollection;
+
+  return runnable::makeRunnable(user_msg, false, han, from, reg)
+    .withTDEpoch(theMsg()->getEpochContextMsg(msg))
+    .withCollection(base)
+    .withTraceIndex(event, idx1, idx2, idx3, idx4)
+    .withLBStats(base, msg)
+    .release();
+}
+
+template <typename ColT, typename IndexT, typename MsgT, typename UserMsgT>
+/*static*/ CollectionManager::IsNotWrapType<
+  ColT, UserMsgT, MsgT, std::unique_ptr<runnable::RunnableNew>
+> CollectionManager::collectionAutoMsgRunnable(
+  MsgT* msg, Indexable<IndexT>* base, HandlerType han, NodeType from,
+  trace::TraceEventIDType event
+) {
+  // Expand out the index for tracing purposes; Projections takes up to
+  // 4-dimensions
+  auto idx = base->getIndex();
+  uint64_t const idx1 = idx.ndims() > 0 ? idx[0] : 0;
+  uint64_t const idx2 = idx.ndims() > 1 ? idx[1] : 0;
+  uint64_t const idx3 = idx.ndims() > 2 ? idx[2] : 0;
+  uint64_t const idx4 = idx.ndims() > 3 ? idx[3] : 0;
+
+  auto const member = HandlerManager::isHandlerMember(han);
+  auto reg = member ?
+    auto_registry::RegistryTypeEnum::RegVrtCollectionMember :
+    auto_registry::RegistryTypeEnum::RegVrtCollection;
+
+  auto m = promoteMsg(msg);
+  return runnable::makeRunnable(m, false, han, from, reg)
+    .withTDEpoch(theMsg()->getEpochContextMsg(msg))
+    .withCollection(base)
+    .withTraceIndex(event, idx1, idx2, idx3, idx4)
+    .withLBStats(base)
+    .release();
+}
+
+template <typename MsgT>
+/*static*/ std::enable_if_t<
+  std::is_copy_constructible<MsgT>::value, MsgPtr<MsgT>
+> CollectionManager::copyDeliverMsg(MsgT* msg) {
+  return makeMessage<MsgT>(*msg);
+}
+
+template <typename MsgT>
+/*static*/ std::enable_if_t<
+  not std::is_copy_constructible<MsgT>::value, MsgPtr<MsgT>
+> CollectionManager::copyDeliverMsg(MsgT*) {
+  vtAbort("A message that can not be copied must be delivered sequentially");
+  return nullptr;
+}
+
+template <typename ColT, typename IndexT, typename MsgT>
+/*static*/ void CollectionManager::collectionAutoMsgDeliverLocal(
+  MsgT* msg, std::vector<Indexable<IndexT>*> const& bases, HandlerType han,
+  NodeType from, trace::TraceEventIDType event
+) {
+  using UserMsgType = typename MsgT::UserMsgType;
+
+  if (
+    not std::is_copy_constructible<MsgT>::value or
+    not useParallelDeliver(bases.size())
+  ) {
+    for (auto&& base : bases) {
+      // be very careful here, do not touch `base' after running the active
+      // message because it might have migrated out and be invalid
+      collectionAutoMsgDeliver<ColT,IndexT,MsgT,UserMsgType>(
+        msg, base, han, from, event, false
+      );
+    }
+    return;
+  }
+
+  // Build the runnables here on the comm thread, run them across the workers,
+  // then destroy them back on the comm thread after the join. Each runnable
+  // carries its TD and trace contexts; their effects on the termination
+  // detector, the trace log and any sends are merged at the join. The comm
+  // thread's chunk uses the original message and every other chunk gets its
+  // own copy, so no message reference count is touched by two threads. The
+  // copies are made up front since building a runnable may consume the
+  // payload of a wrapped message.
+  using RunnablePtrType = std::unique_ptr<runnable::RunnableNew>;
+  auto const chunk_size = worker::forkJoinChunkSize(bases.size());
+  std::vector<MsgPtr<MsgT>> copies;
+  for (auto i = chunk_size; i < bases.size(); i += chunk_size) {
+    copies.emplace_back(copyDeliverMsg(msg));
+  }
+  std::vector<RunnablePtrType> tasks;
+  tasks.reserve(bases.size());
+  for (std::size_t i = 0; i < bases.size(); i++) {
+    vtAssert(bases[i] != nullptr, "Must be valid pointer");
+    auto const chunk = i / chunk_size;
+    auto chunk_msg = chunk == 0 ? msg : copies[chunk - 1].get();
+    tasks.emplace_back(
+      collectionAutoMsgRunnable<ColT,IndexT,MsgT,UserMsgType>(
+        chunk_msg, bases[i], han, from, event
+      )
+    );
+  }
+
+  std::vector<ActionType> work;
+  work.reserve(tasks.size());
+  for (auto&& task : tasks) {
+    auto ptr = task.get();
+    work.emplace_back([ptr]{ ptr->run(); });
+  }
+  worker::forkJoin(work);
+  tasks.clear();
+  copies.clear();
+}
+
 template <typename ColT, typename IndexT, typename MsgT>
 /*static*/ void CollectionManager::collectionBcastHandler(MsgT* msg) {
   auto const col_msg = static_cast<CollectionMessage<ColT>*>(msg);
@@ -278,26 +415,27 @@ template <typename ColT, typename IndexT, typename MsgT>
   auto elm_holder = theCollection()->findElmHolder<IndexT>(bcast_proxy);
   if (elm_holder) {
     auto const handler = col_msg->getVrtHandler();
+    auto const num_elms = elm_holder->numElements();
     vt_debug_print(
       normal, vrt_coll,
-      "broadcast apply: size={}\n", elm_holder->numElements()
+      "broadcast apply: size={}\n", num_elms
     );
-    elm_holder->foreach([col_msg, msg, handler](
-      IndexT const& idx, Indexable<IndexT>* base
-    ) {
+    auto const from = col_msg->getFromNode();
+    trace::TraceEventIDType trace_event = trace::no_trace_event;
+    #if vt_check_enabled(trace_enabled)
+      trace_event = col_msg->getFromTraceEvent();
+    #endif
+
+    std::vector<Indexable<IndexT>*> bases;
+    bases.reserve(num_elms);
+    elm_holder->foreach([&bases](IndexT const&, Indexable<IndexT>* base) {
       vtAssert(base != nullptr, "Must be valid pointer");
-
-      // be very careful here, do not touch `base' after running the active
-      // message because it might have migrated out and be invalid
-      auto const from = col_msg->getFromNode();
-      trace::TraceEventIDType trace_event = trace::no_trace_event;
-      #if vt_check_enabled(trace_enabled)
-        trace_event = col_msg->getFromTraceEvent();
-      #endif
-      collectionAutoMsgDeliver<ColT,IndexT,MsgT,typename MsgT::UserMsgType>(
-        msg, base, handler, from, trace_event, false
-      );
+      bases.push_back(base);
     });
+
+    collectionAutoMsgDeliverLocal<ColT,IndexT,MsgT>(
+      msg, bases, handler, from, trace_event
+    );
   }
   /*
    *  Termination: consume for default epoch for correct termination: on the
@@ -913,6 +1051,252 @@ messaging::PendingSend CollectionManager::broadcastMsgUntypedHandler(
   }
 }
 
+template <typename MsgT, typename ColT, ActiveColTypedFnType<MsgT, ColT>* f>
+messaging::PendingSend CollectionManager::broadcastRegionMsg(
+  CollectionProxyWrapType<ColT> const& proxy,
+  Region<typename ColT::IndexType> const& region, MsgT* msg, bool instrument
+) {
+  auto const& h = auto_registry::makeAutoHandlerCollection<ColT, MsgT, f>();
+  return broadcastRegionWithHan<MsgT, ColT>(proxy, region, msg, h, instrument);
+}
+
+template <
+  typename MsgT, typename ColT, ActiveColMemberTypedFnType<MsgT, ColT> f
+>
+messaging::PendingSend CollectionManager::broadcastRegionMsg(
+  CollectionProxyWrapType<ColT> const& proxy,
+  Region<typename ColT::IndexType> const& region, MsgT* msg, bool instrument
+) {
+  auto const& h = auto_registry::makeAutoHandlerCollectionMem<ColT, MsgT, f>();
+  return broadcastRegionWithHan<MsgT, ColT>(proxy, region, msg, h, instrument);
+}
+
+template <typename MsgT, typename ColT>
+CollectionManager::IsNotColMsgType<MsgT>
+CollectionManager::broadcastRegionWithHan(
+  CollectionProxyWrapType<ColT> const& proxy,
+  Region<typename ColT::IndexType> const& region, MsgT* msg,
+  HandlerType const handler, bool instrument
+) {
+  using IdxT = typename ColT::IndexType;
+  auto wrap_msg = makeMessage<ColMsgWrap<ColT, MsgT>>(*msg);
+  return broadcastRegionUntypedHandler<ColMsgWrap<ColT, MsgT>, ColT, IdxT>(
+    proxy, region, wrap_msg.get(), handler, instrument
+  );
+}
+
+template <typename MsgT, typename ColT>
+CollectionManager::IsColMsgType<MsgT>
+CollectionManager::broadcastRegionWithHan(
+  CollectionProxyWrapType<ColT> const& proxy,
+  Region<typename ColT::IndexType> const& region, MsgT* msg,
+  HandlerType const handler, bool instrument
+) {
+  using IdxT = typename ColT::IndexType;
+  return broadcastRegionUntypedHandler<MsgT, ColT, IdxT>(
+    proxy, region, msg, handler, instrument
+  );
+}
+
+template <typename MsgT, typename ColT, typename IdxT>
+messaging::PendingSend CollectionManager::broadcastRegionUntypedHandler(
+  CollectionProxyWrapType<ColT, IdxT> const& toProxy,
+  Region<IdxT> const& region, MsgT* raw_msg, HandlerType const handler,
+  bool instrument
+) {
+  auto const col_proxy = toProxy.getProxy();
+  auto const this_node = theContext()->getNode();
+  auto msg = promoteMsg(raw_msg);
+
+  msg->setFromNode(this_node);
+  msg->setVrtHandler(handler);
+  msg->setBcastProxy(col_proxy);
+
+# if vt_check_enabled(trace_enabled)
+  auto reg_type = HandlerManager::isHandlerMember(handler) ?
+    auto_registry::RegistryTypeEnum::RegVrtCollectionMember :
+    auto_registry::RegistryTypeEnum::RegVrtCollection;
+  auto msg_size = vt::serialization::MsgSizer<MsgT>::get(msg.get());
+  const bool is_bcast = true;
+
+  auto event = theMsg()->makeTraceCreationSend(
+    handler, reg_type, msg_size, is_bcast
+  );
+  msg->setFromTraceEvent(event);
+# endif
+
+# if vt_check_enabled(lblite)
+  msg->setLBLiteInstrument(instrument);
+  auto const elm_id = getCurrentContext();
+  if (elm_id.id != elm::no_element_id) {
+    msg->setSenderElm(elm_id);
+    msg->setCat(elm::CommCategory::Broadcast);
+  }
+# endif
+
+  auto const cur_epoch = theMsg()->setupEpochMsg(msg);
+  theMsg()->pushEpoch(cur_epoch);
+
+  // Resolve each selected index to the node believed to host it: the location
+  // cache if it has an entry, otherwise the home node from the mapping
+  // function. Stale guesses are corrected by the receiver re-routing.
+  auto lm = theLocMan()->getCollectionLM<IdxT>(col_proxy);
+  vtAssert(lm != nullptr, "LM must exist");
+
+  std::map<NodeType, std::vector<IdxT>> targets;
+  region.foreach(getRange<ColT>(col_proxy), [&](IdxT const& idx) {
+    auto node = lm->getCachedNode(idx);
+    if (node == uninitialized_destination) {
+      node = getMappedNode<ColT>(toProxy, idx);
+    }
+    targets[node].push_back(idx);
+  });
+
+  std::vector<IdxT> local;
+  std::vector<NodeType> nodes;
+  std::vector<std::vector<IdxT>> idxs;
+  for (auto&& t : targets) {
+    if (t.first == this_node) {
+      local = std::move(t.second);
+    } else {
+      nodes.push_back(t.first);
+      idxs.emplace_back(std::move(t.second));
+    }
+  }
+
+  vt_debug_print(
+    normal, vrt_coll,
+    "broadcastRegionUntypedHandler: col_proxy={:x}, handler={}, "
+    "num_nodes={}, num_local={}, cur_epoch={:x}\n",
+    col_proxy, handler, nodes.size(), local.size(), cur_epoch
+  );
+
+  if (nodes.size() > 0 or local.size() > 0) {
+    theMsg()->markAsCollectionMessage(msg);
+    auto payload = packRegionPayload<MsgT>(msg.get());
+    regionBcastForward<ColT, IdxT, MsgT>(col_proxy, nodes, idxs, 0, payload);
+
+    if (local.size() > 0) {
+      // Deliver to local elements from the scheduler, as the other collection
+      // broadcast paths do, so handlers never run on the sender's stack. The
+      // epoch is held open until the delivery unit runs.
+      theTerm()->produce(cur_epoch);
+      theSched()->enqueue(
+        msg,
+        [col_proxy, msg, cur_epoch, local, payload]{
+          theMsg()->pushEpoch(cur_epoch);
+          regionBcastDeliver<ColT, IdxT, MsgT>(
+            col_proxy, msg.get(), local, payload
+          );
+          theMsg()->popEpoch(cur_epoch);
+          theTerm()->consume(cur_epoch);
+        }
+      );
+    }
+  }
+
+  theMsg()->popEpoch(cur_epoch);
+  return messaging::PendingSend{nullptr};
+}
+
+template <typename ColT, typename IndexT, typename MsgT>
+/*static*/ void CollectionManager::regionBcastHandler(
+  RegionBcastMsg<ColT, MsgT>* msg
+) {
+  auto const cur_epoch = theMsg()->getEpochContextMsg(msg);
+  theMsg()->pushEpoch(cur_epoch);
+
+  vtAssert(
+    msg->nodes_.size() > 0 and msg->nodes_[0] == theContext()->getNode(),
+    "Region broadcast must be addressed to this node"
+  );
+
+  vt_debug_print(
+    verbose, vrt_coll,
+    "regionBcastHandler: proxy={:x}, subtree={}, num_local={}\n",
+    msg->proxy_, msg->nodes_.size(), msg->idxs_[0].size()
+  );
+
+  regionBcastForward<ColT, IndexT, MsgT>(
+    msg->proxy_, msg->nodes_, msg->idxs_, 1, msg->payload_
+  );
+
+  auto user_msg = unpackRegionPayload<MsgT>(msg->payload_);
+  regionBcastDeliver<ColT, IndexT, MsgT>(
+    msg->proxy_, user_msg.get(), msg->idxs_[0], msg->payload_
+  );
+
+  theMsg()->popEpoch(cur_epoch);
+}
+
+template <typename ColT, typename IndexT, typename MsgT>
+/*static*/ void CollectionManager::regionBcastForward(
+  VirtualProxyType proxy, std::vector<NodeType> const& nodes,
+  std::vector<std::vector<IndexT>> const& idxs, std::size_t begin,
+  std::vector<char> const& payload
+) {
+  using RegionMsgType = RegionBcastMsg<ColT, MsgT>;
+
+  if (begin >= nodes.size()) {
+    return;
+  }
+
+  auto const fanout = static_cast<std::size_t>(region_bcast_fanout);
+  auto const num = nodes.size() - begin;
+  auto const chunk = (num + fanout - 1) / fanout;
+
+  for (auto lo = begin; lo < nodes.size(); lo += chunk) {
+    auto const hi = std::min(lo + chunk, nodes.size());
+    auto child = makeMessage<RegionMsgType>(
+      proxy,
+      std::vector<NodeType>(nodes.begin() + lo, nodes.begin() + hi),
+      std::vector<std::vector<IndexT>>(idxs.begin() + lo, idxs.begin() + hi),
+      payload
+    );
+    theMsg()->markAsCollectionMessage(child);
+    theMsg()->sendMsg<RegionMsgType, regionBcastHandler<ColT, IndexT, MsgT>>(
+      nodes[lo], child
+    );
+  }
+}
+
+template <typename ColT, typename IndexT, typename MsgT>
+/*static*/ void CollectionManager::regionBcastDeliver(
+  VirtualProxyType proxy, MsgT* msg, std::vector<IndexT> const& idxs,
+  std::vector<char> const& payload
+) {
+  auto const col_msg = static_cast<CollectionMessage<ColT>*>(msg);
+  auto const handler = col_msg->getVrtHandler();
+  auto const from = col_msg->getFromNode();
+  auto elm_holder = theCollection()->findElmHolder<IndexT>(proxy);
+
+  trace::TraceEventIDType trace_event = trace::no_trace_event;
+  #if vt_check_enabled(trace_enabled)
+    trace_event = col_msg->getFromTraceEvent();
+  #endif
+
+  std::vector<Indexable<IndexT>*> bases;
+  bases.reserve(idxs.size());
+
+  for (auto&& idx : idxs) {
+    if (elm_holder != nullptr and elm_holder->exists(idx)) {
+      bases.push_back(elm_holder->lookup(idx).getRawPtr());
+    } else {
+      // The element is not here (stale cache or it migrated away): send a
+      // copy point-to-point so the location manager routes it
+      auto copy = unpackRegionPayload<MsgT>(payload);
+      envelopeUnlockForForwarding(copy->env);
+      theCollection()->sendMsgUntypedHandler<MsgT, ColT, IndexT>(
+        VirtualElmProxyType<ColT>{proxy, idx}, copy.get(), handler
+      );
+    }
+  }
+
+  collectionAutoMsgDeliverLocal<ColT,IndexT,MsgT>(
+    msg, bases, handler, from, trace_event
+  );
+}
+
 template <typename ColT, typename MsgT, ActiveTypedFnType<MsgT> *f>
 messaging::PendingSend CollectionManager::reduceMsgExpr(
   CollectionProxyWrapType<ColT> const& proxy,
@@ -942,48 +1326,58 @@ messaging::PendingSend CollectionManager::reduceMsgExpr(
   auto const col_proxy = proxy.getProxy();
   auto const cur_epoch = theMsg()->getEpochContextMsg(msg);
 
-  theMsg()->pushEpoch(cur_epoch);
-  auto elm_holder = findElmHolder<IndexT>(col_proxy);
-
-  std::size_t num_elms = 0;
-  if (expr_fn == nullptr) {
-    num_elms = elm_holder->numElements();
-  } else {
-    num_elms = elm_holder->numElementsExpr(expr_fn);
+  auto cur_stamp = stamp;
+  if (cur_stamp == ReduceStamp{}) {
+    cur_stamp = proxy(idx).tryGetLocalPtr()->getNextStamp();
   }
 
-  auto const root_node =
-    root == uninitialized_destination ? default_collection_reduce_root_node :
-    root;
+  auto reduce_action = [=]{
+    theMsg()->pushEpoch(cur_epoch);
+    auto elm_holder = findElmHolder<IndexT>(col_proxy);
 
-  auto const group_ready = elm_holder->groupReady();
-  auto const send_group = elm_holder->useGroup();
-  auto const group = elm_holder->group();
-  bool const use_group = group_ready && send_group;
+    std::size_t num_elms = 0;
+    if (expr_fn == nullptr) {
+      num_elms = elm_holder->numElements();
+    } else {
+      num_elms = elm_holder->numElementsExpr(expr_fn);
+    }
 
-  vtAssert(group_ready, "Must be ready");
+    auto const root_node =
+      root == uninitialized_destination ? default_collection_reduce_root_node :
+      root;
 
-  auto cur_stamp = stamp;
-  if (cur_stamp == ReduceStamp{}) {
-    cur_stamp = proxy(idx).tryGetLocalPtr()->getNextStamp();
-  }
+    auto const group_ready = elm_holder->groupReady();
+    auto const send_group = elm_holder->useGroup();
+    auto const group = elm_holder->group();
+    bool const use_group = group_ready && send_group;
 
-  collective::reduce::Reduce* r = nullptr;
-  if (use_group) {
-    r = theGroup()->groupReducer(group);
-  } else {
-    r = theCollective()->getReducerVrtProxy(col_proxy);
-  }
+    vtAssert(group_ready, "Must be ready");
 
-  r->reduceImmediate<MsgT,f>(root_node, msg.get(), cur_stamp, num_elms);
+    collective::reduce::Reduce* r = nullptr;
+    if (use_group) {
+      r = theGroup()->groupReducer(group);
+    } else {
+      r = theCollective()->getReducerVrtProxy(col_proxy);
+    }
 
-  vt_debug_print(
-    normal, vrt_coll,
-    "reduceMsg: col_proxy={:x}, num_elms={}\n",
-    col_proxy, num_elms
-  );
+    r->reduceImmediate<MsgT,f>(root_node, msg.get(), cur_stamp, num_elms);
 
-  theMsg()->popEpoch(cur_epoch);
+    vt_debug_print(
+      normal, vrt_coll,
+      "reduceMsg: col_proxy={:x}, num_elms={}\n",
+      col_proxy, num_elms
+    );
+
+    theMsg()->popEpoch(cur_epoch);
+  };
+
+  // The reducers are not thread-safe: a contribution made inside a fork-join
+  // section is applied on the comm thread when the section merges
+  if (worker::ForkJoinSection::current() != nullptr) {
+    return messaging::PendingSend{cur_epoch, reduce_action};
+  }
+
+  reduce_action();
   return messaging::PendingSend{nullptr};
 }
 
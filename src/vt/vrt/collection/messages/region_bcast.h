@@ -0,0 +1,182 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                region_bcast.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_MESSAGES_REGION_BCAST_H
+#define INCLUDED_VT_VRT_COLLECTION_MESSAGES_REGION_BCAST_H
+
+#include "vt/config.h"
+#include "vt/messaging/message.h"
+
+#include <checkpoint/checkpoint.h>
+
+#include <cstring>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection {
+
+/// Number of children each node forwards a region broadcast to
+static constexpr NodeType const region_bcast_fanout = 4;
+
+/**
+ * \struct RegionBcastMsg
+ *
+ * \brief Carries a region broadcast down a spanning tree built over only the
+ * nodes that host targeted elements.
+ *
+ * \c nodes_[0] is the receiver; the rest of \c nodes_ is the subtree it is
+ * responsible for forwarding to. \c idxs_[i] lists the indices targeted on
+ * \c nodes_[i]. The user's message travels packed in \c payload_ so that it
+ * can be unpacked once per node and copied for elements that must be
+ * re-routed after a migration.
+ */
+template <typename ColT, typename MsgT>
+struct RegionBcastMsg : ::vt::Message {
+  using IndexType = typename ColT::IndexType;
+  using IndexListType = std::vector<IndexType>;
+
+  using MessageParentType = ::vt::Message;
+  vt_msg_serialize_required(); // nodes_, idxs_, payload_
+
+  RegionBcastMsg() = default;
+  RegionBcastMsg(
+    VirtualProxyType in_proxy, std::vector<NodeType> in_nodes,
+    std::vector<IndexListType> in_idxs, std::vector<char> const& in_payload
+  ) : proxy_(in_proxy),
+      nodes_(std::move(in_nodes)),
+      idxs_(std::move(in_idxs)),
+      payload_(in_payload)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | proxy_
+      | nodes_
+      | idxs_
+      | payload_;
+  }
+
+  VirtualProxyType proxy_ = no_vrt_proxy;
+  std::vector<NodeType> nodes_ = {};
+  std::vector<IndexListType> idxs_ = {};
+  std::vector<char> payload_ = {};
+};
+
+/**
+ * \internal \brief Pack a message that requires serialization into bytes
+ *
+ * \param[in] msg the message
+ *
+ * \return the packed bytes
+ */
+template <typename MsgT>
+std::enable_if_t<
+  ::vt::messaging::msg_serialization_mode<MsgT>::required, std::vector<char>
+> packRegionPayload(MsgT* msg) {
+  std::vector<char> bytes;
+  envelopeSetIsLocked(msg->env, true); // implies locked on unpack
+  envelopeSetHasBeenSerialized(msg->env, false);
+  checkpoint::serialize(*msg, [&](std::size_t size) -> char* {
+    bytes.resize(size);
+    return bytes.data();
+  });
+  return bytes;
+}
+
+/**
+ * \internal \brief Pack a byte-copyable message into bytes
+ *
+ * \param[in] msg the message
+ *
+ * \return the packed bytes
+ */
+template <typename MsgT>
+std::enable_if_t<
+  not ::vt::messaging::msg_serialization_mode<MsgT>::required,
+  std::vector<char>
+> packRegionPayload(MsgT* msg) {
+  envelopeSetIsLocked(msg->env, true); // implies locked on unpack
+  std::vector<char> bytes(sizeof(MsgT));
+  std::memcpy(bytes.data(), static_cast<void*>(msg), sizeof(MsgT));
+  return bytes;
+}
+
+/**
+ * \internal \brief Rebuild a message that requires serialization from bytes
+ *
+ * \param[in] bytes the packed bytes
+ *
+ * \return the new message
+ */
+template <typename MsgT>
+std::enable_if_t<
+  ::vt::messaging::msg_serialization_mode<MsgT>::required, MsgPtr<MsgT>
+> unpackRegionPayload(std::vector<char> const& bytes) {
+  MsgT* msg = ::vt::detail::makeMessageImpl<MsgT>();
+  checkpoint::deserializeInPlace<MsgT>(const_cast<char*>(bytes.data()), msg);
+  envelopeInitRecv(msg->env);
+  return MsgPtr<MsgT>(msg);
+}
+
+/**
+ * \internal \brief Rebuild a byte-copyable message from bytes
+ *
+ * \param[in] bytes the packed bytes
+ *
+ * \return the new message
+ */
+template <typename MsgT>
+std::enable_if_t<
+  not ::vt::messaging::msg_serialization_mode<MsgT>::required, MsgPtr<MsgT>
+> unpackRegionPayload(std::vector<char> const& bytes) {
+  vtAssert(bytes.size() == sizeof(MsgT), "Payload must hold one message");
+  MsgT* msg = ::vt::detail::makeMessageImpl<MsgT>(
+    *reinterpret_cast<MsgT const*>(bytes.data())
+  );
+  envelopeInitRecv(msg->env);
+  return MsgPtr<MsgT>(msg);
+}
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_MESSAGES_REGION_BCAST_H*/
@@ -0,0 +1,115 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             fork_join_section.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/worker/fork_join_section.h"
+#include "vt/context/context.h"
+#include "vt/context/context_attorney.h"
+#include "vt/termination/termination.h"
+
+namespace vt { namespace worker {
+
+DeclareClassOutsideInitTLS(ForkJoinSection, ForkJoinSection*, current_, nullptr)
+
+/*static*/ util::atomic::AtomicType<int> ForkJoinSection::num_active_ = {0};
+
+ForkJoinSection::ForkJoinSection(EpochType in_epoch) {
+  if (in_epoch != no_epoch) {
+    epoch_stack_.push(in_epoch);
+  }
+}
+
+ForkJoinSection::Scope::Scope(ForkJoinSection* in_section)
+  : prev_(AccessClassTLS(ForkJoinSection, current_))
+{
+  num_active_.fetch_add(1);
+  AccessClassTLS(ForkJoinSection, current_) = in_section;
+}
+
+ForkJoinSection::Scope::~Scope() {
+  AccessClassTLS(ForkJoinSection, current_) = prev_;
+  num_active_.fetch_sub(1);
+}
+
+void ForkJoinSection::produceConsume(
+  EpochType epoch, term::TermCounterType num_units, bool produce,
+  NodeType node
+) {
+  auto& counts = produce ? produced_ : consumed_;
+  counts.push_back(Count{epoch, num_units, node});
+}
+
+void ForkJoinSection::defer(ActionType action) {
+  deferred_.push_back(Deferred{theContext()->getTask(), std::move(action)});
+}
+
+/*static*/ void ForkJoinSection::merge(std::vector<ForkJoinSection>& sections) {
+  vtAssert(current() == nullptr, "Sections must be merged outside a section");
+
+  for (auto&& s : sections) {
+    for (auto&& c : s.produced_) {
+      theTerm()->produce(c.epoch_, c.num_units_, c.node_);
+    }
+  }
+
+  auto const prev_task = theContext()->getTask();
+  for (auto&& s : sections) {
+    for (auto&& d : s.deferred_) {
+      // Restore the task that deferred the action so LB communication and
+      // the current-task queries resolve to the originating element
+      ctx::ContextAttorney::setTask(d.task_);
+      d.action_();
+    }
+  }
+  ctx::ContextAttorney::setTask(prev_task);
+
+  for (auto&& s : sections) {
+    for (auto&& c : s.consumed_) {
+      theTerm()->consume(c.epoch_, c.num_units_, c.node_);
+    }
+  }
+
+  sections.clear();
+}
+
+}} /* end namespace vt::worker */
@@ -0,0 +1,185 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             fork_join_section.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_WORKER_FORK_JOIN_SECTION_H
+#define INCLUDED_VT_WORKER_FORK_JOIN_SECTION_H
+
+#include "vt/config.h"
+#include "vt/termination/term_common.h"
+#include "vt/utils/tls/tls.h"
+#include "vt/utils/atomic/atomic.h"
+
+#include <stack>
+#include <vector>
+
+namespace vt { namespace runnable {
+struct RunnableNew;
+}} /* end namespace vt::runnable */
+
+namespace vt { namespace worker {
+
+/**
+ * \struct ForkJoinSection
+ *
+ * \brief The state of one chunk of a \c forkJoin, installed on the thread
+ * running it so that ordinary handlers may execute off the comm thread
+ *
+ * While a section is active on a thread, the runtime state that is only safe
+ * to touch from the comm thread is redirected into the section:
+ *  - the active messenger's epoch stack is replaced by a section-local stack
+ *    seeded with the comm thread's current epoch;
+ *  - termination produces and consumes are accumulated instead of applied;
+ *  - releasing a pending send (sends, broadcasts, collection reductions) and
+ *    closing a trace processing event are deferred as actions.
+ *
+ * After the join the comm thread merges the sections in chunk order: all
+ * produces first, then the deferred actions, then all consumes. The comm
+ * thread does not run the scheduler while the chunks execute, so no
+ * termination wave can observe the intermediate counts.
+ */
+struct ForkJoinSection {
+  using EpochStackType = std::stack<EpochType>;
+
+  /**
+   * \brief Construct a section
+   *
+   * \param[in] in_epoch the comm thread's current epoch at the fork
+   */
+  explicit ForkJoinSection(EpochType in_epoch);
+
+  ForkJoinSection(ForkJoinSection&&) = default;
+  ForkJoinSection(ForkJoinSection const&) = delete;
+  ForkJoinSection& operator=(ForkJoinSection const&) = delete;
+
+  /**
+   * \brief Get the section active on the calling thread. The hooks on the
+   * messaging and termination paths call this for every message, so the TLS
+   * lookup is skipped unless some thread has a section installed.
+   *
+   * \return the section, \c nullptr outside of a \c forkJoin chunk
+   */
+  static ForkJoinSection* current() {
+    if (num_active_.load(std::memory_order_relaxed) == 0) {
+      return nullptr;
+    }
+    return AccessClassTLS(ForkJoinSection, current_);
+  }
+
+  /**
+   * \struct Scope
+   *
+   * \brief Installs a section on the calling thread for its lifetime
+   */
+  struct Scope {
+    explicit Scope(ForkJoinSection* in_section);
+    Scope(Scope const&) = delete;
+    ~Scope();
+
+  private:
+    ForkJoinSection* prev_ = nullptr;
+  };
+
+  /**
+   * \brief Get the epoch stack used on this thread while the section is active
+   *
+   * \return the section-local epoch stack
+   */
+  EpochStackType& getEpochStack() { return epoch_stack_; }
+
+  /**
+   * \brief Record a termination produce or consume
+   *
+   * \param[in] epoch the epoch
+   * \param[in] num_units the number of units
+   * \param[in] produce whether it is a produce
+   * \param[in] node the node argument passed to the termination detector
+   */
+  void produceConsume(
+    EpochType epoch, term::TermCounterType num_units, bool produce,
+    NodeType node
+  );
+
+  /**
+   * \brief Defer an action to run on the comm thread after the join. The
+   * current task on this thread is restored while the action runs.
+   *
+   * \param[in] action the action
+   */
+  void defer(ActionType action);
+
+  /**
+   * \brief Apply the accumulated produces of a set of sections, run their
+   * deferred actions, then apply their consumes; called on the comm thread
+   * after the join
+   *
+   * \param[in] sections the sections in chunk order
+   */
+  static void merge(std::vector<ForkJoinSection>& sections);
+
+private:
+  struct Count {
+    EpochType epoch_ = no_epoch;
+    term::TermCounterType num_units_ = 0;
+    NodeType node_ = uninitialized_destination;
+  };
+
+  struct Deferred {
+    runnable::RunnableNew* task_ = nullptr;
+    ActionType action_ = nullptr;
+  };
+
+  EpochStackType epoch_stack_;
+  std::vector<Count> produced_;
+  std::vector<Count> consumed_;
+  std::vector<Deferred> deferred_;
+
+  /// The number of sections installed across all threads; a thread always
+  /// observes its own increment before it looks up its section
+  static util::atomic::AtomicType<int> num_active_;
+
+  DeclareClassInsideInitTLS(ForkJoinSection, ForkJoinSection*, current_, nullptr)
+};
+
+}} /* end namespace vt::worker */
+
+#endif /*INCLUDED_VT_WORKER_FORK_JOIN_SECTION_H*/
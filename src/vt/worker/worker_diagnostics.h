@@ -0,0 +1,157 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             worker_diagnostics.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_WORKER_WORKER_DIAGNOSTICS_H
+#define INCLUDED_VT_WORKER_WORKER_DIAGNOSTICS_H
+
+#include "vt/config.h"
+#include "vt/worker/worker_common.h"
+#include "vt/runtime/component/diagnostic_meter.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace vt { namespace worker {
+
+/**
+ * \struct WorkerDiagnostics
+ *
+ * \brief Per-worker executed, stolen and idle counters of a worker group
+ *
+ * The work-stealing queues count with atomics on the worker threads. The
+ * diagnostic counters are not thread-safe, so the comm thread transfers the
+ * change since the previous \c sync into them. Syncing on every progress keeps
+ * live samples current; each unit of work is counted exactly once no matter
+ * how often \c sync is called.
+ */
+struct WorkerDiagnostics {
+  using CountType = uint64_t;
+  using RegisterFnType = std::function<
+    diagnostic::Counter(std::string const&, std::string const&)
+  >;
+
+  /**
+   * \brief Register the counters for each worker
+   *
+   * \param[in] num_workers the number of workers
+   * \param[in] reg registers a counter on the owning component
+   */
+  void registerCounters(WorkerCountType num_workers, RegisterFnType reg) {
+    executed_.clear();
+    stolen_.clear();
+    idle_.clear();
+
+    for (WorkerCountType i = 0; i < num_workers; i++) {
+      auto const id = std::to_string(i);
+      executed_.emplace_back(
+        reg("worker_" + id + "_executed", "work units executed by worker " + id)
+      );
+      stolen_.emplace_back(
+        reg("worker_" + id + "_stolen", "work units stolen by worker " + id)
+      );
+      idle_.emplace_back(
+        reg("worker_" + id + "_idle", "times worker " + id + " parked idle")
+      );
+    }
+  }
+
+  /**
+   * \brief Add the counts accumulated by the queues since the last sync;
+   * called only from the comm thread
+   *
+   * \param[in] queues the work-stealing queues
+   */
+  template <typename QueuesT>
+  void sync(QueuesT const& queues) {
+    for (std::size_t i = 0; i < executed_.size(); i++) {
+      auto const id = static_cast<WorkerIDType>(i);
+      executed_[i].sync(queues.getExecuted(id));
+      stolen_[i].sync(queues.getStolen(id));
+      idle_[i].sync(queues.getIdle(id));
+    }
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | executed_
+      | stolen_
+      | idle_;
+  }
+
+private:
+  /**
+   * \internal \brief A counter fed from a monotonic atomic total
+   */
+  struct Tracked {
+    Tracked() = default;
+    explicit Tracked(diagnostic::Counter in_counter)
+      : counter_(in_counter)
+    { }
+
+    void sync(CountType total) {
+      if (total > last_) {
+        counter_.increment(total - last_);
+        last_ = total;
+      }
+    }
+
+    template <typename SerializerT>
+    void serialize(SerializerT& s) {
+      s | counter_
+        | last_;
+    }
+
+    diagnostic::Counter counter_;
+    CountType last_ = 0;
+  };
+
+  std::vector<Tracked> executed_;
+  std::vector<Tracked> stolen_;
+  std::vector<Tracked> idle_;
+};
+
+}} /* end namespace vt::worker */
+
+#endif /*INCLUDED_VT_WORKER_WORKER_DIAGNOSTICS_H*/
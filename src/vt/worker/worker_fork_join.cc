@@ -0,0 +1,150 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             worker_fork_join.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/context/context.h"
+#include "vt/worker/worker_fork_join.h"
+#include "vt/worker/fork_join_section.h"
+#include "vt/worker/worker_headers.h"
+#include "vt/messaging/active.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace vt { namespace worker {
+
+bool canForkJoin() {
+#if vt_check_enabled(stdthread) || vt_check_enabled(openmp)
+  return
+    theContext()->hasWorkers() and
+    theContext()->getWorker() == worker_id_comm_thread and
+    theWorkerGrp() != nullptr;
+#else
+  return false;
+#endif
+}
+
+std::size_t forkJoinChunkSize(std::size_t num_units) {
+#if vt_check_enabled(stdthread) || vt_check_enabled(openmp)
+  if (canForkJoin() and num_units >= 2) {
+    auto const num_workers = static_cast<std::size_t>(
+      theContext()->getNumWorkers()
+    );
+    // One chunk per worker plus one for the comm thread
+    auto const num_chunks = std::min(num_units, num_workers + 1);
+    return (num_units + num_chunks - 1) / num_chunks;
+  }
+#endif
+  return num_units;
+}
+
+void forkJoin(std::vector<ActionType> const& work) {
+  std::size_t const num_units = work.size();
+
+  if (not canForkJoin() or num_units < 2) {
+    for (auto&& unit : work) {
+      unit();
+    }
+    return;
+  }
+
+#if vt_check_enabled(stdthread) || vt_check_enabled(openmp)
+  auto const chunk_size = forkJoinChunkSize(num_units);
+  auto const num_chunks = (num_units + chunk_size - 1) / chunk_size;
+
+  // Each chunk accumulates its termination and deferred communication state
+  // in a section that is merged on the comm thread after the join
+  std::vector<ForkJoinSection> sections;
+  sections.reserve(num_chunks);
+  for (std::size_t chunk = 0; chunk < num_chunks; chunk++) {
+    sections.emplace_back(theMsg()->getEpoch());
+  }
+
+  std::mutex join_mutex;
+  std::condition_variable join_cv;
+  std::size_t remaining = num_chunks - 1;
+
+  auto run_chunk = [&work, &sections, chunk_size, num_units](std::size_t chunk) {
+    ForkJoinSection::Scope scope{&sections[chunk]};
+    auto const begin = chunk * chunk_size;
+    auto const end = std::min(begin + chunk_size, num_units);
+    for (auto i = begin; i < end; i++) {
+      work[i]();
+    }
+  };
+
+  vt_debug_print(
+    normal, worker,
+    "forkJoin: units={}, chunks={}, chunk_size={}\n",
+    num_units, num_chunks, chunk_size
+  );
+
+  for (std::size_t chunk = 1; chunk < num_chunks; chunk++) {
+    auto const worker_id = static_cast<WorkerIDType>(chunk - 1);
+    theWorkerGrp()->enqueueForWorker(
+      worker_id, [&run_chunk, &join_mutex, &join_cv, &remaining, chunk]{
+        run_chunk(chunk);
+        std::lock_guard<std::mutex> guard{join_mutex};
+        if (--remaining == 0) {
+          join_cv.notify_one();
+        }
+      }
+    );
+  }
+
+  // The comm thread takes the first chunk
+  run_chunk(0);
+
+  // Wait for the workers; the scheduler must not run here because other work
+  // may target the same elements and break per-element serialization
+  {
+    std::unique_lock<std::mutex> lock{join_mutex};
+    join_cv.wait(lock, [&remaining]{ return remaining == 0; });
+  }
+
+  ForkJoinSection::merge(sections);
+#endif
+}
+
+}} /* end namespace vt::worker */
@@ -0,0 +1,92 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              worker_fork_join.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_WORKER_WORKER_FORK_JOIN_H
+#define INCLUDED_VT_WORKER_WORKER_FORK_JOIN_H
+
+#include "vt/config.h"
+
+#include <vector>
+
+namespace vt { namespace worker {
+
+/**
+ * \brief Whether \c forkJoin can execute work concurrently on worker threads
+ *
+ * \return whether preemptive worker threads are available on this node
+ */
+bool canForkJoin();
+
+/**
+ * \brief The number of consecutive work units \c forkJoin runs in each chunk
+ *
+ * \param[in] num_units the number of work units
+ *
+ * \return the chunk size; \c num_units when the work would run sequentially
+ */
+std::size_t forkJoinChunkSize(std::size_t num_units);
+
+/**
+ * \brief Execute a set of independent work units concurrently on the worker
+ * threads and the comm thread, returning when all have finished.
+ *
+ * The work units are split into contiguous chunks, one per worker plus one run
+ * on the calling (comm) thread. The comm thread blocks (without running the
+ * scheduler) until every chunk has completed, so nothing else on this node
+ * runs concurrently with the work units except the work units themselves.
+ *
+ * Each chunk runs inside a \c ForkJoinSection: termination produces and
+ * consumes, pending sends and trace events issued by the work units are
+ * accumulated per chunk and merged on the comm thread after the join, so work
+ * units may send messages and contribute to reductions. Other runtime
+ * components that are not thread-safe must still not be accessed. If workers
+ * are not available, the work units are run sequentially on the calling
+ * thread.
+ *
+ * \param[in] work the work units to execute
+ */
+void forkJoin(std::vector<ActionType> const& work);
+
+}} /* end namespace vt::worker */
+
+#endif /*INCLUDED_VT_WORKER_WORKER_FORK_JOIN_H*/
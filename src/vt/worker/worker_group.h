@@ -49,11 +49,13 @@
 #include "vt/worker/worker.h"
 #include "vt/worker/worker_group_counter.h"
 #include "vt/worker/worker_group_comm.h"
+#include "vt/worker/worker_diagnostics.h"
 #include "vt/utils/atomic/atomic.h"
 #include "vt/runtime/component/component_pack.h"
 
 #if vt_check_enabled(stdthread)
   #include "vt/worker/worker_stdthread.h"
+  #include "vt/worker/worker_stealing.h"
 #elif vt_check_enabled(fcontext)
   #include "vt/worker/worker_seq.h"
 #endif
@@ -95,19 +97,31 @@ struct WorkerGroupAny
 
   std::string name() override { return "WorkerGroup"; }
 
+  void preDiagnostic() override;
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | finished_fn_
       | initialized_
       | num_workers_
-      | workers_;
+      | next_worker_
+      | workers_
+      | worker_diagnostics_;
   }
 
 private:
   WorkerFinishedFnType finished_fn_ = nullptr;
   bool initialized_ = false;
   WorkerCountType num_workers_ = 0;
+  // Round-robin cursor; workers may enqueue concurrently with the comm thread
+  AtomicType<uint64_t> next_worker_ = {0};
   WorkerContainerType workers_;
+# if vt_check_enabled(stdthread)
+  std::unique_ptr<WorkStealingQueues> queues_ = nullptr;
+# endif
+
+  // Per-worker diagnostic counters, updated from the work-stealing queues
+  WorkerDiagnostics worker_diagnostics_;
 };
 
 #if vt_check_enabled(stdthread)
@@ -51,9 +51,31 @@
 
 #include <functional>
 #include <cstdint>
+#include <type_traits>
 
 namespace vt { namespace worker {
 
+namespace detail {
+
+template <typename WorkerT, typename QueuesT>
+std::unique_ptr<WorkerT> makeWorker(
+  WorkerIDType id, WorkerCountType num_workers, WorkerFinishedFnType fn,
+  QueuesT* queues, std::true_type
+) {
+  // Workers that support it share the group's work-stealing queues
+  return std::make_unique<WorkerT>(id, num_workers, fn, queues);
+}
+
+template <typename WorkerT, typename QueuesT>
+std::unique_ptr<WorkerT> makeWorker(
+  WorkerIDType id, WorkerCountType num_workers, WorkerFinishedFnType fn,
+  QueuesT*, std::false_type
+) {
+  return std::make_unique<WorkerT>(id, num_workers, fn);
+}
+
+} /* end namespace detail */
+
 template <typename WorkerT>
 WorkerGroupAny<WorkerT>::WorkerGroupAny()
   : WorkerGroupAny(num_default_workers)
@@ -78,6 +100,21 @@ void WorkerGroupAny<WorkerT>::initialize() {
   finished_fn_ = std::bind(&WorkerGroupAny::finished, this, ph::_1, ph::_2);
 
   workers_.resize(num_workers_);
+
+  worker_diagnostics_.registerCounters(
+    num_workers_, [this](std::string const& key, std::string const& desc) {
+      return this->registerCounter(key, desc);
+    }
+  );
+}
+
+template <typename WorkerT>
+void WorkerGroupAny<WorkerT>::preDiagnostic() {
+# if vt_check_enabled(stdthread)
+  if (queues_ != nullptr) {
+    worker_diagnostics_.sync(*queues_);
+  }
+# endif
 }
 
 template <typename WorkerT>
@@ -104,7 +141,12 @@ void WorkerGroupAny<WorkerT>::enqueueAnyWorker(WorkUnitType const& work_unit) {
   vtAssert(initialized_, "Must be initialized to enqueue");
 
   this->enqueued();
-  workers_[0].enqueue(work_unit);
+
+  // Distribute round-robin; idle workers will steal from busy ones
+  auto const worker_id = static_cast<WorkerIDType>(
+    next_worker_.fetch_add(1) % static_cast<uint64_t>(num_workers_)
+  );
+  workers_[worker_id]->enqueue(work_unit);
 }
 
 template <typename WorkerT>
@@ -140,6 +182,13 @@ int WorkerGroupAny<WorkerT>::progress() {
 
   WorkerGroupCounter::progress();
 
+# if vt_check_enabled(stdthread)
+  // Keep the worker counters current for live diagnostic samples
+  if (queues_ != nullptr) {
+    worker_diagnostics_.sync(*queues_);
+  }
+# endif
+
   return 0;
 }
 
@@ -171,10 +220,26 @@ void WorkerGroupAny<WorkerT>::spawnWorkers() {
     "Must be correct size"
   );
 
+# if vt_check_enabled(stdthread)
+  using QueuesType = WorkStealingQueues;
+  queues_ = std::make_unique<QueuesType>(num_workers_);
+  QueuesType* queues = queues_.get();
+# else
+  using QueuesType = void;
+  QueuesType* queues = nullptr;
+# endif
+
+  using UsesQueuesType = std::integral_constant<
+    bool,
+    std::is_constructible<
+      WorkerT, WorkerIDType, WorkerCountType, WorkerFinishedFnType, QueuesType*
+    >::value
+  >;
+
   for (int i = 0; i < num_workers_; i++) {
     WorkerIDType const worker_id = i;
-    workers_[i] = std::make_unique<WorkerT>(
-      worker_id, num_workers_, finished_fn_
+    workers_[i] = detail::makeWorker<WorkerT>(
+      worker_id, num_workers_, finished_fn_, queues, UsesQueuesType{}
     );
   }
 
@@ -202,6 +267,13 @@ void WorkerGroupAny<WorkerT>::joinWorkers() {
 
   workers_.clear();
 
+# if vt_check_enabled(stdthread)
+  if (queues_ != nullptr) {
+    worker_diagnostics_.sync(*queues_);
+  }
+  queues_ = nullptr;
+# endif
+
   initialized_ = false;
 }
 
@@ -45,6 +45,7 @@
 #include "vt/context/context.h"
 #include "vt/worker/worker_common.h"
 #include "vt/worker/worker_group_comm.h"
+#include "vt/scheduler/scheduler.h"
 
 namespace vt { namespace worker {
 
@@ -55,6 +56,7 @@ void WorkerGroupComm::enqueueComm(WorkUnitType const& work_unit) {
   );
 
   comm_work_deque_.pushBack(work_unit);
+  theSched()->wakeIdle();
 }
 
 bool WorkerGroupComm::schedulerComm(WorkerFinishedFnType finished_fn) {
@@ -46,6 +46,7 @@
 #include "vt/worker/worker_common.h"
 #include "vt/worker/worker_group_counter.h"
 #include "vt/termination/term_headers.h"
+#include "vt/scheduler/scheduler.h"
 
 #include <cassert>
 #include <functional>
@@ -66,6 +67,7 @@ void WorkerGroupCounter::enqueued(WorkUnitCountType num) {
     enqueuedComm(num);
   } else {
     enqueued_count_.push(num);
+    theSched()->wakeIdle();
   }
 }
 
@@ -97,6 +99,9 @@ void WorkerGroupCounter::finished(WorkerIDType id, WorkUnitCountType num) {
   if (is_idle) {
     maybe_idle_.store(is_idle);
   }
+
+  // The comm thread may be blocked idle waiting for this completion
+  theSched()->wakeIdle();
 }
 
 void WorkerGroupCounter::assertCommThread() {
@@ -74,6 +74,17 @@ void WorkerGroupOMP::initialize() {
   finished_fn_ = std::bind(&WorkerGroupOMP::finished, this, ph::_1, ph::_2);
 
   worker_state_.resize(num_workers_);
+  queues_ = std::make_unique<WorkStealingQueues>(num_workers_);
+
+  worker_diagnostics_.registerCounters(
+    num_workers_, [this](std::string const& key, std::string const& desc) {
+      return registerCounter(key, desc);
+    }
+  );
+}
+
+void WorkerGroupOMP::preDiagnostic() {
+  worker_diagnostics_.sync(*queues_);
 }
 
 bool WorkerGroupOMP::commScheduler() {
@@ -82,6 +93,9 @@ bool WorkerGroupOMP::commScheduler() {
 
 int WorkerGroupOMP::progress() {
   WorkerGroupCounter::progress();
+
+  // Keep the worker counters current for live diagnostic samples
+  worker_diagnostics_.sync(*queues_);
   return 0;
 }
 
@@ -135,7 +149,7 @@ void WorkerGroupOMP::spawnWorkersBlock(WorkerCommFnType comm_fn) {
       );
 
       worker_state_[thd] = std::make_unique<WorkerStateType>(
-        thd, nthds, finished_fn_
+        thd, nthds, finished_fn_, queues_.get()
       );
       ready_++;
       worker_state_[thd]->spawn();
@@ -186,7 +200,12 @@ void WorkerGroupOMP::enqueueAnyWorker(WorkUnitType const& work_unit) {
   #endif
 
   this->enqueued();
-  worker_state_[0]->enqueue(work_unit);
+
+  // Distribute round-robin; idle workers will steal from busy ones
+  auto const worker_id = static_cast<WorkerIDType>(
+    next_worker_.fetch_add(1) % static_cast<uint64_t>(num_workers_)
+  );
+  worker_state_[worker_id]->enqueue(work_unit);
 }
 
 void WorkerGroupOMP::enqueueForWorker(
@@ -51,8 +51,10 @@
 #include "vt/worker/worker_common.h"
 #include "vt/worker/worker_types.h"
 #include "vt/worker/worker_openmp.h"
+#include "vt/worker/worker_stealing.h"
 #include "vt/worker/worker_group_counter.h"
 #include "vt/worker/worker_group_comm.h"
+#include "vt/worker/worker_diagnostics.h"
 #include "vt/utils/mutex/mutex.h"
 #include "vt/runtime/component/component_pack.h"
 
@@ -71,7 +73,6 @@ struct WorkerGroupOMP
   using WorkerStatePtrType = std::unique_ptr<WorkerStateType>;
   using WorkerStateContainerType = std::vector<WorkerStatePtrType>;
   using WorkerFunType = std::function<void()>;
-  using WorkUnitContainerType = util::container::ConcurrentDeque<WorkUnitType>;
   using MutexType = util::mutex::MutexType;
 
   WorkerGroupOMP();
@@ -96,6 +97,8 @@ struct WorkerGroupOMP
   );
   void enqueueAllWorkers(WorkUnitType const& work_unit);
 
+  void preDiagnostic() override;
+
   template <typename SerializerT>
   void serialize(SerializerT& s) {
     s | finished_fn_
@@ -103,7 +106,9 @@ struct WorkerGroupOMP
       | initialized_
       | num_workers_
       | worker_state_
-      | enqueue_worker_mutex_;
+      | enqueue_worker_mutex_
+      | next_worker_
+      | worker_diagnostics_;
   }
 
 private:
@@ -113,6 +118,12 @@ private:
   WorkerCountType num_workers_ = 0;
   WorkerStateContainerType worker_state_;
   MutexType enqueue_worker_mutex_{};
+  // Round-robin cursor; workers may enqueue concurrently with the comm thread
+  AtomicType<uint64_t> next_worker_ = {0};
+  std::unique_ptr<WorkStealingQueues> queues_ = nullptr;
+
+  // Per-worker diagnostic counters, updated from the work-stealing queues
+  WorkerDiagnostics worker_diagnostics_;
 };
 
 }} /* end namespace vt::worker */
@@ -61,11 +61,20 @@ namespace vt { namespace worker {
 OMPWorker::OMPWorker(
   WorkerIDType const& in_worker_id_, WorkerIDType const& in_num_thds,
   WorkerFinishedFnType finished_fn
-) : worker_id_(in_worker_id_), finished_fn_(finished_fn)
+) : worker_id_(in_worker_id_),
+    own_queues_(std::make_unique<WorkStealingQueuesType>(in_num_thds)),
+    queues_(own_queues_.get()),
+    finished_fn_(finished_fn)
+{ }
+
+OMPWorker::OMPWorker(
+  WorkerIDType const& in_worker_id_, WorkerIDType const&,
+  WorkerFinishedFnType finished_fn, WorkStealingQueuesType* in_queues
+) : worker_id_(in_worker_id_), queues_(in_queues), finished_fn_(finished_fn)
 { }
 
 void OMPWorker::enqueue(WorkUnitType const& work_unit) {
-  work_queue_.pushBack(work_unit);
+  queues_->push(worker_id_, work_unit);
 }
 
 void OMPWorker::progress() {
@@ -73,29 +82,25 @@ void OMPWorker::progress() {
 }
 
 void OMPWorker::scheduler() {
-  bool should_term_local = false;
-  do {
-    if (work_queue_.size() > 0) {
+  while (not should_terminate_.load()) {
+    if (queues_->runOne(worker_id_)) {
       #if DEBUG_OMP_WORKER_SCHEDULER
       vt_debug_print(
         normal, worker,
-        "OMPWorker: scheduler: size={}\n", work_queue_.size()
+        "OMPWorker: scheduler: ran work unit: id={}\n", worker_id_
       );
       #endif
 
-      auto elm = work_queue_.popGetBack();
-      elm();
       finished_fn_(worker_id_, 1);
+    } else {
+      queues_->park(worker_id_, should_terminate_);
     }
-
-    #pragma omp atomic read
-    should_term_local = should_terminate_;
-  } while (not should_term_local);
+  }
 }
 
 void OMPWorker::sendTerminateSignal() {
-  #pragma omp atomic write
-  should_terminate_ = true;
+  should_terminate_.store(true);
+  queues_->wakeup(worker_id_);
 
   vt_debug_print(normal, worker, "OMPWorker: sendTerminateSignal\n");
 }
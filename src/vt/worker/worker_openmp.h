@@ -50,21 +50,26 @@
 
 #include "vt/worker/worker_common.h"
 #include "vt/worker/worker_types.h"
-#include "vt/utils/container/concurrent_deque.h"
+#include "vt/worker/worker_stealing.h"
 
 #include <omp.h>
+#include <atomic>
 #include <memory>
 
 namespace vt { namespace worker {
 
 struct OMPWorker {
   using WorkerFunType = std::function<void()>;
-  using WorkUnitContainerType = util::container::ConcurrentDeque<WorkUnitType>;
+  using WorkStealingQueuesType = WorkStealingQueues;
 
   OMPWorker(
     WorkerIDType const& in_worker_id_, WorkerCountType const& in_num_thds,
     WorkerFinishedFnType finished_fn
   );
+  OMPWorker(
+    WorkerIDType const& in_worker_id_, WorkerCountType const& in_num_thds,
+    WorkerFinishedFnType finished_fn, WorkStealingQueuesType* in_queues
+  );
   OMPWorker(OMPWorker const&) = delete;
 
   void spawn();
@@ -79,7 +84,7 @@ struct OMPWorker {
   void serialize(Serializer& s) {
     s | should_terminate_
       | worker_id_
-      | work_queue_
+      | queues_
       | finished_fn_;
   }
 
@@ -87,9 +92,10 @@ private:
   void scheduler();
 
 private:
-  bool should_terminate_= false;
+  std::atomic<bool> should_terminate_ = {false};
   WorkerIDType worker_id_ = no_worker_id;
-  WorkUnitContainerType work_queue_;
+  std::unique_ptr<WorkStealingQueuesType> own_queues_ = nullptr;
+  WorkStealingQueuesType* queues_ = nullptr;
   WorkerFinishedFnType finished_fn_ = nullptr;
 };
 
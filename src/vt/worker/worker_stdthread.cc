@@ -58,13 +58,22 @@
 namespace vt { namespace worker {
 
 StdThreadWorker::StdThreadWorker(
-  WorkerIDType const& in_worker_id_, WorkerCountType const&,
+  WorkerIDType const& in_worker_id_, WorkerCountType const& in_num_workers,
   WorkerFinishedFnType finished_fn
-) : worker_id_(in_worker_id_), finished_fn_(finished_fn)
+) : worker_id_(in_worker_id_),
+    own_queues_(std::make_unique<WorkStealingQueuesType>(in_num_workers)),
+    queues_(own_queues_.get()),
+    finished_fn_(finished_fn)
+{ }
+
+StdThreadWorker::StdThreadWorker(
+  WorkerIDType const& in_worker_id_, WorkerCountType const&,
+  WorkerFinishedFnType finished_fn, WorkStealingQueuesType* in_queues
+) : worker_id_(in_worker_id_), queues_(in_queues), finished_fn_(finished_fn)
 { }
 
 void StdThreadWorker::enqueue(WorkUnitType const& work_unit) {
-  work_queue_.pushBack(work_unit);
+  queues_->push(worker_id_, work_unit);
 }
 
 void StdThreadWorker::progress() {
@@ -79,19 +88,20 @@ void StdThreadWorker::scheduler() {
   CollectiveOps::setCurrentRuntimeTLS();
 
   // Set the thread-local worker in the Context
-  ContextAttorney::setWorker(worker_id_comm_thread);
+  ContextAttorney::setWorker(worker_id_);
 
   while (not should_terminate_.load()) {
-    if (work_queue_.size() > 0) {
-      auto elm = work_queue_.popGetBack();
-      elm();
+    if (queues_->runOne(worker_id_)) {
       finished_fn_(worker_id_, 1);
+    } else {
+      queues_->park(worker_id_, should_terminate_);
     }
   }
 }
 
 void StdThreadWorker::sendTerminateSignal() {
   should_terminate_.store(true);
+  queues_->wakeup(worker_id_);
 }
 
 void StdThreadWorker::spawn() {
@@ -50,7 +50,7 @@
 
 #include "vt/worker/worker_common.h"
 #include "vt/worker/worker_types.h"
-#include "vt/utils/container/concurrent_deque.h"
+#include "vt/worker/worker_stealing.h"
 
 #include <thread>
 #include <functional>
@@ -63,12 +63,16 @@ struct StdThreadWorker {
   using WorkerFunType = std::function<void()>;
   using ThreadType = std::thread;
   using ThreadPtrType = std::unique_ptr<ThreadType>;
-  using WorkUnitContainerType = util::container::ConcurrentDeque<WorkUnitType>;
+  using WorkStealingQueuesType = WorkStealingQueues;
 
   StdThreadWorker(
-    WorkerIDType const& in_worker_id_, WorkerCountType const&,
+    WorkerIDType const& in_worker_id_, WorkerCountType const& in_num_workers,
     WorkerFinishedFnType finished_fn
   );
+  StdThreadWorker(
+    WorkerIDType const& in_worker_id_, WorkerCountType const& in_num_workers,
+    WorkerFinishedFnType finished_fn, WorkStealingQueuesType* in_queues
+  );
   StdThreadWorker(StdThreadWorker const&) = delete;
 
   void spawn();
@@ -82,7 +86,6 @@ struct StdThreadWorker {
   void serialize(Serializer& s) {
     s | should_terminate_
       | worker_id_
-      | work_queue_
       | thd_
       | finished_fn_;
   }
@@ -93,7 +96,8 @@ private:
 private:
   std::atomic<bool> should_terminate_ = {false};
   WorkerIDType worker_id_ = no_worker_id;
-  WorkUnitContainerType work_queue_;
+  std::unique_ptr<WorkStealingQueuesType> own_queues_ = nullptr;
+  WorkStealingQueuesType* queues_ = nullptr;
   ThreadPtrType thd_ = nullptr;
   WorkerFinishedFnType finished_fn_ = nullptr;
 };
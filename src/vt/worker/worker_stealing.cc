@@ -0,0 +1,251 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              worker_stealing.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+
+#if vt_check_enabled(stdthread) || vt_check_enabled(openmp)
+
+#include "vt/context/context.h"
+#include "vt/worker/worker_stealing.h"
+
+#include <chrono>
+
+namespace vt { namespace worker {
+
+WorkStealingQueues::WorkStealingQueues(WorkerCountType in_num_workers)
+  : num_workers_(in_num_workers)
+{
+  for (WorkerCountType i = 0; i < num_workers_; i++) {
+    state_.emplace_back(std::make_unique<WorkerState>());
+    // Seed each worker's victim selection differently (xorshift must be
+    // non-zero)
+    state_.back()->rng_state_ = 0x9E3779B97F4A7C15ull * (i + 1);
+  }
+}
+
+WorkStealingQueues::~WorkStealingQueues() {
+  // Free any work units that were never executed
+  for (auto&& state : state_) {
+    drainInbox(*state);
+    WorkUnitPtrType unit = nullptr;
+    while (state->deque_.popBottom(unit)) {
+      delete unit;
+    }
+  }
+}
+
+void WorkStealingQueues::push(WorkerIDType id, WorkUnitType const& work_unit) {
+  vtAssert(id >= 0 and id < num_workers_, "Worker ID must be valid");
+
+  auto& state = *state_[id];
+  auto item = new WorkItem(work_unit);
+
+  if (theContext()->getWorker() == id) {
+    state.deque_.pushBottom(item);
+  } else {
+    auto head = state.inbox_.load(std::memory_order_relaxed);
+    do {
+      item->next = head;
+    } while (
+      not state.inbox_.compare_exchange_weak(
+        head, item, std::memory_order_release, std::memory_order_relaxed
+      )
+    );
+  }
+
+  if (state.parked_.load(std::memory_order_acquire)) {
+    wakeup(id);
+  } else if (num_parked_.load(std::memory_order_acquire) > 0) {
+    // The target is busy; let an idle worker come and steal it
+    wakeupAnyParked(id);
+  }
+}
+
+bool WorkStealingQueues::drainInbox(WorkerState& state) {
+  auto head = state.inbox_.exchange(nullptr, std::memory_order_acquire);
+  if (head == nullptr) {
+    return false;
+  }
+
+  // The inbox is LIFO; reverse it so that units are pushed in arrival order
+  WorkItem* prev = nullptr;
+  while (head != nullptr) {
+    auto next = head->next;
+    head->next = prev;
+    prev = head;
+    head = next;
+  }
+
+  while (prev != nullptr) {
+    auto next = prev->next;
+    prev->next = nullptr;
+    state.deque_.pushBottom(prev);
+    prev = next;
+  }
+  return true;
+}
+
+WorkerIDType WorkStealingQueues::nextVictim(WorkerState& state) {
+  // xorshift64
+  auto x = state.rng_state_;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  state.rng_state_ = x;
+  return static_cast<WorkerIDType>(x % static_cast<uint64_t>(num_workers_));
+}
+
+bool WorkStealingQueues::trySteal(WorkerIDType id, WorkUnitPtrType& out) {
+  if (num_workers_ < 2) {
+    return false;
+  }
+
+  auto& state = *state_[id];
+  for (WorkerCountType i = 0; i < num_workers_; i++) {
+    auto const victim = nextVictim(state);
+    if (victim == id) {
+      continue;
+    }
+    if (state_[victim]->deque_.steal(out)) {
+      state.stolen_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool WorkStealingQueues::runOne(WorkerIDType id) {
+  auto& state = *state_[id];
+  WorkUnitPtrType unit = nullptr;
+
+  bool found = state.deque_.popBottom(unit);
+  if (not found and drainInbox(state)) {
+    found = state.deque_.popBottom(unit);
+  }
+  if (not found) {
+    found = trySteal(id, unit);
+  }
+
+  if (not found) {
+    state.failed_rounds_++;
+    return false;
+  }
+
+  state.failed_rounds_ = 0;
+
+  unit->unit();
+  delete unit;
+
+  state.executed_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void WorkStealingQueues::park(
+  WorkerIDType id, std::atomic<bool> const& terminate
+) {
+  auto& state = *state_[id];
+
+  // Keep spinning/stealing for a while before going to sleep
+  if (state.failed_rounds_ < steal_rounds_before_park) {
+    return;
+  }
+
+  state.idle_.fetch_add(1, std::memory_order_relaxed);
+
+  std::unique_lock<std::mutex> lock(state.park_mutex_);
+  state.parked_.store(true, std::memory_order_release);
+  num_parked_.fetch_add(1, std::memory_order_acq_rel);
+
+  // Work may be pushed to another worker's deque just before this worker is
+  // marked as parked; the timeout bounds the window of such a missed wakeup
+  state.park_cv_.wait_for(
+    lock, std::chrono::microseconds(park_timeout_us), [&]{
+      return
+        state.wake_ or
+        terminate.load(std::memory_order_acquire) or
+        state.inbox_.load(std::memory_order_acquire) != nullptr;
+    }
+  );
+
+  state.wake_ = false;
+  num_parked_.fetch_sub(1, std::memory_order_acq_rel);
+  state.parked_.store(false, std::memory_order_release);
+  state.failed_rounds_ = 0;
+}
+
+void WorkStealingQueues::wakeup(WorkerIDType id) {
+  auto& state = *state_[id];
+  {
+    std::lock_guard<std::mutex> lock(state.park_mutex_);
+    state.wake_ = true;
+  }
+  state.park_cv_.notify_one();
+}
+
+void WorkStealingQueues::wakeupAnyParked(WorkerIDType skip) {
+  for (WorkerCountType i = 0; i < num_workers_; i++) {
+    if (i != skip and state_[i]->parked_.load(std::memory_order_acquire)) {
+      wakeup(i);
+      return;
+    }
+  }
+}
+
+WorkStealingQueues::CountType
+WorkStealingQueues::getExecuted(WorkerIDType id) const {
+  return state_[id]->executed_.load(std::memory_order_relaxed);
+}
+
+WorkStealingQueues::CountType
+WorkStealingQueues::getStolen(WorkerIDType id) const {
+  return state_[id]->stolen_.load(std::memory_order_relaxed);
+}
+
+WorkStealingQueues::CountType
+WorkStealingQueues::getIdle(WorkerIDType id) const {
+  return state_[id]->idle_.load(std::memory_order_relaxed);
+}
+
+}} /* end namespace vt::worker */
+
+#endif /*vt_check_enabled(stdthread) || vt_check_enabled(openmp)*/
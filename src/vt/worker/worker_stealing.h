@@ -0,0 +1,202 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              worker_stealing.h
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_WORKER_WORKER_STEALING_H
+#define INCLUDED_VT_WORKER_WORKER_STEALING_H
+
+#include "vt/config.h"
+
+#if vt_check_enabled(stdthread) || vt_check_enabled(openmp)
+
+#include "vt/worker/worker_common.h"
+#include "vt/worker/worker_types.h"
+#include "vt/utils/container/work_stealing_deque.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vt { namespace worker {
+
+/**
+ * \struct WorkStealingQueues
+ *
+ * \brief Per-worker Chase-Lev deques shared by a worker group, with randomized
+ * stealing between workers and parking of idle workers.
+ *
+ * Work enqueued by the owning worker goes directly to the bottom of its deque.
+ * Work enqueued from any other thread (e.g., the comm thread) is pushed onto a
+ * lock-free inbox that the owner drains into its deque. An idle worker tries
+ * to steal from randomly selected victims before parking; it is woken up when
+ * new work is enqueued.
+ */
+struct WorkStealingQueues {
+  struct WorkItem;
+  using WorkUnitPtrType = WorkItem*;
+  using DequeType = util::container::WorkStealingDeque<WorkUnitPtrType>;
+  using CountType = uint64_t;
+
+  /// Number of failed rounds of stealing before a worker parks
+  static constexpr int const steal_rounds_before_park = 64;
+
+  /// Upper bound on how long a parked worker sleeps before re-checking
+  static constexpr int const park_timeout_us = 500;
+
+  explicit WorkStealingQueues(WorkerCountType in_num_workers);
+  WorkStealingQueues(WorkStealingQueues const&) = delete;
+
+  ~WorkStealingQueues();
+
+  /**
+   * \brief Enqueue a work unit for a worker; may be called from any thread
+   *
+   * \param[in] id the target worker
+   * \param[in] work_unit the work unit
+   */
+  void push(WorkerIDType id, WorkUnitType const& work_unit);
+
+  /**
+   * \brief Find and run a single work unit from the worker's own deque, its
+   * inbox or another worker's deque; called only by the owning worker
+   *
+   * \param[in] id the worker
+   *
+   * \return whether a work unit was run
+   */
+  bool runOne(WorkerIDType id);
+
+  /**
+   * \brief Park the worker until it is woken up or the park timeout expires
+   *
+   * \param[in] id the worker
+   * \param[in] terminate flag to check for termination while parking
+   */
+  void park(WorkerIDType id, std::atomic<bool> const& terminate);
+
+  /**
+   * \brief Wake up a worker if it is parked
+   *
+   * \param[in] id the worker
+   */
+  void wakeup(WorkerIDType id);
+
+  /**
+   * \brief Number of work units executed by a worker
+   *
+   * \param[in] id the worker
+   *
+   * \return the count
+   */
+  CountType getExecuted(WorkerIDType id) const;
+
+  /**
+   * \brief Number of work units a worker stole from other workers
+   *
+   * \param[in] id the worker
+   *
+   * \return the count
+   */
+  CountType getStolen(WorkerIDType id) const;
+
+  /**
+   * \brief Number of times a worker went idle and parked
+   *
+   * \param[in] id the worker
+   *
+   * \return the count
+   */
+  CountType getIdle(WorkerIDType id) const;
+
+  /**
+   * \brief Get the number of workers
+   *
+   * \return the number of workers
+   */
+  WorkerCountType getNumWorkers() const { return num_workers_; }
+
+  /**
+   * \internal \brief A queued work unit. \c next links it into a worker's
+   * lock-free multi-producer inbox, so a push from another thread costs a
+   * single allocation; the owner takes the whole inbox at once so there is no
+   * ABA problem on pop
+   */
+  struct WorkItem {
+    explicit WorkItem(WorkUnitType const& in_unit) : unit(in_unit) { }
+
+    WorkUnitType unit;
+    WorkItem* next = nullptr;
+  };
+
+private:
+  struct alignas(64) WorkerState {
+    DequeType deque_;
+    std::atomic<WorkItem*> inbox_ = {nullptr};
+    std::atomic<bool> parked_ = {false};
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+    bool wake_ = false;
+    uint64_t rng_state_ = 0;
+    int failed_rounds_ = 0;
+    std::atomic<CountType> executed_ = {0};
+    std::atomic<CountType> stolen_ = {0};
+    std::atomic<CountType> idle_ = {0};
+  };
+
+  bool drainInbox(WorkerState& state);
+  bool trySteal(WorkerIDType id, WorkUnitPtrType& out);
+  void wakeupAnyParked(WorkerIDType skip);
+  WorkerIDType nextVictim(WorkerState& state);
+
+private:
+  WorkerCountType num_workers_ = 0;
+  std::vector<std::unique_ptr<WorkerState>> state_;
+  std::atomic<WorkerCountType> num_parked_ = {0};
+};
+
+}} /* end namespace vt::worker */
+
+#endif /*vt_check_enabled(stdthread) || vt_check_enabled(openmp)*/
+
+#endif /*INCLUDED_VT_WORKER_WORKER_STEALING_H*/
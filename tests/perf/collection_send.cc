@@ -0,0 +1,138 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              collection_send.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/vrt/collection/manager.h>
+
+#include <fmt/core.h>
+
+#include <vector>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int32_t const num_elms_per_node = 64;
+static constexpr int const num_sends_per_elm = 20;
+
+struct MyTest : PerfTestHarness { };
+
+struct SendCol;
+
+struct RecvMsg : CollectionMessage<SendCol> { };
+
+struct MigrateMsg : CollectionMessage<SendCol> {
+  MigrateMsg() = default;
+  explicit MigrateMsg(NodeType in_dest) : dest_(in_dest) { }
+  NodeType dest_ = uninitialized_destination;
+};
+
+struct SendCol : Collection<SendCol, Index1D> {
+  void recv(RecvMsg*) { num_recv_++; }
+  void migrateTo(MigrateMsg* msg) { this->migrate(msg->dest_); }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<SendCol, Index1D>::serialize(s);
+    s | num_recv_;
+  }
+
+  int num_recv_ = 0;
+};
+
+using ProxyType = CollectionProxy<SendCol, Index1D>;
+
+/**
+ * \brief Time \c num_sends_per_elm sends to every index in \c idxs
+ */
+static void timeSends(
+  MyTest* test, std::string const& name, ProxyType proxy,
+  std::vector<Index1D> const& idxs
+) {
+  test->StartTimer(name);
+  runInEpochCollective([&]{
+    for (int i = 0; i < num_sends_per_elm; i++) {
+      for (auto&& idx : idxs) {
+        proxy[idx].send<RecvMsg, &SendCol::recv>();
+      }
+    }
+  });
+  test->StopTimer(name, idxs.size() * num_sends_per_elm);
+}
+
+VT_PERF_TEST(MyTest, test_collection_send) {
+  auto const next_node = (my_node_ + 1) % num_nodes_;
+  auto const range = Index1D(num_nodes_ * num_elms_per_node);
+  auto proxy = makeCollection<SendCol>()
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  std::vector<Index1D> local, remote;
+  for (int32_t i = 0; i < range.x(); i++) {
+    auto const home = theCollection()->getMappedNode<SendCol>(proxy, i);
+    if (home == my_node_) {
+      local.emplace_back(i);
+    } else if (home == next_node) {
+      remote.emplace_back(i);
+    }
+  }
+
+  timeSends(this, "send_local", proxy, local);
+  timeSends(this, "send_remote", proxy, remote);
+
+  // Move every element one node over, then send to the elements that used to
+  // be local: messages now go through the home node or a location cache entry
+  runInEpochCollective([&]{
+    if (next_node != my_node_) {
+      for (auto&& idx : local) {
+        proxy[idx].send<MigrateMsg, &SendCol::migrateTo>(next_node);
+      }
+    }
+  });
+  timeSends(this, "send_migrated", proxy, local);
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
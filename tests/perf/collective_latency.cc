@@ -0,0 +1,136 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            collective_latency.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/objgroup/manager.h>
+#include <vt/messaging/active.h>
+
+#include <fmt/core.h>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_bcasts = 200;
+static constexpr int const num_reduces = 200;
+static constexpr NodeType const root_node = 0;
+
+struct MyTest : PerfTestHarness { };
+
+struct BcastMsg : Message { };
+struct AckMsg : Message { };
+struct ReduceMsg : collective::ReduceTMsg<int> {
+  ReduceMsg() = default;
+  explicit ReduceMsg(int in_val) : collective::ReduceTMsg<int>(in_val) { }
+};
+
+struct ReduceDone {
+  void operator()(ReduceMsg*);
+};
+
+struct NodeObj {
+  void initialize() { proxy_ = theObjGroup()->getProxy<NodeObj>(this); }
+
+  void startBcast() {
+    acks_ = 0;
+    proxy_.broadcast<BcastMsg, &NodeObj::bcastHandler>();
+  }
+
+  // Each broadcast is acknowledged by every node; the root only starts the
+  // next one once the previous has reached everyone, so the time per
+  // broadcast is its full-tree latency
+  void bcastHandler(BcastMsg*) {
+    proxy_[root_node].send<AckMsg, &NodeObj::ackHandler>();
+  }
+
+  void ackHandler(AckMsg*) {
+    if (++acks_ == theContext()->getNumNodes()) {
+      if (++num_done_ < num_bcasts) {
+        startBcast();
+      }
+    }
+  }
+
+  objgroup::proxy::Proxy<NodeObj> proxy_ = {};
+  int acks_ = 0;
+  int num_done_ = 0;
+};
+
+static int num_reduce_done = 0;
+
+void ReduceDone::operator()(ReduceMsg*) {
+  num_reduce_done++;
+}
+
+VT_PERF_TEST(MyTest, test_collective_latency) {
+  auto grp_proxy = theObjGroup()->makeCollective<NodeObj>();
+  grp_proxy[my_node_]
+    .invoke<decltype(&NodeObj::initialize), &NodeObj::initialize>();
+
+  StartTimer("broadcast");
+  runInEpochCollective([this, grp_proxy]{
+    if (my_node_ == root_node) {
+      grp_proxy.get()->startBcast();
+    }
+  });
+  StopTimer("broadcast", num_bcasts);
+
+  num_reduce_done = 0;
+  StartTimer("reduce");
+  runInEpochCollective([grp_proxy]{
+    for (int i = 0; i < num_reduces; i++) {
+      auto msg = makeMessage<ReduceMsg>(1);
+      grp_proxy.reduce<collective::PlusOp<int>, ReduceDone>(msg);
+    }
+  });
+  StopTimer("reduce", num_reduces);
+
+  vtAssert(
+    my_node_ != root_node or num_reduce_done == num_reduces,
+    "Root must receive every reduction"
+  );
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
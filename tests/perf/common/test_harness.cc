@@ -49,6 +49,10 @@
 #include <vt/utils/memory/memory_usage.h>
 #include <vt/objgroup/manager.h>
 
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <fstream>
 
@@ -135,13 +139,16 @@ struct TestMsg : Message {
 
   TestMsg(
     PerfTestHarness::TestResults const& results,
-    PerfTestHarness::MemoryUsage const& memory, NodeType const from_node)
+    PerfTestHarness::MemoryUsage const& memory,
+    PerfTestHarness::OpCounts const& op_counts, NodeType const from_node)
     : results_(results),
       memory_load_(memory),
+      op_counts_(op_counts),
       from_node_(from_node) { }
 
   PerfTestHarness::TestResults results_ = {};
   PerfTestHarness::MemoryUsage memory_load_ = {};
+  PerfTestHarness::OpCounts op_counts_ = {};
   NodeType from_node_ = {};
 
   template <typename SerializerT>
@@ -149,6 +156,7 @@ struct TestMsg : Message {
     Message::serialize(s);
     s | results_;
     s | memory_load_;
+    s | op_counts_;
     s | from_node_;
   }
 };
@@ -159,18 +167,32 @@ struct TestNodeObj {
 
   void RecvTestResult(TestMsg* msg) {
     test_harness_->CopyTestData(
-      msg->results_, msg->memory_load_, msg->from_node_
+      msg->results_, msg->memory_load_, msg->op_counts_, msg->from_node_
     );
   }
 
   PerfTestHarness* test_harness_ = nullptr;
 };
 
-void OutputToFile(std::string const& name, std::string const& content) {
-  std::ofstream file(fmt::format("{}.csv", name));
+void OutputToFile(
+  std::string const& name, std::string const& content,
+  std::string const& ext = "csv"
+) {
+  std::ofstream file(fmt::format("{}.{}", name, ext));
   file << content;
 }
 
+/**
+ * \brief Nearest-rank percentile of an ascending sorted sample
+ */
+template <typename T>
+T Percentile(std::vector<T> const& sorted, double const pct) {
+  auto const n = sorted.size();
+  auto rank = static_cast<std::size_t>(std::ceil(pct / 100.0 * n));
+  rank = std::max<std::size_t>(rank, 1);
+  return sorted[std::min(rank, n) - 1];
+}
+
 /////////////////////////////////////////////////
 ///////////////   TEST HARNESS    ///////////////
 /////////////////////////////////////////////////
@@ -198,6 +220,8 @@ void PerfTestHarness::Initialize(int argc, char** argv) {
     std::string arg_s{arg};
     if (arg_s == "--vt_perf_gen_file") {
       gen_file_ = true;
+    } else if (arg_s == "--vt_perf_gen_json") {
+      gen_json_ = true;
     } else if (arg_s == "--vt_perf_verbose") {
       verbose_ = true;
     } else if (arg_s.substr(0, 18) == "--vt_perf_num_runs") {
@@ -323,13 +347,87 @@ void PerfTestHarness::DumpResults() {
       OutputToFile(fmt::format("{}_mem", name_), memory_file);
       OutputToFile(fmt::format("{}_time", name_), time_file_data);
     }
+
+    if (gen_json_) {
+      OutputToFile(name_, OutputJson(), "json");
+    }
+  }
+}
+
+std::string PerfTestHarness::OutputJson() const {
+  using json = nlohmann::json;
+
+  json timers = json::array();
+  for (auto const& test_run : combined_timings_) {
+    for (auto const& per_node_result : test_run.second) {
+      auto const node = per_node_result.first;
+      auto const& t = per_node_result.second;
+
+      json entry = {
+        {"name", test_run.first},
+        {"node", node},
+        {"unit", "ms"},
+        {"mean", t.mean_},
+        {"stdev", t.std_dev_},
+        {"min", t.min_},
+        {"max", t.max_},
+        {"median", t.median_},
+        {"p95", t.p95_}
+      };
+
+      auto node_ops = combined_op_counts_.find(node);
+      if (node_ops != combined_op_counts_.end()) {
+        auto ops = node_ops->second.find(test_run.first);
+        if (ops != node_ops->second.end() and ops->second > 0) {
+          auto const num_ops = static_cast<double>(ops->second);
+          entry["ops"] = ops->second;
+          entry["mean_per_op_us"] = t.mean_ * 1000.0 / num_ops;
+          entry["ops_per_sec"] =
+            t.mean_ > 0.0 ? num_ops / (t.mean_ / 1000.0) : 0.0;
+        }
+      }
+
+      timers.push_back(entry);
+    }
+  }
+
+  json memory = json::array();
+  for (auto const& per_node_mem : combined_mem_use_) {
+    std::size_t cur_min = std::numeric_limits<std::size_t>::max();
+    std::size_t cur_max = 0;
+    for (auto const& mem : per_node_mem.second) {
+      cur_min = std::min(mem.min_, cur_min);
+      cur_max = std::max(mem.max_, cur_max);
+    }
+    if (not per_node_mem.second.empty()) {
+      memory.push_back(
+        {{"node", per_node_mem.first}, {"min", cur_min}, {"max", cur_max}}
+      );
+    }
   }
+
+  json doc = {
+    {"test", name_},
+    {"num_nodes", num_nodes_},
+    {"num_runs", num_runs_},
+    {"timers", timers},
+    {"memory", memory}
+  };
+
+  return doc.dump(2);
 }
 
 void PerfTestHarness::AddResult(TestResult const& test_result) {
   timings_[current_run_].push_back(test_result);
 }
 
+void PerfTestHarness::AddResult(
+  TestResult const& test_result, std::size_t num_ops
+) {
+  AddResult(test_result);
+  op_counts_[test_result.first] = num_ops;
+}
+
 void PerfTestHarness::StartTimer(std::string const& name) {
   timers_[name].Start();
 }
@@ -338,6 +436,12 @@ void PerfTestHarness::StopTimer(std::string const& name) {
   AddResult({name, timers_[name].Stop()});
 }
 
+void PerfTestHarness::StopTimer(
+  std::string const& name, std::size_t num_ops
+) {
+  AddResult({name, timers_[name].Stop()}, num_ops);
+}
+
 void PerfTestHarness::SyncResults() {
   auto proxy = theObjGroup()->makeCollective<TestNodeObj>(this);
 
@@ -348,18 +452,21 @@ void PerfTestHarness::SyncResults() {
 
     if (my_node_ != root_node) {
       proxy[root_node].send<TestMsg, &TestNodeObj::RecvTestResult>(
-        timings_, memory_use_, my_node_);
+        timings_, memory_use_, op_counts_, my_node_);
     } else {
       // Copy the root node's data to combined structures
-      CopyTestData(timings_, memory_use_, my_node_);
+      CopyTestData(timings_, memory_use_, op_counts_, my_node_);
     }
   });
 }
 
 void PerfTestHarness::CopyTestData(
   PerfTestHarness::TestResults const& source_time,
-  PerfTestHarness::MemoryUsage const& source_memory, NodeType const node
+  PerfTestHarness::MemoryUsage const& source_memory,
+  PerfTestHarness::OpCounts const& op_counts, NodeType const node
 ) {
+  combined_op_counts_[node] = op_counts;
+
   auto time_use =
     ProcessInput<PerfTestHarness::TestResult, PerfTestHarness::FinalTestResult>(
       source_time,
@@ -388,6 +495,18 @@ void PerfTestHarness::CopyTestData(
         }
       });
 
+  // Order statistics need every run's sample for a given timer
+  for (std::size_t j = 0; j < time_use.size(); ++j) {
+    std::vector<TimeType> samples;
+    samples.reserve(source_time.size());
+    for (auto const& per_run_result : source_time) {
+      samples.push_back(per_run_result[j].second);
+    }
+    std::sort(samples.begin(), samples.end());
+    time_use[j].second.median_ = Percentile(samples, 50.0);
+    time_use[j].second.p95_ = Percentile(samples, 95.0);
+  }
+
   for (auto const& test_result : time_use) {
     auto const& test_name = test_result.first;
     auto const time = test_result.second;
@@ -62,6 +62,8 @@ struct TestResultHolder {
   T std_dev_ = {};
   T min_ = std::numeric_limits<T>::max();
   T max_ = {};
+  T median_ = {};
+  T p95_ = {};
 };
 
 struct PerfTestHarness {
@@ -72,6 +74,8 @@ struct PerfTestHarness {
   using PerNodeResults =
     std::unordered_map<NodeType, TestResultHolder<TimeType>>;
   using CombinedResults = std::vector<std::pair<TestName, PerNodeResults>>;
+  using OpCounts = std::unordered_map<TestName, std::size_t>;
+  using CombinedOpCounts = std::unordered_map<NodeType, OpCounts>;
 
   // Memory use at the end of test iteration (i.e. phase)
   using MemoryUsage = std::vector<std::vector<std::size_t>>;
@@ -87,6 +91,7 @@ struct PerfTestHarness {
    * \brief Initialize internal variables and parse args
    * Perf specific args:
    * --vt_perf_gen_file - generate .CSV files with test results
+   * --vt_perf_gen_json - generate a .json file with statistical summaries
    * --vt_perf_verbose  - output per iteration times/memory use
    * --vt_perf_num_runs - set how many times the tests should run
    *                      (e.g. --vt_perf_num_run=100)
@@ -116,6 +121,14 @@ struct PerfTestHarness {
    */
   void DumpResults();
 
+  /**
+   * \brief Write the statistical summary of every timer on every node to
+   * {name_}.json, so that runs can be compared by scripts/compare_perf.py
+   *
+   * \return the JSON document
+   */
+  std::string OutputJson() const;
+
   /**
    * \brief Add a single test result (name-time pair)
    *
@@ -123,6 +136,14 @@ struct PerfTestHarness {
    */
   void AddResult(TestResult const& test_result);
 
+  /**
+   * \brief Add a single test result that timed \c num_ops operations
+   *
+   * \param[in] test_result name-time pair of test result
+   * \param[in] num_ops number of operations timed
+   */
+  void AddResult(TestResult const& test_result, std::size_t num_ops);
+
   /**
    * \brief Add and start a timer with name \c name
    *
@@ -138,6 +159,15 @@ struct PerfTestHarness {
    */
   void StopTimer(std::string const& name);
 
+  /**
+   * \brief Stop the timer \c name, add test result and record that it timed
+   * \c num_ops operations so per-operation cost and rates can be reported
+   *
+   * \param[in] name name of the timer
+   * \param[in] num_ops number of operations timed
+   */
+  void StopTimer(std::string const& name, std::size_t num_ops);
+
   /**
    * \brief Send the tests' results to root node.
    * This is called after each test run.
@@ -150,11 +180,13 @@ struct PerfTestHarness {
    *
    * \param[in] timers time results from all test runs
    * \param[in] memory_usage memory usage from all test runs
+   * \param[in] op_counts operations timed by each timer
    * \param[in] from_node which node sent these results
    */
   void CopyTestData(
     PerfTestHarness::TestResults const& timers,
-    PerfTestHarness::MemoryUsage const& memory_usage, NodeType const from_node
+    PerfTestHarness::MemoryUsage const& memory_usage,
+    PerfTestHarness::OpCounts const& op_counts, NodeType const from_node
   );
 
   /**
@@ -174,6 +206,7 @@ private:
 
 protected:
   bool gen_file_ = false;
+  bool gen_json_ = false;
   bool verbose_ = false;
   uint32_t num_runs_ = 50;
   uint32_t current_run_ = 0;
@@ -190,10 +223,12 @@ protected:
   // Local (per node) timings.
   TestResults timings_ = {};
   std::unordered_map<std::string, StopWatch> timers_ = {};
+  OpCounts op_counts_ = {};
 
   // Combined timings from all nodes, that are stored on the root node
   CombinedResults combined_timings_;
   CombinedMemoryUse combined_mem_use_;
+  CombinedOpCounts combined_op_counts_;
 };
 
 }}}} // namespace vt::tests::perf::common
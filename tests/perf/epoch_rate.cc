@@ -0,0 +1,91 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                epoch_rate.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/termination/termination.h>
+#include <vt/scheduler/scheduler.h>
+
+#include <fmt/core.h>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_epochs = 1000;
+
+struct MyTest : PerfTestHarness { };
+
+/**
+ * \brief Create \c num_epochs epochs with \c make, finish them all, and run
+ * the scheduler until every one has terminated
+ */
+template <typename MakeEpochT>
+static void createAndTerminate(MakeEpochT&& make) {
+  int num_terminated = 0;
+  for (int i = 0; i < num_epochs; i++) {
+    auto const ep = make();
+    theTerm()->addAction(ep, [&num_terminated]{ num_terminated++; });
+    theTerm()->finishedEpoch(ep);
+  }
+  theSched()->runSchedulerWhile([&]{ return num_terminated < num_epochs; });
+}
+
+VT_PERF_TEST(MyTest, test_epoch_rate) {
+  StartTimer("epoch_rooted");
+  createAndTerminate([]{ return theTerm()->makeEpochRooted(); });
+  StopTimer("epoch_rooted", num_epochs);
+
+  StartTimer("epoch_rooted_wave");
+  createAndTerminate([]{
+    return theTerm()->makeEpochRooted(term::UseDS{false});
+  });
+  StopTimer("epoch_rooted_wave", num_epochs);
+
+  StartTimer("epoch_collective");
+  createAndTerminate([]{ return theTerm()->makeEpochCollective(); });
+  StopTimer("epoch_collective", num_epochs);
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
@@ -0,0 +1,105 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                fan_in_out.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/messaging/active.h>
+
+#include <fmt/core.h>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_msgs_per_node = 1000;
+static constexpr NodeType const root_node = 0;
+
+struct MyTest : PerfTestHarness { };
+
+struct FanMsg : Message {
+  int64_t value_ = 0;
+};
+
+static int64_t num_recv = 0;
+
+static void fanHandler(FanMsg*) {
+  num_recv++;
+}
+
+VT_PERF_TEST(MyTest, test_fan_in_out) {
+  auto const total = static_cast<std::size_t>(num_msgs_per_node) * num_nodes_;
+
+  // Every node sends to the root
+  num_recv = 0;
+  StartTimer("fan_in");
+  runInEpochCollective([]{
+    for (int i = 0; i < num_msgs_per_node; i++) {
+      auto msg = makeMessage<FanMsg>();
+      theMsg()->sendMsg<FanMsg, fanHandler>(root_node, msg);
+    }
+  });
+  StopTimer("fan_in", total);
+  vtAssert(
+    my_node_ != root_node or num_recv == static_cast<int64_t>(total),
+    "Must receive all"
+  );
+
+  // The root sends to every node
+  num_recv = 0;
+  StartTimer("fan_out");
+  runInEpochCollective([this]{
+    if (my_node_ == root_node) {
+      for (NodeType node = 0; node < num_nodes_; node++) {
+        for (int i = 0; i < num_msgs_per_node; i++) {
+          auto msg = makeMessage<FanMsg>();
+          theMsg()->sendMsg<FanMsg, fanHandler>(node, msg);
+        }
+      }
+    }
+  });
+  StopTimer("fan_out", total);
+  vtAssert(num_recv == num_msgs_per_node, "Must receive all");
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
@@ -0,0 +1,83 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              group_construct.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/group/group_manager.h>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_groups = 50;
+
+struct MyTest : PerfTestHarness { };
+
+/*
+ * Measures collective group creation latency with the default multi-round
+ * construction and with --vt_group_scan_construct. Run oversubscribed to
+ * emulate large rank counts, e.g. `mpirun --oversubscribe -n 4096`.
+ */
+static void constructGroups() {
+  auto const this_node = theContext()->getNode();
+  for (int i = 0; i < num_groups; i++) {
+    auto const stride = 2 + i;
+    runInEpochCollective([=]{
+      theGroup()->newGroupCollective(this_node % stride == 0, [](GroupType){});
+    });
+  }
+}
+
+VT_PERF_TEST(MyTest, test_group_construct) {
+  theConfig()->vt_group_scan_construct = false;
+  StartTimer("tree rounds");
+  constructGroups();
+  StopTimer("tree rounds", num_groups);
+
+  theConfig()->vt_group_scan_construct = true;
+  StartTimer("scan");
+  constructGroups();
+  StopTimer("scan", num_groups);
+  theConfig()->vt_group_scan_construct = false;
+}
+
+VT_PERF_TEST_MAIN()
@@ -0,0 +1,124 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                lb_migrate.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/vrt/collection/manager.h>
+#include <vt/phase/phase_manager.h>
+
+#include <fmt/core.h>
+
+#include <vector>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int32_t const num_elms_per_node = 128;
+static constexpr int32_t const elm_payload_size = 1024;
+static constexpr int const num_lb_phases = 5;
+
+struct MyTest : PerfTestHarness { };
+
+struct LBCol;
+
+struct MigrateMsg : CollectionMessage<LBCol> {
+  MigrateMsg() = default;
+  explicit MigrateMsg(NodeType in_dest) : dest_(in_dest) { }
+  NodeType dest_ = uninitialized_destination;
+};
+
+struct LBCol : Collection<LBCol, Index1D> {
+  LBCol() : data_(elm_payload_size, 1.0) { }
+
+  void migrateTo(MigrateMsg* msg) { this->migrate(msg->dest_); }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<LBCol, Index1D>::serialize(s);
+    s | data_;
+  }
+
+  std::vector<double> data_;
+};
+
+VT_PERF_TEST(MyTest, test_lb_migrate) {
+  auto const next_node = (my_node_ + 1) % num_nodes_;
+  auto const range = Index1D(num_nodes_ * num_elms_per_node);
+  auto proxy = makeCollection<LBCol>()
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  auto const local = theCollection()->getLocalIndices(proxy);
+
+  // Explicit migration of every local element one node over
+  StartTimer("migrate");
+  runInEpochCollective([&]{
+    if (next_node != my_node_) {
+      for (auto&& idx : local) {
+        proxy[idx].send<MigrateMsg, &LBCol::migrateTo>(next_node);
+      }
+    }
+  });
+  StopTimer("migrate", local.size());
+
+  // A full LB invocation (statistics, strategy, and migrations) per phase;
+  // RotateLB moves every element so the migration cost is always included
+  theConfig()->vt_lb = true;
+  theConfig()->vt_lb_name = "RotateLB";
+  theConfig()->vt_lb_interval = 1;
+
+  StartTimer("lb_rotate");
+  for (int i = 0; i < num_lb_phases; i++) {
+    runInEpochCollective([]{
+      thePhase()->nextPhaseCollective();
+    });
+  }
+  StopTimer("lb_rotate", local.size() * num_lb_phases);
+
+  theConfig()->vt_lb = false;
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              location_cache.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/vrt/collection/manager.h>
+#include <vt/topos/location/manager.h>
+
+#include <fmt/core.h>
+
+#include <vector>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int32_t const num_elms_per_node = 256;
+static constexpr int const num_passes = 10;
+
+struct MyTest : PerfTestHarness { };
+
+struct LocCol;
+
+struct RecvMsg : CollectionMessage<LocCol> { };
+
+struct MigrateMsg : CollectionMessage<LocCol> {
+  MigrateMsg() = default;
+  explicit MigrateMsg(NodeType in_dest) : dest_(in_dest) { }
+  NodeType dest_ = uninitialized_destination;
+};
+
+struct LocCol : Collection<LocCol, Index1D> {
+  void recv(RecvMsg*) { }
+  void migrateTo(MigrateMsg* msg) { this->migrate(msg->dest_); }
+};
+
+VT_PERF_TEST(MyTest, test_location_cache) {
+  auto const next_node = (my_node_ + 1) % num_nodes_;
+  auto const range = Index1D(num_nodes_ * num_elms_per_node);
+  auto proxy = makeCollection<LocCol>()
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  std::vector<Index1D> local, targets;
+  for (int32_t i = 0; i < range.x(); i++) {
+    auto const home = theCollection()->getMappedNode<LocCol>(proxy, i);
+    if (home == my_node_) {
+      local.emplace_back(i);
+    } else if (home == next_node) {
+      targets.emplace_back(i);
+    }
+  }
+
+  // Move elements off their home node so resolving them from a third node
+  // needs the home to forward (or a cache entry to skip it)
+  runInEpochCollective([&]{
+    if (num_nodes_ > 1) {
+      auto const dest = (my_node_ + num_nodes_ - 1) % num_nodes_;
+      for (auto&& idx : local) {
+        proxy[idx].send<MigrateMsg, &LocCol::migrateTo>(dest);
+      }
+    }
+  });
+
+  auto lm = theLocMan()->getCollectionLM<Index1D>(proxy.getProxy());
+
+  // Each pass clears the cache, then sends twice: the first send to each
+  // element misses, the second hits the entry the eager update left behind
+  TimeType miss_time = 0, hit_time = 0;
+  StopWatch watch;
+  for (int pass = 0; pass < num_passes; pass++) {
+    lm->clearCache();
+    theCollective()->barrier();
+
+    watch.Start();
+    runInEpochCollective([&]{
+      for (auto&& idx : targets) {
+        proxy[idx].send<RecvMsg, &LocCol::recv>();
+      }
+    });
+    miss_time += watch.Stop();
+
+    runInEpochCollective([&]{
+      for (auto&& idx : targets) {
+        proxy[idx].send<RecvMsg, &LocCol::recv>();
+      }
+    });
+    hit_time += watch.Stop();
+  }
+
+  AddResult({"cache_miss", miss_time}, targets.size() * num_passes);
+  AddResult({"cache_hit", hit_time}, targets.size() * num_passes);
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
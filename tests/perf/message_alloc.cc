@@ -0,0 +1,120 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               message_alloc.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/messaging/active.h>
+
+#include <fmt/core.h>
+
+#include <array>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_cycles = 100000;
+
+struct MyTest : PerfTestHarness { };
+
+template <std::size_t num_bytes>
+struct AllocMsg : Message {
+  std::array<char, num_bytes> payload_;
+};
+
+static int num_recv = 0;
+
+template <std::size_t num_bytes>
+static void allocHandler(AllocMsg<num_bytes>*) {
+  num_recv++;
+}
+
+/**
+ * \brief Time \c num_cycles message creations immediately followed by frees
+ */
+template <std::size_t num_bytes>
+static void runMakeFree(MyTest* test) {
+  auto const name = fmt::format("make_free {} Bytes", num_bytes);
+
+  test->StartTimer(name);
+  for (int i = 0; i < num_cycles; i++) {
+    auto msg = makeMessage<AllocMsg<num_bytes>>();
+  }
+  test->StopTimer(name, num_cycles);
+}
+
+/**
+ * \brief Time \c num_cycles messages made, sent to this node, delivered and
+ * freed
+ */
+template <std::size_t num_bytes>
+static void runMakeSendFree(MyTest* test) {
+  auto const this_node = theContext()->getNode();
+  auto const name = fmt::format("make_send_free {} Bytes", num_bytes);
+
+  num_recv = 0;
+  test->StartTimer(name);
+  runInEpochCollective([=]{
+    for (int i = 0; i < num_cycles; i++) {
+      auto msg = makeMessage<AllocMsg<num_bytes>>();
+      theMsg()->sendMsg<AllocMsg<num_bytes>, allocHandler<num_bytes>>(
+        this_node, msg
+      );
+    }
+  });
+  test->StopTimer(name, num_cycles);
+
+  vtAssert(num_recv == num_cycles, "Must receive all");
+}
+
+VT_PERF_TEST(MyTest, test_message_alloc) {
+  // Sizes fall in the small and medium pool buckets and past them (malloc)
+  runMakeFree<32>(this);
+  runMakeFree<512>(this);
+  runMakeFree<4096>(this);
+
+  runMakeSendFree<32>(this);
+  runMakeSendFree<512>(this);
+  runMakeSendFree<4096>(this);
+}
+
+VT_PERF_TEST_MAIN()
@@ -0,0 +1,104 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               message_rate.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+#include <vt/messaging/active.h>
+
+#include <fmt/core.h>
+
+#include <array>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_small_msgs = 10000;
+static constexpr int const num_medium_msgs = 2000;
+static constexpr int const num_large_msgs = 100;
+
+struct MyTest : PerfTestHarness { };
+
+template <std::size_t num_bytes>
+struct RateMsg : Message {
+  std::array<char, num_bytes> payload_;
+};
+
+static int num_recv = 0;
+
+template <std::size_t num_bytes>
+static void rateHandler(RateMsg<num_bytes>*) {
+  num_recv++;
+}
+
+template <std::size_t num_bytes>
+static void runRate(MyTest* test, int num_msgs) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  NodeType const dest = num_nodes > 1 ? 1 : 0;
+  auto const name = fmt::format("msg_rate {} Bytes", num_bytes);
+
+  num_recv = 0;
+  test->StartTimer(name);
+  runInEpochCollective([=]{
+    if (this_node == 0) {
+      for (int i = 0; i < num_msgs; i++) {
+        auto msg = makeMessage<RateMsg<num_bytes>>();
+        theMsg()->sendMsg<RateMsg<num_bytes>, rateHandler<num_bytes>>(
+          dest, msg
+        );
+      }
+    }
+  });
+  test->StopTimer(name, num_msgs);
+
+  vtAssert(this_node != dest or num_recv == num_msgs, "Must receive all");
+}
+
+VT_PERF_TEST(MyTest, test_message_rate) {
+  runRate<64>(this, num_small_msgs);
+  runRate<8192>(this, num_medium_msgs);
+  runRate<262144>(this, num_large_msgs);
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
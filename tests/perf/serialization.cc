@@ -0,0 +1,113 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               serialization.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "common/test_harness.h"
+#include <vt/collective/collective_ops.h>
+
+#include <checkpoint/checkpoint.h>
+#include <fmt/core.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace vt;
+using namespace vt::tests::perf::common;
+
+static constexpr int const num_iters = 50;
+static constexpr std::size_t const vec_size = 1 << 20;
+static constexpr std::size_t const num_entries = 1 << 14;
+
+struct MyTest : PerfTestHarness { };
+
+/// A non-contiguous structure: the per-element cost dominates
+struct Nested {
+  std::map<int, std::string> names_;
+  std::vector<std::vector<int>> lists_;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | names_ | lists_;
+  }
+};
+
+/**
+ * \brief Time \c num_iters serialize/deserialize round trips of \c obj
+ */
+template <typename T>
+static void timeRoundTrip(MyTest* test, std::string const& label, T& obj) {
+  std::size_t bytes = 0;
+
+  test->StartTimer(fmt::format("{} serialize", label));
+  for (int i = 0; i < num_iters; i++) {
+    auto buf = checkpoint::serialize(obj);
+    bytes = buf->getSize();
+  }
+  test->StopTimer(fmt::format("{} serialize", label), num_iters);
+
+  auto buf = checkpoint::serialize(obj);
+  test->StartTimer(fmt::format("{} deserialize", label));
+  for (int i = 0; i < num_iters; i++) {
+    auto out = checkpoint::deserialize<T>(buf->getBuffer());
+    vtAssert(out != nullptr, "Must deserialize");
+  }
+  test->StopTimer(fmt::format("{} deserialize", label), num_iters);
+
+  vtAssert(bytes == buf->getSize(), "Sizes must be stable");
+}
+
+VT_PERF_TEST(MyTest, test_serialization) {
+  std::vector<double> contiguous(vec_size, 1.0);
+  timeRoundTrip(this, fmt::format("vector<double>[{}]", vec_size), contiguous);
+
+  Nested nested;
+  for (std::size_t i = 0; i < num_entries; i++) {
+    nested.names_[static_cast<int>(i)] = fmt::format("entry-{}", i);
+    nested.lists_.emplace_back(8, static_cast<int>(i));
+  }
+  timeRoundTrip(this, fmt::format("nested[{}]", num_entries), nested);
+
+  GetMemoryUsage();
+}
+
+VT_PERF_TEST_MAIN()
@@ -0,0 +1,243 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                         test_active_send_compact.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/messaging/active.h"
+#include "test_parallel_harness.h"
+#include "test_helpers.h"
+
+#include <string>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace compact {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+static constexpr int const num_msgs = 16;
+static constexpr TagType const test_tag = 29;
+
+struct CompactMsg : vt::Message {
+  CompactMsg() = default;
+  CompactMsg(NodeType in_from, int in_val)
+    : from_(in_from),
+      val_(in_val)
+  { }
+
+  NodeType from_ = uninitialized_destination;
+  int val_ = 0;
+};
+
+struct CompactSerialMsg : vt::Message {
+  using MessageParentType = vt::Message;
+  vt_msg_serialize_required();
+
+  CompactSerialMsg() = default;
+  explicit CompactSerialMsg(NodeType in_from)
+    : from_(in_from),
+      str_(fmt::format("from node {}", in_from))
+  {
+    for (int i = 0; i < 100; i++) {
+      data_.push_back(in_from * 1000 + i);
+    }
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | from_ | data_ | str_;
+  }
+
+  NodeType from_ = uninitialized_destination;
+  std::vector<int> data_;
+  std::string str_;
+};
+
+struct TestActiveSendCompact : TestParallelHarness {
+  static int handler_count;
+  static EpochType recv_epoch;
+
+  void addAdditionalArgs() override {
+    compact_arg = "--vt_compact_envelope";
+    addArgs(compact_arg);
+  }
+
+  virtual void SetUp() override {
+    TestParallelHarness::SetUp();
+
+    SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+    handler_count = 0;
+    recv_epoch = no_epoch;
+  }
+
+  static NodeType prevNode() {
+    auto const this_node = theContext()->getNode();
+    auto const num_nodes = theContext()->getNumNodes();
+    return (this_node + num_nodes - 1) % num_nodes;
+  }
+
+  static NodeType nextNode() {
+    auto const this_node = theContext()->getNode();
+    auto const num_nodes = theContext()->getNumNodes();
+    return (this_node + 1) % num_nodes;
+  }
+
+  static void sendHandler(CompactMsg* msg) {
+    EXPECT_TRUE(envelopeIsLocked(msg->env)) << "Should be locked on recv";
+    EXPECT_EQ(msg->from_, prevNode());
+    EXPECT_GE(msg->val_, 0);
+    EXPECT_LT(msg->val_, num_msgs);
+    EXPECT_EQ(envelopeGetEpoch(msg->env), theMsg()->getEpoch());
+    handler_count++;
+  }
+
+  static void bcastHandler(CompactMsg* msg) {
+    EXPECT_TRUE(envelopeIsBcast(msg->env));
+    EXPECT_EQ(msg->val_, msg->from_ * 10);
+    handler_count++;
+  }
+
+  static void serialHandler(CompactSerialMsg* msg) {
+    EXPECT_EQ(msg->from_, prevNode());
+    EXPECT_EQ(msg->str_, fmt::format("from node {}", prevNode()));
+    ASSERT_EQ(msg->data_.size(), 100u);
+    for (int i = 0; i < 100; i++) {
+      EXPECT_EQ(msg->data_[i], prevNode() * 1000 + i);
+    }
+    handler_count++;
+  }
+
+  static void epochTagHandler(CompactMsg* msg) {
+    EXPECT_EQ(envelopeGetTag(msg->env), test_tag + msg->val_);
+    recv_epoch = theMsg()->getEpoch();
+    handler_count++;
+  }
+
+  static void systemHandler(CompactMsg* msg) {
+    EXPECT_EQ(envelopeGetSchedQueue(msg->env), SchedQueue::System);
+    EXPECT_EQ(msg->from_, prevNode());
+    handler_count++;
+  }
+
+private:
+  std::string compact_arg;
+};
+
+/*static*/ int TestActiveSendCompact::handler_count = 0;
+/*static*/ EpochType TestActiveSendCompact::recv_epoch = no_epoch;
+
+TEST_F(TestActiveSendCompact, test_compact_send) {
+  EXPECT_TRUE(theConfig()->vt_compact_envelope);
+
+  auto const this_node = theContext()->getNode();
+
+  runInEpochCollective([&]{
+    for (int i = 0; i < num_msgs; i++) {
+      auto msg = makeMessage<CompactMsg>(this_node, i);
+      theMsg()->sendMsg<CompactMsg, sendHandler>(nextNode(), msg);
+    }
+  });
+
+  EXPECT_EQ(handler_count, num_msgs);
+}
+
+TEST_F(TestActiveSendCompact, test_compact_broadcast) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  runInEpochCollective([&]{
+    auto msg = makeMessage<CompactMsg>(this_node, this_node * 10);
+    theMsg()->broadcastMsg<CompactMsg, bcastHandler>(msg);
+  });
+
+  EXPECT_EQ(handler_count, num_nodes);
+}
+
+TEST_F(TestActiveSendCompact, test_compact_serialized) {
+  auto const this_node = theContext()->getNode();
+
+  runInEpochCollective([&]{
+    auto msg = makeMessage<CompactSerialMsg>(this_node);
+    theMsg()->sendMsg<CompactSerialMsg, serialHandler>(nextNode(), msg);
+  });
+
+  EXPECT_EQ(handler_count, 1);
+}
+
+TEST_F(TestActiveSendCompact, test_compact_epoch_tag) {
+  auto const this_node = theContext()->getNode();
+
+  auto const ep = theTerm()->makeEpochCollective("test_compact_epoch_tag");
+  theMsg()->pushEpoch(ep);
+  for (int i = 0; i < num_msgs; i++) {
+    auto msg = makeMessage<CompactMsg>(this_node, i);
+    theMsg()->sendMsg<CompactMsg, epochTagHandler>(
+      nextNode(), msg, test_tag + i
+    );
+  }
+  theMsg()->popEpoch(ep);
+  theTerm()->finishedEpoch(ep);
+  runSchedulerThrough(ep);
+
+  // Collective epochs have the same ID on every node
+  EXPECT_EQ(handler_count, num_msgs);
+  EXPECT_EQ(recv_epoch, ep);
+}
+
+TEST_F(TestActiveSendCompact, test_compact_system_queue) {
+  auto const this_node = theContext()->getNode();
+
+  runInEpochCollective([&]{
+    for (int i = 0; i < num_msgs; i++) {
+      auto msg = makeMessage<CompactMsg>(this_node, i);
+      theMsg()->markAsSystemMessage(msg);
+      theMsg()->sendMsg<CompactMsg, systemHandler>(nextNode(), msg);
+    }
+  });
+
+  EXPECT_EQ(handler_count, num_msgs);
+}
+
+}}}} // end namespace vt::tests::unit::compact
@@ -46,6 +46,7 @@
 
 #include <vt/runtime/mpi_access.h>
 #include <vt/messaging/async_op_mpi.h>
+#include <vt/scheduler/scheduler.h>
 #include <vt/objgroup/manager.h>
 
 #include <gtest/gtest.h>
@@ -118,4 +119,51 @@ TEST_F(TestAsyncOp, test_async_op_1) {
   p[this_node].get()->check();
 }
 
+struct NeverDoneOp : messaging::AsyncOp {
+  explicit NeverDoneOp(bool* in_timed_out) : timed_out_(in_timed_out) { }
+
+  bool poll() override { return false; }
+  void done() override { ADD_FAILURE() << "Op never completes"; }
+  void timedOut() override { *timed_out_ = true; }
+
+private:
+  bool* timed_out_ = nullptr;
+};
+
+struct DoneOp : messaging::AsyncOp {
+  explicit DoneOp(bool* in_done) : done_(in_done) { }
+
+  bool poll() override { return true; }
+  void done() override { *done_ = true; }
+  void timedOut() override { ADD_FAILURE() << "Op completed in time"; }
+
+private:
+  bool* done_ = nullptr;
+};
+
+TEST_F(TestAsyncOp, test_async_op_timeout_expires) {
+  bool timed_out = false;
+
+  // The op holds the epoch open until its timeout fires
+  runInEpochRooted([&]{
+    auto op = std::make_unique<NeverDoneOp>(&timed_out);
+    theMsg()->registerAsyncOp(std::move(op), 0.01);
+  });
+
+  EXPECT_TRUE(timed_out);
+  EXPECT_EQ(theSched()->numPendingTimers(), 0u);
+}
+
+TEST_F(TestAsyncOp, test_async_op_timeout_cancelled) {
+  bool done = false;
+
+  runInEpochRooted([&]{
+    theMsg()->registerAsyncOp(std::make_unique<DoneOp>(&done), 3600.);
+  });
+
+  // Completing in time cancels the timeout
+  EXPECT_TRUE(done);
+  EXPECT_EQ(theSched()->numPendingTimers(), 0u);
+}
+
 }}} // end namespace vt::tests::unit
@@ -0,0 +1,211 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_broadcast_region.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_collection_common.h"
+
+#include "vt/vrt/collection/manager.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace region_bcast {
+
+using vt::vrt::collection::Region;
+
+struct TestBroadcastRegion : TestParallelHarness { };
+
+struct WorkMsg;
+struct PayloadMsg;
+
+struct RegionTest : Collection<RegionTest,Index2D> {
+  void work(WorkMsg* msg);
+  void payload(PayloadMsg* msg);
+
+  int num_work_ = 0;
+  int payload_sum_ = 0;
+};
+
+struct WorkMsg : CollectionMessage<RegionTest> {};
+
+struct PayloadMsg : CollectionMessage<RegionTest> {
+  using MessageParentType = CollectionMessage<RegionTest>;
+  vt_msg_serialize_required(); // vals_
+
+  PayloadMsg() = default;
+  explicit PayloadMsg(std::vector<int> in_vals) : vals_(in_vals) { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    MessageParentType::serialize(s);
+    s | vals_;
+  }
+
+  std::vector<int> vals_;
+};
+
+void RegionTest::work(WorkMsg*) {
+  num_work_++;
+}
+
+void RegionTest::payload(PayloadMsg* msg) {
+  for (auto&& v : msg->vals_) {
+    payload_sum_ += v;
+  }
+}
+
+struct CheckMsg : CollectionMessage<RegionTest> {
+  CheckMsg(Index2D in_lo, Index2D in_hi, int in_expected)
+    : lo_(in_lo), hi_(in_hi), expected_(in_expected)
+  { }
+
+  Index2D lo_, hi_;
+  int expected_ = 0;
+};
+
+static void checkRange(CheckMsg* msg, RegionTest* col) {
+  auto idx = col->getIndex();
+  bool const in_range =
+    idx.x() >= msg->lo_.x() and idx.x() < msg->hi_.x() and
+    idx.y() >= msg->lo_.y() and idx.y() < msg->hi_.y();
+  EXPECT_EQ(col->num_work_, in_range ? msg->expected_ : 0);
+}
+
+static void checkDiagonal(CheckMsg* msg, RegionTest* col) {
+  auto idx = col->getIndex();
+  EXPECT_EQ(col->num_work_, idx.x() == idx.y() ? msg->expected_ : 0);
+}
+
+static void checkPayload(CheckMsg* msg, RegionTest* col) {
+  auto idx = col->getIndex();
+  bool const in_stencil = idx.y() == 0 and idx.x() <= 1;
+  EXPECT_EQ(col->payload_sum_, in_stencil ? msg->expected_ : 0);
+}
+
+static constexpr int32_t const num_elms_per_node = 8;
+
+TEST_F(TestBroadcastRegion, test_broadcast_region_range_1) {
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const this_node = theContext()->getNode();
+  auto const range = Index2D(num_nodes * num_elms_per_node, 4);
+  auto proxy = makeCollection<RegionTest>()
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  // Clamped to the bounds: x in [2, num_nodes * 4 + 2), y in [1, 4)
+  auto const lo = Index2D(2, 1);
+  auto const hi = Index2D(num_nodes * num_elms_per_node / 2 + 2, 10);
+  auto const clamped_hi = Index2D(hi.x(), 4);
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      using RegionType = Region<Index2D>;
+      for (int i = 0; i < 3; i++) {
+        proxy.broadcastRegion<WorkMsg,&RegionTest::work>(
+          RegionType::range(lo, hi)
+        );
+      }
+    }
+  });
+
+  runInEpochCollective([&]{
+    proxy.broadcastCollective<CheckMsg,checkRange>(lo, clamped_hi, 3);
+  });
+}
+
+TEST_F(TestBroadcastRegion, test_broadcast_region_predicate_1) {
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const n = num_nodes * num_elms_per_node;
+  auto proxy = makeCollection<RegionTest>()
+    .bounds(Index2D(n, n))
+    .bulkInsert()
+    .wait();
+
+  // Every node sends, so each diagonal element receives one per node
+  runInEpochCollective([&]{
+    proxy.broadcastRegion<WorkMsg,&RegionTest::work>(
+      Region<Index2D>::predicate([](Index2D const& idx) {
+        return idx.x() == idx.y();
+      })
+    );
+  });
+
+  runInEpochCollective([&]{
+    proxy.broadcastCollective<CheckMsg,checkDiagonal>(
+      Index2D(0, 0), Index2D(0, 0), num_nodes
+    );
+  });
+}
+
+TEST_F(TestBroadcastRegion, test_broadcast_region_stencil_serialized_1) {
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const this_node = theContext()->getNode();
+  auto proxy = makeCollection<RegionTest>()
+    .bounds(Index2D(num_nodes * num_elms_per_node, 2))
+    .bulkInsert()
+    .wait();
+
+  // Offsets falling outside the bounds are dropped: only (0,0) and (1,0) hit
+  std::vector<Index2D> offsets = {
+    Index2D(0, 0), Index2D(1, 0), Index2D(-1, 0), Index2D(0, -1)
+  };
+
+  runInEpochCollective([&]{
+    if (this_node == 0) {
+      proxy.broadcastRegion<PayloadMsg,&RegionTest::payload>(
+        Region<Index2D>::stencil(Index2D(0, 0), offsets),
+        std::vector<int>{1, 2, 3}
+      );
+    }
+  });
+
+  runInEpochCollective([&]{
+    proxy.broadcastCollective<CheckMsg,checkPayload>(
+      Index2D(0, 0), Index2D(0, 0), 6
+    );
+  });
+}
+
+}}}} // end namespace vt::tests::unit::region_bcast
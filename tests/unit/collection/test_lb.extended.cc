@@ -49,6 +49,9 @@
 
 #include "vt/vrt/collection/manager.h"
 #include "vt/vrt/collection/balance/stats_data.h"
+#include "vt/vrt/collection/balance/lb_invoke/lb_manager.h"
+#include "vt/vrt/collection/balance/model/raw_data.h"
+#include "vt/vrt/collection/balance/model/naive_persistence.h"
 #include "vt/utils/json/json_reader.h"
 #include "vt/utils/json/json_appender.h"
 
@@ -100,6 +103,14 @@ void runTest(std::string lb_name) {
       fmt::print("Using lb_args {}\n", lb_args);
     }
   }
+  if (lb_name.compare("TwoLevelLB") == 0) {
+    // Emulate two ranks per host so the inter-host level is exercised
+    std::string lb_args("ranks_per_host=2 inter_threshold=0.0");
+    vt::theConfig()->vt_lb_args = lb_args;
+    if (vt::theContext()->getNode() == 0) {
+      fmt::print("Using lb_args {}\n", lb_args);
+    }
+  }
   if (lb_name.substr(0, 8).compare("GreedyLB") == 0) {
     vt::theConfig()->vt_lb_name = "GreedyLB";
     auto strat_arg = lb_name.substr(9, lb_name.size() - 9);
@@ -148,6 +159,11 @@ TEST_P(TestLoadBalancerGreedy, test_load_balancer_greedy_keep_last_elm) {
   runTest(GetParam());
 }
 
+TEST_P(TestLoadBalancerOther, test_load_balancer_other_adaptive) {
+  vt::theConfig()->vt_lb_adaptive = true;
+  runTest(GetParam());
+}
+
 struct MyCol2 : vt::Collection<MyCol2,vt::Index1D> {};
 
 using TestLoadBalancerNoWork = TestParallelHarness;
@@ -172,11 +188,91 @@ TEST_F(TestLoadBalancerNoWork, test_load_balancer_no_work) {
   }
 }
 
+using TestLoadBalancerAdaptive = TestParallelHarness;
+
+TEST_F(TestLoadBalancerAdaptive, test_adaptive_skips_without_gain) {
+  using vt::vrt::collection::balance::LBType;
+
+  vt::theConfig()->vt_lb = true;
+  vt::theConfig()->vt_lb_name = "RotateLB";
+  vt::theConfig()->vt_lb_interval = 1;
+
+  // No load has been recorded, so balancing cannot gain anything
+  vt::theConfig()->vt_lb_adaptive = true;
+  EXPECT_EQ(vt::theLBManager()->decideLBToRun(1, false), LBType::NoLB);
+
+  vt::theConfig()->vt_lb_adaptive = false;
+  EXPECT_EQ(vt::theLBManager()->decideLBToRun(2, false), LBType::RotateLB);
+}
+
+using TestLoadBalancerDiffusion = TestParallelHarness;
+
+TEST_F(TestLoadBalancerDiffusion, test_diffusion_reduces_imbalance) {
+  using vt::vrt::collection::balance::LBType;
+  using vt::vrt::collection::balance::LoadMapType;
+  using vt::vrt::collection::balance::NaivePersistence;
+  using vt::vrt::collection::balance::RawData;
+  using vt::vrt::collection::lb::Statistic;
+  using vt::vrt::collection::lb::StatisticQuantity;
+
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const next_node = (this_node + 1) % num_nodes;
+  std::size_t const num_objs = 8;
+
+  auto make_id = [](std::size_t i, NodeType node) {
+    return elm::ElmIDBits::createCollectionImpl(true, i + 1, node, node);
+  };
+
+  // Even nodes carry twice the load of odd nodes. Every object exchanges
+  // heavy traffic with its peer on the next node and light traffic with the
+  // next object on its own node, so the strategy has a real graph to work on.
+  std::unordered_map<PhaseType, LoadMapType> loads;
+  std::unordered_map<PhaseType, elm::CommMapType> comm;
+  for (std::size_t i = 0; i < num_objs; i++) {
+    auto const id = make_id(i, this_node);
+    loads[0][id].whole_phase_load = this_node % 2 == 0 ? 2.0 : 1.0;
+
+    elm::CommKey remote{
+      elm::CommKey::SendRecvTag{}, id, make_id(i, next_node), false
+    };
+    comm[0][remote] = elm::CommVolume{1000.0, 10};
+
+    elm::CommKey local{
+      elm::CommKey::SendRecvTag{}, id, make_id((i + 1) % num_objs, this_node),
+      false
+    };
+    comm[0][local] = elm::CommVolume{100.0, 1};
+  }
+
+  auto raw = std::make_shared<RawData>();
+  raw->setLoads(&loads, &comm);
+  auto model = std::make_shared<NaivePersistence>(raw);
+
+  auto proposal = theLBManager()->proposeLB(
+    0, LBType::DiffusionLB, model, comm[0]
+  );
+
+  ASSERT_NE(proposal.reassignment_, nullptr);
+  EXPECT_GT(proposal.reassignment_->global_migration_count, 0);
+
+  auto& before = proposal.before_[Statistic::P_l];
+  auto& after = proposal.after_[Statistic::P_l];
+  EXPECT_DOUBLE_EQ(after[StatisticQuantity::sum], before[StatisticQuantity::sum]);
+  EXPECT_GT(before[StatisticQuantity::imb], 0.);
+  EXPECT_LT(after[StatisticQuantity::imb], before[StatisticQuantity::imb]);
+  EXPECT_LT(after[StatisticQuantity::max], before[StatisticQuantity::max]);
+}
+
 auto balancers_other = ::testing::Values(
     "RandomLB",
     "RotateLB",
     "HierarchicalLB",
-    "TemperedLB"
+    "TemperedLB",
+    "DiffusionLB",
+    "TwoLevelLB"
 #   if vt_check_enabled(zoltan)
     , "ZoltanLB"
 #   endif
@@ -49,6 +49,7 @@
 
 #include "vt/vrt/collection/manager.h"
 
+#include <atomic>
 #include <cstdint>
 
 namespace vt { namespace tests { namespace unit { namespace query {
@@ -59,6 +60,8 @@ struct WorkMsg;
 
 struct QueryTest : Collection<QueryTest,Index1D> {
   void work(WorkMsg* msg);
+
+  int num_work_ = 0;
 };
 
 struct WorkMsg : CollectionMessage<QueryTest> {};
@@ -68,6 +71,16 @@ void QueryTest::work(WorkMsg* msg) {
   auto proxy = vt::theCollection()->queryProxyContext<Index1D>();
   EXPECT_EQ(*idx, this->getIndex());
   EXPECT_EQ(proxy, this->getProxy());
+  num_work_++;
+}
+
+struct CheckMsg : CollectionMessage<QueryTest> {
+  explicit CheckMsg(int in_expected) : expected_(in_expected) { }
+  int expected_ = 0;
+};
+
+static void checkWork(CheckMsg* msg, QueryTest* col) {
+  EXPECT_EQ(col->num_work_, msg->expected_);
 }
 
 static constexpr int32_t const num_elms_per_node = 8;
@@ -96,4 +109,120 @@ TEST_F(TestQueryContext, test_query_context_send_1) {
   }
 }
 
+TEST_F(TestQueryContext, test_query_context_broadcast_parallel_1) {
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const num_bcasts = 10;
+
+  theConfig()->vt_coll_parallel_deliver = true;
+  theConfig()->vt_coll_parallel_min_elms = 2;
+
+  auto const& range = Index1D(num_nodes * num_elms_per_node);
+  auto proxy = makeCollection<QueryTest>()
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  runInEpochCollective([&]{
+    for (int i = 0; i < num_bcasts; i++) {
+      proxy.broadcastCollective<WorkMsg,&QueryTest::work>();
+    }
+  });
+
+  runInEpochCollective([&]{
+    proxy.broadcastCollective<CheckMsg,checkWork>(num_bcasts);
+  });
+
+  theConfig()->vt_coll_parallel_deliver = false;
+}
+
+struct ForkJoinTest;
+
+struct ForkWorkMsg : CollectionMessage<ForkJoinTest> {};
+struct ForkPingMsg : CollectionMessage<ForkJoinTest> {};
+
+struct ForkReduceMsg : collective::ReduceTMsg<int> {
+  explicit ForkReduceMsg(int const in_num)
+    : collective::ReduceTMsg<int>(in_num)
+  { }
+};
+
+static std::atomic<int> handlers_on_workers = {0};
+static int fork_num_elms = 0;
+
+struct ForkJoinTest : Collection<ForkJoinTest,Index1D> {
+  void work(ForkWorkMsg* msg) {
+    if (theContext()->getWorker() != worker_id_comm_thread) {
+      handlers_on_workers++;
+    }
+
+    // Send to the next element and contribute to a reduction from within
+    // the (possibly concurrent) handler
+    auto const proxy = getCollectionProxy();
+    auto const next = (getIndex().x() + 1) % fork_num_elms;
+    proxy[next].send<ForkPingMsg,&ForkJoinTest::ping>();
+
+    auto cb = theCB()->makeBcast<
+      ForkJoinTest, ForkReduceMsg, &ForkJoinTest::reduced
+    >(proxy);
+    auto reduce_msg = makeMessage<ForkReduceMsg>(1);
+    proxy.reduce<collective::PlusOp<int>>(reduce_msg.get(), cb);
+  }
+
+  void ping(ForkPingMsg*) { num_ping_++; }
+
+  void reduced(ForkReduceMsg* msg) {
+    EXPECT_EQ(msg->getVal(), fork_num_elms);
+    num_reduced_++;
+  }
+
+  int num_ping_ = 0;
+  int num_reduced_ = 0;
+};
+
+struct ForkCheckMsg : CollectionMessage<ForkJoinTest> {
+  explicit ForkCheckMsg(int in_expected) : expected_(in_expected) { }
+  int expected_ = 0;
+};
+
+static void checkForkJoin(ForkCheckMsg* msg, ForkJoinTest* col) {
+  EXPECT_EQ(col->num_ping_, msg->expected_);
+  EXPECT_EQ(col->num_reduced_, msg->expected_);
+}
+
+TEST_F(TestQueryContext, test_query_context_broadcast_parallel_comm_1) {
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const num_bcasts = 4;
+  fork_num_elms = num_nodes * num_elms_per_node;
+
+  theConfig()->vt_coll_parallel_deliver = true;
+  theConfig()->vt_coll_parallel_min_elms = 2;
+  handlers_on_workers = 0;
+
+  auto const& range = Index1D(fork_num_elms);
+  auto proxy = makeCollection<ForkJoinTest>()
+    .bounds(range)
+    .bulkInsert()
+    .wait();
+
+  for (int i = 0; i < num_bcasts; i++) {
+    runInEpochCollective([&]{
+      proxy.broadcastCollective<ForkWorkMsg,&ForkJoinTest::work>();
+    });
+  }
+
+  runInEpochCollective([&]{
+    proxy.broadcastCollective<ForkCheckMsg,checkForkJoin>(num_bcasts);
+  });
+
+  // With workers available the handlers must actually have been spread across
+  // the worker threads, not only run on the comm thread
+  if (theContext()->hasWorkers()) {
+    EXPECT_GT(handlers_on_workers.load(), 0);
+  } else {
+    EXPECT_EQ(handlers_on_workers.load(), 0);
+  }
+
+  theConfig()->vt_coll_parallel_deliver = false;
+}
+
 }}}} // end namespace vt::tests::unit::query
@@ -60,4 +60,37 @@ TEST_F(TestReduce, test_reduce_op) {
   theCollective()->global()->reduce<MyReduceMsg, reducePlus>(root, msg.get());
 }
 
+static constexpr int const num_local_contrib = 100;
+
+static void reducePlusMultiple(MyReduceMsg* msg) {
+  if (msg->isRoot()) {
+    auto n = vt::theContext()->getNumNodes();
+    EXPECT_EQ(msg->num, num_local_contrib * n * (n - 1)/2);
+  } else {
+    // Contributions are folded eagerly, one pair at a time
+    EXPECT_EQ(msg->getCount(), 2);
+    auto cur_msg = msg->getNext<MyReduceMsg>();
+    ASSERT_NE(cur_msg, nullptr);
+    EXPECT_EQ(cur_msg->getNext<MyReduceMsg>(), nullptr);
+    msg->num += cur_msg->num;
+  }
+}
+
+TEST_F(TestReduce, test_reduce_op_multiple_local_contrib) {
+  auto const my_node = theContext()->getNode();
+  auto const root = 0;
+
+  auto r = theCollective()->global();
+  auto stamp = r->generateNextID();
+
+  runInEpochCollective([&]{
+    for (int i = 0; i < num_local_contrib; i++) {
+      auto msg = makeMessage<MyReduceMsg>(my_node);
+      r->reduce<MyReduceMsg, reducePlusMultiple>(
+        root, msg.get(), stamp, num_local_contrib
+      );
+    }
+  });
+}
+
 }}} // end namespace vt::tests::unit
@@ -0,0 +1,145 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                         test_diagnostic_exporter.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include <vt/runtime/component/diagnostic_exporter.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if vt_check_enabled(diagnostics)
+
+namespace vt { namespace tests { namespace unit {
+
+using TestDiagnosticExporter = TestParallelHarness;
+
+struct TestExportDiagnostic : vt::runtime::component::Diagnostic {
+  TestExportDiagnostic() {
+    // choose a high ID as to not conflict with other components' automatically
+    // assigned IDs at startup
+    component_id_ = 10001;
+    counter_ = registerCounter("test-counter", "test counter");
+  }
+  virtual ~TestExportDiagnostic() = default;
+
+  void dumpState() override {}
+  std::string name() override { return "Test"; }
+
+  vt::runtime::component::diagnostic::Counter counter_;
+};
+
+std::vector<std::string> readLines(std::string const& file_name) {
+  std::vector<std::string> lines;
+  std::ifstream in(file_name);
+  std::string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+TEST_F(TestDiagnosticExporter, test_diagnostic_export_per_phase) {
+  using vt::runtime::component::Diagnostic;
+  using vt::runtime::component::DiagnosticExporter;
+
+  int const num_phases = 3;
+  auto const this_node = theContext()->getNode();
+  auto const base = std::string{"test_diag_export"};
+
+  theConfig()->vt_diag_export_file = base;
+  theConfig()->vt_diag_export_period = 0;
+  theConfig()->vt_diag_export_binary = false;
+  theConfig()->vt_diag_export_reduce = 1;
+
+  auto diag = std::make_unique<TestExportDiagnostic>();
+  auto exporter = std::make_unique<DiagnosticExporter>();
+  exporter->start(std::vector<Diagnostic*>{diag.get()});
+
+  for (int i = 0; i < num_phases; i++) {
+    runInEpochCollective([&]{
+      diag->counter_.increment(this_node + 1);
+      thePhase()->nextPhaseCollective();
+    });
+  }
+
+  exporter->stop();
+
+  // One sample per phase plus the final sample taken at stop
+  auto lines = readLines(fmt::format("{}.{}.csv", base, this_node));
+  ASSERT_EQ(lines.size(), static_cast<std::size_t>(num_phases + 2));
+  EXPECT_EQ(lines[0], "time,phase,Test.test-counter");
+  auto const& last = lines.back();
+  auto const last_val = std::stod(last.substr(last.rfind(',') + 1));
+  EXPECT_DOUBLE_EQ(last_val, static_cast<double>(num_phases * (this_node + 1)));
+
+  if (this_node == 0) {
+    auto const num_nodes = theContext()->getNumNodes();
+    auto reduced = readLines(fmt::format("{}.reduced.csv", base));
+    ASSERT_EQ(reduced.size(), static_cast<std::size_t>(num_phases + 1));
+    EXPECT_EQ(
+      reduced[0],
+      "phase,num_nodes,Test.test-counter.min,Test.test-counter.max,"
+      "Test.test-counter.avg"
+    );
+    std::vector<double> vals;
+    std::stringstream ss(reduced.back());
+    std::string field;
+    while (std::getline(ss, field, ',')) {
+      vals.push_back(std::stod(field));
+    }
+    ASSERT_EQ(vals.size(), 5ul);
+    EXPECT_DOUBLE_EQ(vals[1], num_nodes);
+    EXPECT_DOUBLE_EQ(vals[2], num_phases);
+    EXPECT_DOUBLE_EQ(vals[3], num_phases * num_nodes);
+    EXPECT_DOUBLE_EQ(vals[4], num_phases * (num_nodes + 1) / 2.0);
+  }
+}
+
+}}} // end namespace vt::tests::unit
+
+#endif /*vt_check_enabled(diagnostics)*/
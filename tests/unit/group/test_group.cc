@@ -159,4 +159,47 @@ TEST_F(TestGroup, test_group_collective_construct_1) {
   num_recv = 0;
 }
 
+TEST_F(TestGroup, test_group_collective_scan_construct) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  theConfig()->vt_group_scan_construct = true;
+
+  // Build the same membership twice: each construction scans independently
+  for (int i = 0; i < 2; i++) {
+    bool const node_filter = this_node % 2 == 0;
+
+    runInEpochCollective([&]{
+      theGroup()->newGroupCollective(
+        node_filter, [=](GroupType group) {
+          EXPECT_EQ(theGroup()->inGroup(group), node_filter);
+          EXPECT_EQ(theGroup()->isGroupDefault(group), false);
+          EXPECT_EQ(theGroup()->groupRoot(group), 0);
+          auto msg = makeMessage<TestMsg>();
+          envelopeSetGroup(msg->env, group);
+          theMsg()->broadcastMsg<TestMsg,groupHandler>(msg);
+        }
+      );
+    });
+
+    if (node_filter) {
+      EXPECT_EQ(num_recv, num_nodes);
+    } else {
+      EXPECT_EQ(num_recv, 0);
+    }
+    num_recv = 0;
+  }
+
+  // All nodes: equivalent to the default group
+  runInEpochCollective([&]{
+    theGroup()->newGroupCollective(
+      true, [=](GroupType group) {
+        EXPECT_EQ(theGroup()->isGroupDefault(group), true);
+      }
+    );
+  });
+
+  theConfig()->vt_group_scan_construct = false;
+}
+
 }}} // end namespace vt::tests::unit
@@ -0,0 +1,115 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              test_lb_replay.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "test_parallel_harness.h"
+
+#include <vt/transport.h>
+#include <vt/vrt/collection/balance/lb_invoke/lb_manager.h>
+#include <vt/vrt/collection/balance/model/raw_data.h>
+#include <vt/vrt/collection/balance/model/naive_persistence.h>
+
+#if vt_check_enabled(lblite)
+
+namespace vt { namespace tests { namespace unit { namespace replay {
+
+using TestLBReplay = TestParallelHarness;
+
+using vt::vrt::collection::balance::LBType;
+using vt::vrt::collection::balance::LoadMapType;
+using vt::vrt::collection::balance::NaivePersistence;
+using vt::vrt::collection::balance::RawData;
+using vt::vrt::collection::lb::Statistic;
+using vt::vrt::collection::lb::StatisticQuantity;
+
+TEST_F(TestLBReplay, test_lb_replay_propose_rotate) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const next_node = (this_node + 1) % num_nodes;
+  std::size_t const num_elms = 4;
+
+  // Synthesize recorded loads: every element on node n has load n+1
+  std::unordered_map<PhaseType, LoadMapType> loads;
+  std::unordered_map<PhaseType, elm::CommMapType> comm;
+  for (std::size_t i = 0; i < num_elms; i++) {
+    auto id = elm::ElmIDBits::createCollectionImpl(
+      true, i + 1, this_node, this_node
+    );
+    loads[0][id].whole_phase_load = this_node + 1;
+  }
+  comm[0];
+
+  auto raw = std::make_shared<RawData>();
+  raw->setLoads(&loads, &comm);
+  auto model = std::make_shared<NaivePersistence>(raw);
+
+  auto proposal = theLBManager()->proposeLB(
+    0, LBType::RotateLB, model, comm[0]
+  );
+
+  ASSERT_NE(proposal.reassignment_, nullptr);
+
+  if (num_nodes > 1) {
+    EXPECT_EQ(
+      proposal.reassignment_->global_migration_count,
+      static_cast<int32_t>(num_elms * num_nodes)
+    );
+    EXPECT_EQ(proposal.reassignment_->depart_.size(), num_elms);
+    for (auto&& dep : proposal.reassignment_->depart_) {
+      EXPECT_EQ(dep.second, next_node);
+    }
+    EXPECT_EQ(proposal.reassignment_->arrive_.size(), num_elms);
+  }
+
+  auto& before = proposal.before_[Statistic::P_l];
+  auto& after = proposal.after_[Statistic::P_l];
+  double const total = num_elms * num_nodes * (num_nodes + 1) / 2.0;
+  EXPECT_DOUBLE_EQ(before[StatisticQuantity::sum], total);
+  EXPECT_DOUBLE_EQ(after[StatisticQuantity::sum], total);
+  EXPECT_DOUBLE_EQ(before[StatisticQuantity::max], num_elms * num_nodes);
+  EXPECT_DOUBLE_EQ(after[StatisticQuantity::max], num_elms * num_nodes);
+  EXPECT_GE(proposal.strategy_time_, 0.);
+}
+
+}}}} // end namespace vt::tests::unit::replay
+
+#endif /*vt_check_enabled(lblite)*/
@@ -48,7 +48,11 @@
 #include "vt/topos/index/index.h"
 #include "vt/topos/mapping/mapping.h"
 #include "vt/topos/mapping/dense/dense.h"
+#include "vt/topos/mapping/dense/space_filling.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <set>
 #include <vector>
 
 namespace vt { namespace tests { namespace unit {
@@ -182,4 +186,167 @@ TEST_F(TestMapping, test_mapping_block_3d) {
   }
 }
 
+TEST_F(TestMapping, test_mapping_local_inverse_2d) {
+  using namespace vt;
+
+  using IndexType = Index2D::DenseIndexType;
+
+  std::array<std::array<IndexType, 2>, 5> sizes{{
+    {{16,16}}, {{3,7}}, {{7,3}}, {{1,5}}, {{2,2}}
+  }};
+
+  // Odd node counts and more nodes than elements exercise the remainder bins
+  for (NodeType nnodes : {1, 3, 8, 11}) {
+    for (auto&& elm : sizes) {
+      Index2D max_idx(std::get<0>(elm), std::get<1>(elm));
+
+      for (NodeType node = 0; node < nnodes; node++) {
+        std::vector<Index2D> block, rr;
+        mapping::denseBlockMapLocal<Index2D, 2>(
+          &max_idx, node, nnodes, [&](Index2D const& i) { block.push_back(i); }
+        );
+        mapping::denseRoundRobinMapLocal<Index2D, 2>(
+          &max_idx, node, nnodes, [&](Index2D const& i) { rr.push_back(i); }
+        );
+
+        std::vector<Index2D> block_fwd, rr_fwd;
+        for (int i = 0; i < max_idx[0]; i++) {
+          for (int j = 0; j < max_idx[1]; j++) {
+            Index2D idx_test(i, j);
+            if (mapping::dense2DBlockMap(&idx_test, &max_idx, nnodes) == node) {
+              block_fwd.push_back(idx_test);
+            }
+            if (mapping::dense2DRoundRobinMap(&idx_test, &max_idx, nnodes) == node) {
+              rr_fwd.push_back(idx_test);
+            }
+          }
+        }
+
+        EXPECT_EQ(block, block_fwd);
+        EXPECT_EQ(rr, rr_fwd);
+      }
+    }
+  }
+}
+
+TEST_F(TestMapping, test_mapping_local_inverse_3d) {
+  using namespace vt;
+
+  static constexpr NodeType const nnodes = 5;
+
+  Index3D max_idx(4, 3, 6);
+
+  std::size_t total = 0;
+  for (NodeType node = 0; node < nnodes; node++) {
+    mapping::denseBlockMapLocal<Index3D, 3>(
+      &max_idx, node, nnodes, [&](Index3D const& i) {
+        auto idx_test = i;
+        EXPECT_EQ(mapping::dense3DBlockMap(&idx_test, &max_idx, nnodes), node);
+        total++;
+      }
+    );
+  }
+
+  EXPECT_EQ(total, static_cast<std::size_t>(max_idx.getSize()));
+}
+
+TEST_F(TestMapping, test_mapping_hilbert_adjacent) {
+  using namespace vt;
+
+  // Consecutive Hilbert keys over a power-of-two cube are unit steps apart
+  static constexpr int const bits = 3;
+  static constexpr Index3D::DenseIndexType const n = 1 << bits;
+
+  Index3D max_idx(n, n, n);
+  std::vector<std::tuple<uint64_t, Index3D>> order;
+  max_idx.foreach([&](Index3D idx) {
+    order.emplace_back(mapping::hilbertKey<int32_t, 3>(idx, bits), idx);
+  });
+  std::sort(
+    order.begin(), order.end(), [](auto const& a, auto const& b) {
+      return std::get<0>(a) < std::get<0>(b);
+    }
+  );
+
+  for (std::size_t i = 0; i < order.size(); i++) {
+    EXPECT_EQ(std::get<0>(order[i]), i);
+    if (i > 0) {
+      auto const& a = std::get<1>(order[i - 1]);
+      auto const& b = std::get<1>(order[i]);
+      int dist = 0;
+      for (int d = 0; d < 3; d++) {
+        dist += std::abs(a[d] - b[d]);
+      }
+      EXPECT_EQ(dist, 1);
+    }
+  }
+}
+
+TEST_F(TestMapping, test_mapping_curve_partition) {
+  using namespace vt;
+
+  Index3D max_idx(6, 5, 7);
+
+  for (auto curve : {
+    mapping::SpaceFillingCurve::Hilbert, mapping::SpaceFillingCurve::Morton
+  }) {
+    for (int32_t grain : {1, 2}) {
+      for (NodeType nnodes : {1, 4, 7}) {
+        mapping::CurvePartition<int32_t, 3> part{max_idx, curve, grain, nnodes};
+
+        std::vector<std::size_t> map_cnt(nnodes);
+        std::set<uint64_t> keys;
+        max_idx.foreach([&](Index3D idx) {
+          auto const node = part.map(idx);
+          ASSERT_LT(node, nnodes);
+          map_cnt[node]++;
+          keys.insert(part.elementKey(idx));
+        });
+        EXPECT_EQ(keys.size(), max_idx.getSize());
+
+        // Segments are balanced to within one tile
+        auto const tile = static_cast<std::size_t>(grain * grain * grain);
+        auto const ideal = max_idx.getSize() / nnodes;
+        for (NodeType node = 0; node < nnodes; node++) {
+          EXPECT_LE(map_cnt[node], ideal + tile);
+          EXPECT_GE(map_cnt[node] + tile, ideal);
+
+          std::size_t local = 0;
+          part.mapLocal(max_idx, node, [&](Index3D const& idx) {
+            EXPECT_EQ(part.map(idx), node);
+            local++;
+          });
+          EXPECT_EQ(local, map_cnt[node]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestMapping, test_mapping_curve_partition_large) {
+  using namespace vt;
+
+  // Neither construction nor mapLocal may enumerate the 2^60 index space
+  static constexpr Index3D::DenseIndexType const n = 1 << 20;
+  static constexpr NodeType const nnodes = 1000;
+
+  Index3D max_idx(n, n, n);
+  Index3D range(4, 4, 4);
+
+  for (auto curve : {
+    mapping::SpaceFillingCurve::Hilbert, mapping::SpaceFillingCurve::Morton
+  }) {
+    mapping::CurvePartition<int32_t, 3> part{max_idx, curve, 1, nnodes};
+
+    std::size_t total = 0;
+    for (NodeType node = 0; node < nnodes; node++) {
+      part.mapLocal(range, node, [&](Index3D const& idx) {
+        EXPECT_EQ(part.map(idx), node);
+        total++;
+      });
+    }
+    EXPECT_EQ(total, static_cast<std::size_t>(range.getSize()));
+  }
+}
+
 }}} // end namespace vt::tests::unit
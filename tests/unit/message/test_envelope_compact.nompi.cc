@@ -0,0 +1,144 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                        test_envelope_compact.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/config.h>
+#include <vt/messaging/envelope.h>
+#include <vt/messaging/envelope/envelope_compact.h>
+#include "test_harness.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestEnvelopeCompact = TestHarness;
+
+static constexpr NodeType const recv_node = 3;
+
+EpochTagEnvelope roundTrip(EpochTagEnvelope& env, std::size_t& header_size) {
+  envelopeSetIsLocked(env, true);
+
+  char wire[envelope_compact_max_bytes] = {};
+  header_size = envelopeCompactEncode(env.env, recv_node, wire);
+  EXPECT_TRUE(envelopeIsCompact(wire));
+  EXPECT_LE(header_size, envelope_compact_max_bytes);
+
+  EpochTagEnvelope out;
+  auto const consumed = envelopeCompactDecode(
+    wire, header_size, recv_node, reinterpret_cast<char*>(&out)
+  );
+  EXPECT_EQ(consumed, header_size);
+  EXPECT_EQ(envelopeFullSize(out.env), sizeof(EpochTagEnvelope));
+  EXPECT_TRUE(envelopeIsLocked(out));
+  return out;
+}
+
+TEST_F(TestEnvelopeCompact, test_envelope_compact_defaults) {
+  EpochTagEnvelope env;
+  envelopeInitEmpty(env);
+  envelopeSetHandler(env, 0x1F00000042);
+  envelopeSetDest(env, recv_node);
+
+  std::size_t header_size = 0;
+  auto out = roundTrip(env, header_size);
+
+  // Absent epoch, tag, group, and dest cost no bytes on the wire
+  EXPECT_LT(header_size, sizeof(EpochTagEnvelope));
+  EXPECT_EQ(envelopeGetHandler(out), 0x1F00000042);
+  EXPECT_EQ(envelopeGetDest(out), recv_node);
+  EXPECT_EQ(envelopeGetEpoch(out), no_epoch);
+  EXPECT_EQ(envelopeGetTag(out), no_tag);
+  EXPECT_EQ(envelopeGetGroup(out), default_group);
+  EXPECT_FALSE(envelopeIsBcast(out));
+}
+
+TEST_F(TestEnvelopeCompact, test_envelope_compact_all_fields) {
+  EpochTagEnvelope env;
+  envelopeInitEmpty(env);
+  setBroadcastType(env, false);
+  setTermType(env);
+  envelopeSetHandler(env, 12);
+  envelopeSetDest(env, 1);
+  envelopeSetGroup(env, 42);
+  envelopeSetEpoch(env, EpochType{0xDEADBEEF00000007ull});
+  envelopeSetTag(env, 1234567);
+  envelopeSetHasBeenSerialized(env, true);
+  envelopeSetCommStatsRecordedAboveBareHandler(env, true);
+  envelopeSetSchedQueue(env, SchedQueue::Background);
+
+  std::size_t header_size = 0;
+  auto out = roundTrip(env, header_size);
+
+  EXPECT_TRUE(envelopeIsBcast(out));
+  EXPECT_TRUE(envelopeIsTerm(out));
+  EXPECT_FALSE(envelopeGetDeliverBcast(out));
+  EXPECT_EQ(envelopeGetHandler(out), 12);
+  EXPECT_EQ(envelopeGetDest(out), 1);
+  EXPECT_EQ(envelopeGetGroup(out), 42u);
+  EXPECT_EQ(envelopeGetEpoch(out), EpochType{0xDEADBEEF00000007ull});
+  EXPECT_EQ(envelopeGetTag(out), 1234567);
+  EXPECT_TRUE(envelopeHasBeenSerialized(out));
+  EXPECT_TRUE(envelopeCommStatsRecordedAboveBareHandler(out));
+  EXPECT_EQ(envelopeGetSchedQueue(out), SchedQueue::Background);
+}
+
+TEST_F(TestEnvelopeCompact, test_envelope_compact_basic_envelope) {
+  Envelope env;
+  envelopeInit(env);
+  envelopeSetHandler(env, 7);
+  envelopeSetDest(env, recv_node);
+  envelopeSetIsLocked(env, true);
+
+  char wire[envelope_compact_max_bytes] = {};
+  auto const header_size = envelopeCompactEncode(env, recv_node, wire);
+
+  EpochTagEnvelope out;
+  envelopeCompactDecode(
+    wire, header_size, recv_node, reinterpret_cast<char*>(&out)
+  );
+  EXPECT_EQ(envelopeFullSize(out.env), sizeof(Envelope));
+  EXPECT_FALSE(envelopeIsEpochType(out.env));
+  EXPECT_FALSE(envelopeIsTagType(out.env));
+  EXPECT_EQ(envelopeGetHandler(out.env), 7);
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,179 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_callback_local.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/pipe/pipe_manager.h"
+#include "vt/collective/collective_alg.h"
+#include "vt/collective/reduce/operators/default_msg.h"
+
+namespace vt { namespace tests { namespace unit { namespace local {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+struct DataMsg : vt::Message {
+  DataMsg() = default;
+  explicit DataMsg(int in_a) : a(in_a) { }
+  int a = 0;
+};
+
+struct CallbackDataMsg : vt::Message {
+  CallbackDataMsg() = default;
+  explicit CallbackDataMsg(Callback<DataMsg> in_cb) : cb_(in_cb) { }
+
+  Callback<DataMsg> cb_;
+};
+
+struct Context {
+  int val = 0;
+
+  void handler(DataMsg* msg) { val = msg->a; }
+  void handlerVoid() { val = -1; }
+};
+
+using SumMsg = collective::ReduceTMsg<int>;
+
+struct ReduceContext {
+  int sum = -1;
+
+  void done(SumMsg* msg) { sum = msg->getConstVal(); }
+};
+
+static int32_t called = 0;
+
+struct TestCallbackLocal : TestParallelHarness {
+  static void test_handler(CallbackDataMsg* msg) {
+    msg->cb_.send(theContext()->getNode() + 10);
+  }
+};
+
+TEST_F(TestCallbackLocal, test_callback_local_func) {
+  called = 0;
+  auto cb = theCB()->makeFuncLocal<DataMsg>([](DataMsg* msg){
+    called = msg->a;
+  });
+  cb.send(300);
+  EXPECT_EQ(called, 300);
+
+  auto cb_void = theCB()->makeFuncLocal([]{ called = 900; });
+  cb_void.send();
+  EXPECT_EQ(called, 900);
+}
+
+TEST_F(TestCallbackLocal, test_callback_local_func_ctx) {
+  Context ctx;
+  auto cb = theCB()->makeFuncLocal<DataMsg, Context>(
+    &ctx, [](DataMsg* msg, Context* my_ctx){ my_ctx->val = msg->a; }
+  );
+  cb.send(42);
+  EXPECT_EQ(ctx.val, 42);
+
+  auto cb_void = theCB()->makeFuncLocal<Context>(
+    &ctx, [](Context* my_ctx){ my_ctx->val = 7; }
+  );
+  cb_void.send();
+  EXPECT_EQ(ctx.val, 7);
+}
+
+TEST_F(TestCallbackLocal, test_callback_local_member) {
+  Context ctx;
+  auto cb = theCB()->makeMemberLocal<Context, DataMsg, &Context::handler>(&ctx);
+  cb.send(11);
+  EXPECT_EQ(ctx.val, 11);
+
+  auto cb_void = theCB()->makeMemberLocal<Context, &Context::handlerVoid>(&ctx);
+  cb_void.send();
+  EXPECT_EQ(ctx.val, -1);
+
+  // Callbacks compare equal only with the same target and context
+  Context other;
+  EXPECT_TRUE(
+    cb == (theCB()->makeMemberLocal<Context, DataMsg, &Context::handler>(&ctx))
+  );
+  EXPECT_FALSE(
+    cb == (theCB()->makeMemberLocal<Context, DataMsg, &Context::handler>(&other))
+  );
+}
+
+TEST_F(TestCallbackLocal, test_callback_local_in_message) {
+  called = 0;
+
+  // The callback is carried through a message and triggered on this node
+  runInEpochCollective([]{
+    auto cb = theCB()->makeFuncLocal<DataMsg>([](DataMsg* msg){
+      called = msg->a;
+    });
+    auto msg = makeMessage<CallbackDataMsg>(cb);
+    theMsg()->sendMsg<CallbackDataMsg, TestCallbackLocal::test_handler>(
+      theContext()->getNode(), msg
+    );
+  });
+
+  EXPECT_EQ(called, theContext()->getNode() + 10);
+}
+
+TEST_F(TestCallbackLocal, test_callback_local_reduce) {
+  ReduceContext ctx;
+
+  // Every node passes a callback to its own context; only the root's may fire
+  runInEpochCollective([&ctx]{
+    auto msg = makeMessage<SumMsg>(1);
+    auto cb = theCB()->makeMemberLocal<
+      ReduceContext, SumMsg, &ReduceContext::done
+    >(&ctx);
+    theCollective()->global()->reduce<collective::PlusOp<int>>(
+      0, msg.get(), cb
+    );
+  });
+
+  if (theContext()->getNode() == 0) {
+    EXPECT_EQ(ctx.sum, static_cast<int>(theContext()->getNumNodes()));
+  } else {
+    EXPECT_EQ(ctx.sum, -1);
+  }
+}
+
+}}}} // end namespace vt::tests::unit::local
@@ -118,4 +118,41 @@ TEST_F(TestPool, pool_alloc) {
   }
 }
 
+TEST_F(TestPool, pool_alloc_sized) {
+  using namespace vt;
+  using PoolType = pool::Pool;
+
+  static constexpr std::size_t const small_bytes = 16;
+  static constexpr std::size_t const medium_bytes = pool::memory_size_small + 1;
+  static constexpr std::size_t const large_bytes = pool::memory_size_medium + 1;
+
+  static_assert(
+    PoolType::getSizeClass(small_bytes) == PoolType::ePoolSize::Small &&
+    PoolType::getSizeClass(medium_bytes) == PoolType::ePoolSize::Medium &&
+    PoolType::getSizeClass(large_bytes) == PoolType::ePoolSize::Malloc,
+    "Size classes must be resolved at compile time"
+  );
+
+  std::unique_ptr<PoolType> testPool = std::make_unique<PoolType>();
+
+  void* small = testPool->allocSized<small_bytes>();
+  void* medium = testPool->allocSized<medium_bytes>();
+  void* large = testPool->allocSized<large_bytes>();
+
+  // The bucket recorded at allocation determines the slack at the end
+  if (testPool->active()) {
+    EXPECT_EQ(
+      testPool->remainingSize(small), pool::memory_size_small - small_bytes
+    );
+    EXPECT_EQ(
+      testPool->remainingSize(medium), pool::memory_size_medium - medium_bytes
+    );
+    EXPECT_EQ(testPool->remainingSize(large), 0u);
+  }
+
+  testPool->dealloc(small);
+  testPool->dealloc(medium);
+  testPool->dealloc(large);
+}
+
 }}} // end namespace vt::tests::unit
@@ -150,6 +150,97 @@ TEST_F(TestComponentConstruction, test_component_construct_dispatch_move_3) {
   EXPECT_NE(my_dumb_pointer, nullptr);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Test adaptive polling skips idle components and backs off on empty polls
+////////////////////////////////////////////////////////////////////////////////
+
+struct MyPollable : runtime::component::PollableComponent<MyPollable> {
+  MyPollable() = default;
+  std::string name() override { return "MyPollable"; }
+  int progress() override { polls++; return units; }
+  bool hasPendingWork() override { return pending; }
+
+  bool pending = false;
+  int units = 0;
+  int polls = 0;
+};
+
+TEST_F(TestComponentConstruction, test_component_adaptive_poll_4) {
+  using vt::runtime::component::ComponentPack;
+  using vt::runtime::component::Deps;
+
+  auto const prev_adaptive = theConfig()->vt_sched_adaptive_poll;
+  auto const prev_backoff = theConfig()->vt_sched_poll_max_backoff;
+  theConfig()->vt_sched_adaptive_poll = true;
+  theConfig()->vt_sched_poll_max_backoff = 4;
+
+  MyPollable* my_dumb_pointer = nullptr;
+
+  auto p = std::make_unique<ComponentPack>();
+  p->registerComponent<MyPollable>(&my_dumb_pointer, Deps<>{});
+  p->add<MyPollable>();
+  p->construct();
+  ASSERT_NE(my_dumb_pointer, nullptr);
+
+  // Nothing pending: never polled
+  for (int i = 0; i < 10; i++) {
+    p->progress();
+  }
+  EXPECT_EQ(my_dumb_pointer->polls, 0);
+
+  // Pending but empty polls: skip 1, 2, 4, 4, ... calls between polls
+  my_dumb_pointer->pending = true;
+  for (int i = 0; i < 20; i++) {
+    p->progress();
+  }
+  EXPECT_EQ(my_dumb_pointer->polls, 5);
+
+  // A poll that makes progress resets the backoff
+  my_dumb_pointer->units = 1;
+  my_dumb_pointer->polls = 0;
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(p->progress(), 1);
+  }
+  EXPECT_EQ(my_dumb_pointer->polls, 10);
+
+  theConfig()->vt_sched_adaptive_poll = prev_adaptive;
+  theConfig()->vt_sched_poll_max_backoff = prev_backoff;
+}
+
+struct MyEagerPollable : runtime::component::PollableComponent<MyEagerPollable> {
+  MyEagerPollable() = default;
+  std::string name() override { return "MyEagerPollable"; }
+  int progress() override { polls++; return 0; }
+  bool hasPendingWork() override { return false; }
+  bool backoffWhenIdle() override { return false; }
+
+  int polls = 0;
+};
+
+TEST_F(TestComponentConstruction, test_component_adaptive_poll_no_backoff_5) {
+  using vt::runtime::component::ComponentPack;
+  using vt::runtime::component::Deps;
+
+  auto const prev_adaptive = theConfig()->vt_sched_adaptive_poll;
+  theConfig()->vt_sched_adaptive_poll = true;
+
+  MyEagerPollable* my_dumb_pointer = nullptr;
+
+  auto p = std::make_unique<ComponentPack>();
+  p->registerComponent<MyEagerPollable>(&my_dumb_pointer, Deps<>{});
+  p->add<MyEagerPollable>();
+  p->construct();
+  ASSERT_NE(my_dumb_pointer, nullptr);
+
+  // Opted out of backoff: polled on every call despite empty polls
+  for (int i = 0; i < 10; i++) {
+    p->progress();
+  }
+  EXPECT_EQ(my_dumb_pointer->polls, 10);
+
+  theConfig()->vt_sched_adaptive_poll = prev_adaptive;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 }}} /* end namespace vt::tests::unit */
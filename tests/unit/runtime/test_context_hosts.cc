@@ -0,0 +1,86 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_context_hosts.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include <vt/transport.h>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestContextHosts = TestParallelHarness;
+
+TEST_F(TestContextHosts, test_hosts_partition_nodes) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const num_hosts = theContext()->getNumHosts();
+
+  EXPECT_GE(num_hosts, 1);
+  EXPECT_LE(num_hosts, num_nodes);
+
+  auto const this_host = theContext()->getHost();
+  EXPECT_EQ(this_host, theContext()->getHost(this_node));
+
+  NodeType total = 0;
+  for (NodeType host = 0; host < num_hosts; host++) {
+    auto const nodes = theContext()->getNodesOnHost(host);
+    ASSERT_FALSE(nodes.empty());
+    for (auto&& node : nodes) {
+      EXPECT_EQ(theContext()->getHost(node), host);
+    }
+    total += static_cast<NodeType>(nodes.size());
+  }
+  EXPECT_EQ(total, num_nodes);
+
+  // Hosts are numbered in order of their lowest node
+  EXPECT_EQ(theContext()->getHost(0), 0);
+  for (NodeType host = 1; host < num_hosts; host++) {
+    EXPECT_LT(
+      theContext()->getNodesOnHost(host - 1)[0],
+      theContext()->getNodesOnHost(host)[0]
+    );
+  }
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,155 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_coroutine.cxx20.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/scheduler/scheduler.h"
+#include "vt/scheduler/coroutine.h"
+#include "vt/transport.h"
+#include "test_parallel_harness.h"
+
+/*
+ * Built only with -Dvt_coroutines_enabled=ON, as a separate C++20 target; VT
+ * itself stays C++14.
+ */
+#if !defined(__cpp_impl_coroutine) || __cpp_impl_coroutine < 201902L
+# error "Coroutine tests must be compiled as C++20 with coroutine support"
+#endif
+
+namespace vt { namespace tests { namespace unit { namespace coroutine {
+
+struct TestCoroutine : TestParallelHarness { };
+
+static int coro_stage = 0;
+
+static coro::Task waitOnEpoch(EpochType ep) {
+  coro_stage = 1;
+  co_await coro::epoch(ep);
+  coro_stage = 2;
+}
+
+TEST_F(TestCoroutine, test_coroutine_epoch) {
+  coro_stage = 0;
+
+  auto ep = theTerm()->makeEpochRooted();
+
+  // The enclosing epoch can only terminate after the coroutine finishes, which
+  // requires `ep' to terminate first
+  runInEpochCollective([&]{
+    waitOnEpoch(ep);
+    EXPECT_EQ(coro_stage, 1);
+    theTerm()->finishedEpoch(ep);
+  });
+
+  EXPECT_EQ(coro_stage, 2);
+}
+
+/// Completes after a fixed number of polls
+struct CountdownOp final : messaging::AsyncOp {
+  explicit CountdownOp(int in_polls, bool* in_done)
+    : polls_(in_polls), done_(in_done)
+  { }
+
+  bool poll() override { return --polls_ <= 0; }
+  void done() override { *done_ = true; }
+
+private:
+  int polls_ = 0;
+  bool* done_ = nullptr;
+};
+
+static bool op_done = false;
+
+static coro::Task waitOnOp() {
+  coro_stage = 1;
+  co_await coro::asyncOp(std::make_unique<CountdownOp>(5, &op_done));
+  // The operation's completion hook runs before the coroutine is resumed
+  EXPECT_TRUE(op_done);
+  coro_stage = 2;
+}
+
+TEST_F(TestCoroutine, test_coroutine_async_op) {
+  coro_stage = 0;
+  op_done = false;
+
+  runInEpochCollective([&]{
+    waitOnOp();
+    EXPECT_EQ(coro_stage, 1);
+  });
+
+  EXPECT_EQ(coro_stage, 2);
+  EXPECT_TRUE(op_done);
+}
+
+struct ValueMsg : vt::Message {
+  ValueMsg() = default;
+  explicit ValueMsg(int in_val) : val_(in_val) { }
+  int val_ = 0;
+};
+
+static int coro_value = 0;
+
+static coro::Task waitOnCallback(int val) {
+  coro_stage = 1;
+  auto msg = co_await coro::callback<ValueMsg>([val](Callback<ValueMsg> cb){
+    cb.send(val);
+  });
+  coro_value = msg->val_;
+  coro_stage = 2;
+}
+
+TEST_F(TestCoroutine, test_coroutine_callback) {
+  coro_stage = 0;
+  coro_value = 0;
+
+  auto const val = 29 + static_cast<int>(theContext()->getNode());
+
+  runInEpochCollective([&]{
+    waitOnCallback(val);
+  });
+
+  EXPECT_EQ(coro_stage, 2);
+  EXPECT_EQ(coro_value, val);
+}
+
+}}}} // end namespace vt::tests::unit::coroutine
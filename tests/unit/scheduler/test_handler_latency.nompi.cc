@@ -0,0 +1,114 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                        test_handler_latency.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/config.h>
+#include <vt/scheduler/handler_latency.h>
+#include "test_harness.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestHandlerLatency = TestHarness;
+
+static constexpr HandlerType const han_a = 0x10;
+static constexpr HandlerType const han_b = 0x20;
+
+TEST_F(TestHandlerLatency, test_handler_latency_record) {
+  sched::HandlerLatency lat;
+
+  for (int i = 1; i <= 100; i++) {
+    lat.record(han_a, i * 1e-6, 1e-3);
+  }
+  lat.record(uninitialized_handler, 5e-6, 2e-6);
+
+  // Units without a handler are not recorded
+  ASSERT_EQ(lat.getHandlers().size(), 1u);
+  auto& sketch = lat.getHandlers()[han_a];
+  EXPECT_EQ(sketch.getCount(), 100);
+  EXPECT_NEAR(sketch.getDelay().quantile(0.5), 50e-6, 5e-6);
+  EXPECT_NEAR(sketch.getDelay().quantile(0.99), 99e-6, 5e-6);
+  EXPECT_DOUBLE_EQ(sketch.getDelay().getMax(), 100e-6);
+  EXPECT_DOUBLE_EQ(sketch.getExec().getMax(), 1e-3);
+}
+
+TEST_F(TestHandlerLatency, test_handler_latency_merge) {
+  sched::HandlerLatency lat1, lat2;
+
+  for (int i = 0; i < 50; i++) {
+    lat1.record(han_a, 1e-6, 1e-6);
+    lat2.record(han_a, 3e-6, 1e-6);
+    lat2.record(han_b, 1e-3, 1e-6);
+  }
+
+  auto merged = lat1 + lat2;
+
+  ASSERT_EQ(merged.getHandlers().size(), 2u);
+  EXPECT_EQ(merged.getHandlers()[han_a].getCount(), 100);
+  EXPECT_EQ(merged.getHandlers()[han_b].getCount(), 50);
+  EXPECT_DOUBLE_EQ(merged.getHandlers()[han_a].getDelay().getMin(), 1e-6);
+  EXPECT_DOUBLE_EQ(merged.getHandlers()[han_a].getDelay().getMax(), 3e-6);
+}
+
+TEST_F(TestHandlerLatency, test_handler_latency_most_frequent) {
+  sched::HandlerLatency lat;
+
+  static constexpr HandlerType const han_c = 0x30;
+
+  for (int i = 0; i < 10; i++) {
+    lat.record(han_b, 1e-6, 1e-6);
+    lat.record(han_c, 1e-6, 1e-6);
+  }
+  for (int i = 0; i < 20; i++) {
+    lat.record(han_a, 1e-6, 1e-6);
+  }
+
+  // Most frequent first, ties ordered by handler
+  EXPECT_EQ(
+    lat.mostFrequent(3), (std::vector<HandlerType>{han_a, han_b, han_c})
+  );
+  EXPECT_EQ(lat.mostFrequent(2), (std::vector<HandlerType>{han_a, han_b}));
+  EXPECT_TRUE(lat.mostFrequent(0).empty());
+}
+
+}}} // end namespace vt::tests::unit
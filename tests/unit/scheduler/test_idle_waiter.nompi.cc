@@ -0,0 +1,89 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_idle_waiter.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/config.h>
+#include <vt/scheduler/idle_waiter.h>
+#include "test_harness.h"
+
+#include <thread>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestIdleWaiter = TestHarness;
+
+TEST_F(TestIdleWaiter, test_idle_waiter_timeout) {
+  vt::sched::IdleWaiter waiter;
+  EXPECT_FALSE(waiter.wait(0.001));
+}
+
+TEST_F(TestIdleWaiter, test_idle_waiter_notify_before_wait) {
+  vt::sched::IdleWaiter waiter;
+
+  // A notification with no waiter is remembered, then consumed by one wait
+  waiter.notify();
+  EXPECT_TRUE(waiter.wait(3600.));
+  EXPECT_FALSE(waiter.wait(0.001));
+}
+
+TEST_F(TestIdleWaiter, test_idle_waiter_notify_coalesce) {
+  vt::sched::IdleWaiter waiter;
+
+  // Notifications while one is pending collapse into a single wakeup
+  for (int i = 0; i < 8; i++) {
+    waiter.notify();
+  }
+  EXPECT_TRUE(waiter.wait(3600.));
+  EXPECT_FALSE(waiter.wait(0.001));
+}
+
+TEST_F(TestIdleWaiter, test_idle_waiter_notify_from_thread) {
+  vt::sched::IdleWaiter waiter;
+
+  std::thread t([&waiter]{ waiter.notify(); });
+  EXPECT_TRUE(waiter.wait(3600.));
+  t.join();
+}
+
+}}} // end namespace vt::tests::unit
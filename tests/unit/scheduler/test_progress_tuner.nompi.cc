@@ -0,0 +1,117 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                         test_progress_tuner.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/config.h>
+#include <vt/scheduler/progress_tuner.h>
+#include "test_harness.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestProgressTuner = TestHarness;
+using Decision = vt::sched::ProgressTuner::Decision;
+
+static constexpr int32_t const num_polls =
+  vt::sched::ProgressTuner::window_polls;
+
+// Feed a window of polls, each after running the current interval's handlers
+// at the given handler rate
+Decision runWindow(
+  vt::sched::ProgressTuner& tuner, int32_t productive_polls, double rate
+) {
+  auto decision = Decision::None;
+  for (int i = 0; i < num_polls; i++) {
+    auto const han = tuner.getInterval();
+    decision = tuner.recordPoll(i < productive_polls, han, han / rate);
+  }
+  return decision;
+}
+
+TEST_F(TestProgressTuner, test_progress_tuner_compute_bound_increases) {
+  vt::sched::ProgressTuner tuner{1, 1, 16};
+
+  // Unproductive polls double the interval while throughput holds, up to max
+  EXPECT_EQ(runWindow(tuner, 0, 1e6), Decision::Increase);
+  EXPECT_EQ(tuner.getInterval(), 2);
+  for (int i = 0; i < 10; i++) {
+    runWindow(tuner, 0, 1e6);
+  }
+  EXPECT_EQ(tuner.getInterval(), 16);
+  EXPECT_DOUBLE_EQ(tuner.getProductiveRatio(), 0.);
+  EXPECT_NEAR(tuner.getThroughput(), 1e6, 1.);
+}
+
+TEST_F(TestProgressTuner, test_progress_tuner_latency_bound_decreases) {
+  vt::sched::ProgressTuner tuner{16, 1, 64};
+
+  // Mostly productive polls halve the interval down to min
+  EXPECT_EQ(runWindow(tuner, num_polls, 1e6), Decision::Decrease);
+  EXPECT_EQ(tuner.getInterval(), 8);
+  for (int i = 0; i < 10; i++) {
+    runWindow(tuner, num_polls, 1e6);
+  }
+  EXPECT_EQ(tuner.getInterval(), 1);
+
+  // Productivity between the thresholds holds the interval
+  vt::sched::ProgressTuner mid{4, 1, 64};
+  EXPECT_EQ(runWindow(mid, num_polls / 4, 1e6), Decision::None);
+  EXPECT_EQ(mid.getInterval(), 4);
+}
+
+TEST_F(TestProgressTuner, test_progress_tuner_revert_on_throughput_loss) {
+  vt::sched::ProgressTuner tuner{4, 1, 64};
+
+  EXPECT_EQ(runWindow(tuner, 0, 1e6), Decision::Increase);
+  EXPECT_EQ(tuner.getInterval(), 8);
+
+  // The larger interval lowered throughput, so it is undone and held
+  EXPECT_EQ(runWindow(tuner, 0, 5e5), Decision::Revert);
+  EXPECT_EQ(tuner.getInterval(), 4);
+  for (int i = 0; i < vt::sched::ProgressTuner::hold_windows; i++) {
+    EXPECT_EQ(runWindow(tuner, 0, 5e5), Decision::None);
+  }
+  EXPECT_EQ(runWindow(tuner, 0, 5e5), Decision::Increase);
+}
+
+}}} // end namespace vt::tests::unit
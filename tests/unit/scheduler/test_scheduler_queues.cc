@@ -0,0 +1,108 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_scheduler_queues.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/scheduler/scheduler.h"
+#include "test_parallel_harness.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestSchedulerQueues = TestParallelHarness;
+
+struct QueueTestMsg : vt::Message { };
+
+static constexpr int const num_user_units = 100;
+
+TEST_F(TestSchedulerQueues, test_scheduler_system_queue_overtakes_user) {
+  std::vector<char> order;
+
+  for (int i = 0; i < num_user_units; i++) {
+    theSched()->enqueue([&]{ order.push_back('u'); });
+  }
+  theSched()->enqueue(SchedQueue::System, [&]{ order.push_back('s'); });
+
+  EXPECT_EQ(theSched()->workQueueSize(SchedQueue::System), 1u);
+
+  theSched()->runSchedulerWhile([&]{
+    return order.size() < static_cast<std::size_t>(num_user_units + 1);
+  });
+
+  // The system unit waits for at most one turn of the user queue
+  auto const pos = std::find(order.begin(), order.end(), 's') - order.begin();
+  EXPECT_LE(pos, theConfig()->vt_sched_weight_user);
+}
+
+TEST_F(TestSchedulerQueues, test_scheduler_background_queue_not_starved) {
+  std::vector<char> order;
+
+  for (int i = 0; i < num_user_units; i++) {
+    theSched()->enqueue([&]{ order.push_back('u'); });
+  }
+  theSched()->enqueue(SchedQueue::Background, [&]{ order.push_back('b'); });
+
+  theSched()->runSchedulerWhile([&]{
+    return order.size() < static_cast<std::size_t>(num_user_units + 1);
+  });
+
+  auto const pos = std::find(order.begin(), order.end(), 'b') - order.begin();
+  EXPECT_LT(pos, num_user_units);
+}
+
+TEST_F(TestSchedulerQueues, test_scheduler_queue_from_envelope) {
+  bool ran = false;
+
+  auto msg = makeMessage<QueueTestMsg>();
+  envelopeSetSchedQueue(msg->env, SchedQueue::Background);
+  theSched()->enqueue(msg, [&]{ ran = true; });
+
+  EXPECT_EQ(theSched()->workQueueSize(SchedQueue::Background), 1u);
+
+  theSched()->runSchedulerWhile([&]{ return not ran; });
+  EXPECT_EQ(theSched()->workQueueSize(SchedQueue::Background), 0u);
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,75 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_scheduler_suspend.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/scheduler/scheduler.h"
+#include "vt/transport.h"
+#include "test_parallel_harness.h"
+
+namespace vt { namespace tests { namespace unit {
+
+struct TestSchedulerSuspend : TestParallelHarness { };
+
+TEST_F(TestSchedulerSuspend, test_scheduler_suspend_action) {
+  int count = 0;
+
+  auto id1 = theSched()->suspendAction([&]{ count += 1; });
+  auto id2 = theSched()->suspendAction([&]{ count += 10; });
+  EXPECT_NE(id1, id2);
+  EXPECT_NE(id1, no_thread_id);
+
+  // Nothing runs until resumed
+  theSched()->runSchedulerWhile([]{ return not theSched()->workQueueEmpty(); });
+  EXPECT_EQ(count, 0);
+
+  theSched()->resume(id2);
+  theSched()->runSchedulerWhile([&]{ return count != 10; });
+  EXPECT_EQ(count, 10);
+
+  theSched()->resume(id1);
+  theSched()->runSchedulerWhile([&]{ return count != 11; });
+  EXPECT_EQ(count, 11);
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,152 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_scheduler_timers.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "vt/scheduler/scheduler.h"
+#include "vt/timing/timing.h"
+#include "test_parallel_harness.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using TestSchedulerTimers = TestParallelHarness;
+
+static void drainScheduler() {
+  theSched()->runSchedulerWhile([]{
+    return
+      theSched()->numPendingTimers() > 0 or
+      not theSched()->workQueueEmpty();
+  });
+}
+
+TEST_F(TestSchedulerTimers, test_scheduler_enqueue_after_holds_epoch) {
+  TimeType const delay = 0.01;
+  TimeType ran_at = 0.;
+
+  auto const start = timing::getCurrentTime();
+  runInEpochRooted([&]{
+    theSched()->enqueueAfter(delay, [&]{
+      ran_at = timing::getCurrentTime();
+    });
+  });
+
+  // The epoch cannot terminate before the delayed unit runs
+  EXPECT_GE(ran_at - start, delay);
+  EXPECT_EQ(theSched()->numPendingTimers(), 0u);
+}
+
+TEST_F(TestSchedulerTimers, test_scheduler_cancel_timer_releases_epoch) {
+  bool ran = false;
+
+  runInEpochRooted([&]{
+    auto id = theSched()->enqueueAfter(3600., [&]{ ran = true; });
+    EXPECT_TRUE(theSched()->cancelTimer(id));
+    EXPECT_FALSE(theSched()->cancelTimer(id));
+  });
+
+  EXPECT_FALSE(ran);
+  EXPECT_EQ(theSched()->numPendingTimers(), 0u);
+}
+
+TEST_F(TestSchedulerTimers, test_scheduler_timeout_epoch) {
+  bool timed_out = false;
+
+  // An epoch that is held open past its timeout
+  auto ep = theTerm()->makeEpochRooted(term::UseDS{true});
+  theTerm()->produce(ep);
+  theSched()->timeoutEpoch(ep, 0.01, [&]{
+    timed_out = true;
+    theTerm()->consume(ep);
+  });
+  theTerm()->finishedEpoch(ep);
+  runSchedulerThrough(ep);
+  EXPECT_TRUE(timed_out);
+
+  // An epoch that terminates in time cancels its timeout
+  timed_out = false;
+  auto ep2 = theTerm()->makeEpochRooted(term::UseDS{true});
+  theSched()->timeoutEpoch(ep2, 3600., [&]{ timed_out = true; });
+  theTerm()->finishedEpoch(ep2);
+  runSchedulerThrough(ep2);
+  EXPECT_FALSE(timed_out);
+  EXPECT_EQ(theSched()->numPendingTimers(), 0u);
+}
+
+TEST_F(TestSchedulerTimers, test_scheduler_enqueue_deadline_runs_once) {
+  int runs = 0;
+
+  // The bump is due immediately, so both copies get queued; only one may run
+  auto msg = makeMessage<vt::Message>();
+  theSched()->enqueueDeadline(msg, 0., 0., [&]{ runs++; });
+  drainScheduler();
+
+  EXPECT_EQ(runs, 1);
+}
+
+TEST_F(TestSchedulerTimers, test_scheduler_enqueue_deadline_bumps_ahead) {
+  static constexpr int const num_units = 64;
+  static constexpr TimeType const unit_time = 0.0002;
+
+  // Queue slow user work ahead of the deadline unit
+  int ran = 0;
+  int deadline_pos = -1;
+  for (int i = 0; i < num_units; i++) {
+    theSched()->enqueue([&]{
+      auto const start = timing::getCurrentTime();
+      while (timing::getCurrentTime() - start < unit_time) { }
+      ran++;
+    });
+  }
+
+  // The bump must get the unit ahead of the user queue even without
+  // priorities compiled in
+  auto msg = makeMessage<vt::Message>();
+  theSched()->enqueueDeadline(msg, 0.001, 0.001, [&]{ deadline_pos = ran; });
+  theSched()->runSchedulerWhile([&]{ return ran < num_units; });
+
+  EXPECT_GE(deadline_pos, 0);
+  EXPECT_LT(deadline_pos, num_units);
+  drainScheduler();
+}
+
+}}} // end namespace vt::tests::unit
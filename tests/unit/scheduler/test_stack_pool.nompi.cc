@@ -0,0 +1,131 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_stack_pool.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/config.h>
+#include "test_harness.h"
+
+#if vt_check_enabled(fcontext)
+
+#include <vt/scheduler/stack_pool.h>
+
+#include <cstring>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestStackPool = TestHarness;
+
+using StackPool = vt::sched::StackPool;
+
+TEST_F(TestStackPool, test_stack_pool_size_classes) {
+  StackPool pool{4, 1};
+
+  auto s1 = pool.allocate(1);
+  EXPECT_EQ(s1.ssize, StackPool::min_stack_size);
+
+  auto s2 = pool.allocate((1 << 21) - 64);
+  EXPECT_EQ(s2.ssize, std::size_t{1} << 21);
+
+  // The whole usable region must be writable
+  std::memset(static_cast<char*>(s2.sptr) - s2.ssize, 0xA, s2.ssize);
+
+  pool.release(s1);
+  pool.release(s2);
+  EXPECT_EQ(pool.numCached(), 2);
+  EXPECT_EQ(pool.getNumMapped(), 2);
+}
+
+TEST_F(TestStackPool, test_stack_pool_reuse) {
+  StackPool pool{2, 1};
+
+  auto s1 = pool.allocate(1 << 20);
+  pool.release(s1);
+
+  // Same size class must be served from the cache
+  auto s2 = pool.allocate((1 << 20) - 100);
+  EXPECT_EQ(s2.sptr, s1.sptr);
+  EXPECT_EQ(pool.getNumReused(), 1);
+
+  // A stack that was decommitted must still be usable after reuse
+  auto s3 = pool.allocate(1 << 20);
+  pool.release(s2);
+  pool.release(s3);
+  auto s4 = pool.allocate(1 << 20);
+  auto s5 = pool.allocate(1 << 20);
+  std::memset(static_cast<char*>(s4.sptr) - s4.ssize, 0xB, s4.ssize);
+  std::memset(static_cast<char*>(s5.sptr) - s5.ssize, 0xC, s5.ssize);
+
+  // Releasing beyond the per-class cap unmaps instead of caching
+  auto s6 = pool.allocate(1 << 20);
+  pool.release(s4);
+  pool.release(s5);
+  pool.release(s6);
+  EXPECT_EQ(pool.numCached(), 2);
+}
+
+TEST_F(TestStackPool, test_stack_pool_hot_first) {
+  StackPool pool{4, 1};
+
+  auto s1 = pool.allocate(1 << 20);
+  auto s2 = pool.allocate(1 << 20);
+
+  // s1 fills the single hot slot; s2 is decommitted onto the cold list
+  pool.release(s1);
+  pool.release(s2);
+  EXPECT_EQ(pool.numCached(), 2);
+
+  // The committed stack must be handed out before the decommitted one, even
+  // though the cold stack was released last
+  auto s3 = pool.allocate(1 << 20);
+  EXPECT_EQ(s3.sptr, s1.sptr);
+  auto s4 = pool.allocate(1 << 20);
+  EXPECT_EQ(s4.sptr, s2.sptr);
+
+  pool.release(s3);
+  pool.release(s4);
+}
+
+}}} // end namespace vt::tests::unit
+
+#endif /*vt_check_enabled(fcontext)*/
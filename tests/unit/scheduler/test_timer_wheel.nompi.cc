@@ -0,0 +1,153 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_timer_wheel.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/config.h>
+#include <vt/scheduler/timer_wheel.h>
+#include "test_harness.h"
+
+#include <functional>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestTimerWheel = TestHarness;
+
+using TimerWheel = vt::sched::TimerWheel;
+
+// One-millisecond ticks starting at time zero; times below sit mid-tick so
+// tick rounding is unambiguous
+static constexpr double const tick = 0.001;
+
+TEST_F(TestTimerWheel, test_timer_wheel_fires_in_order) {
+  TimerWheel wheel{tick, 0.};
+  std::vector<int> fired;
+
+  // Level 0, level 1, level 2 and the overflow list
+  std::vector<double> deadlines = {0.0055, 0.0105, 0.5005, 70.0005, 20000.0005};
+  for (int i = static_cast<int>(deadlines.size()) - 1; i >= 0; i--) {
+    wheel.schedule(deadlines[i], [&fired,i]{ fired.push_back(i); });
+  }
+  EXPECT_EQ(wheel.size(), deadlines.size());
+
+  for (auto&& deadline : deadlines) {
+    EXPECT_EQ(wheel.advance(deadline - tick), 0);
+    EXPECT_EQ(wheel.advance(deadline + tick), 1);
+  }
+
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(fired, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(TestTimerWheel, test_timer_wheel_cancel) {
+  TimerWheel wheel{tick, 0.};
+  int fired = 0, cancelled = 0;
+
+  auto a = wheel.schedule(0.0025, [&]{ fired++; }, [&]{ cancelled++; });
+  auto b = wheel.schedule(0.1005, [&]{ fired++; }, [&]{ cancelled++; });
+  auto c = wheel.schedule(0.1005, [&]{ fired++; });
+
+  EXPECT_TRUE(wheel.cancel(b));
+  EXPECT_FALSE(wheel.cancel(b));
+  EXPECT_EQ(cancelled, 1);
+
+  EXPECT_EQ(wheel.advance(0.2005), 2);
+  EXPECT_EQ(fired, 2);
+  EXPECT_EQ(cancelled, 1);
+
+  // Expired timers and stale IDs whose entry was reused cannot be cancelled
+  EXPECT_FALSE(wheel.cancel(a));
+  auto d = wheel.schedule(0.3005, [&]{ fired++; });
+  EXPECT_FALSE(wheel.cancel(c));
+  EXPECT_FALSE(wheel.cancel(vt::sched::no_timer));
+  EXPECT_TRUE(wheel.cancel(d));
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(fired, 2);
+}
+
+TEST_F(TestTimerWheel, test_timer_wheel_past_deadline_and_rescheduling) {
+  TimerWheel wheel{tick, 0.};
+  int count = 0;
+
+  wheel.advance(1.0005);
+
+  // A deadline in the past fires on the next tick
+  wheel.schedule(0.5, [&]{ count++; });
+  EXPECT_EQ(wheel.advance(1.0005), 0);
+  EXPECT_EQ(wheel.advance(1.0015), 1);
+
+  // Actions may schedule further timers, which fire in the same advance
+  std::function<void()> again = [&]{
+    if (++count < 5) {
+      wheel.schedule(0., again);
+    }
+  };
+  wheel.schedule(0., again);
+  EXPECT_EQ(wheel.advance(2.0005), 4);
+  EXPECT_EQ(count, 5);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(TestTimerWheel, test_timer_wheel_bounded_advance) {
+  TimerWheel wheel{tick, 0.};
+  int count = 0;
+
+  for (int i = 1; i <= 10; i++) {
+    wheel.schedule(i * tick + tick / 2, [&]{ count++; });
+  }
+
+  // Each call processes at most the given number of non-empty ticks
+  EXPECT_EQ(wheel.advance(1.0005, 3), 3);
+  EXPECT_EQ(wheel.advance(1.0005, 3), 3);
+  EXPECT_EQ(wheel.advance(1.0005), 4);
+  EXPECT_EQ(count, 10);
+
+  // An hour of empty ticks is skipped in well under the default bound
+  wheel.schedule(3600.0005, [&]{ count++; });
+  EXPECT_EQ(wheel.advance(3599.9995), 0);
+  EXPECT_EQ(wheel.advance(3600.0015), 1);
+  EXPECT_EQ(count, 11);
+}
+
+}}} // end namespace vt::tests::unit
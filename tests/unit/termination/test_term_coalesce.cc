@@ -0,0 +1,164 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_term_coalesce.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "data_message.h"
+#include "test_helpers.h"
+
+#include "vt/termination/termination.h"
+#include "vt/configs/arguments/app_config.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit { namespace coalesce {
+
+struct TestTermCoalesce : TestParallelHarness {
+  using TestMsgType = TestStaticBytesNormalMsg<64>;
+
+  static void handler(TestMsgType*) { }
+
+  virtual void TearDown() override {
+    theConfig()->vt_term_no_coalesce = false;
+    TestParallelHarness::TearDown();
+  }
+};
+
+/// Read a termination detector diagnostic counter on this node
+static double sampleTermCounter(std::string const& key) {
+  double value = 0.;
+  theTerm()->foreachDiagnostic([&](runtime::component::detail::DiagnosticBase* d){
+    if (d->getKey() == key) {
+      value = d->sampleValue();
+    }
+  });
+  return value;
+}
+
+/*
+ * Open many collective epochs at once, each with a message in flight, and wait
+ * for all of them. Returns the number of wave messages and wave epoch counters
+ * this node sent to its parent in the meantime.
+ */
+static std::pair<double, double> runConcurrentEpochs(int num_epochs) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  NodeType const next = this_node + 1 < num_nodes ? this_node + 1 : 0;
+
+  auto const msgs_before = sampleTermCounter("wave_msgs");
+  auto const epochs_before = sampleTermCounter("wave_epochs");
+
+  int num_terminated = 0;
+  std::vector<EpochType> epochs;
+  for (int i = 0; i < num_epochs; i++) {
+    auto const epoch = theTerm()->makeEpochCollective();
+    theTerm()->addAction(epoch, [&num_terminated]{ num_terminated++; });
+    epochs.push_back(epoch);
+  }
+
+  for (auto&& epoch : epochs) {
+    auto msg = makeMessage<TestTermCoalesce::TestMsgType>();
+    envelopeSetEpoch(msg->env, epoch);
+    theMsg()->sendMsg<
+      TestTermCoalesce::TestMsgType, TestTermCoalesce::handler
+    >(next, msg);
+  }
+
+  for (auto&& epoch : epochs) {
+    theTerm()->finishedEpoch(epoch);
+  }
+
+  theSched()->runSchedulerWhile([&]{ return num_terminated != num_epochs; });
+
+  EXPECT_EQ(num_terminated, num_epochs);
+  for (auto&& epoch : epochs) {
+    EXPECT_TRUE(theTerm()->isEpochTerminated(epoch));
+  }
+
+  return std::make_pair(
+    sampleTermCounter("wave_msgs") - msgs_before,
+    sampleTermCounter("wave_epochs") - epochs_before
+  );
+}
+
+static constexpr int const num_concurrent_epochs = 64;
+
+TEST_F(TestTermCoalesce, test_term_coalesce_concurrent_epochs) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  auto const counts = runConcurrentEpochs(num_concurrent_epochs);
+
+#if vt_check_enabled(diagnostics)
+  // Every non-root node reports each epoch to its parent at least once, and
+  // epochs that become ready in the same tick share a message
+  if (not theTerm()->isRoot()) {
+    EXPECT_GE(counts.second, num_concurrent_epochs);
+    EXPECT_LT(counts.first, counts.second);
+  }
+#else
+  vt_force_use(counts)
+#endif
+}
+
+TEST_F(TestTermCoalesce, test_term_coalesce_concurrent_epochs_no_coalesce) {
+  SET_MIN_NUM_NODES_CONSTRAINT(2);
+
+  theConfig()->vt_term_no_coalesce = true;
+
+  auto const counts = runConcurrentEpochs(num_concurrent_epochs);
+
+#if vt_check_enabled(diagnostics)
+  // Without coalescing each epoch counter travels in its own message
+  if (not theTerm()->isRoot()) {
+    EXPECT_GE(counts.second, num_concurrent_epochs);
+    EXPECT_EQ(counts.first, counts.second);
+  }
+#else
+  vt_force_use(counts)
+#endif
+}
+
+}}}} // end namespace vt::tests::unit::coalesce
@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                      test_work_stealing_deque.nompi.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <vt/utils/container/work_stealing_deque.h>
+#include "test_harness.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using TestWorkStealingDeque = TestHarness;
+
+using DequeType = vt::util::container::WorkStealingDeque<int64_t*>;
+
+TEST_F(TestWorkStealingDeque, test_owner_lifo_thief_fifo) {
+  DequeType d{4};
+
+  std::vector<int64_t> vals = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  for (auto&& v : vals) {
+    d.pushBottom(&v);
+  }
+
+  // Must have grown past the initial capacity
+  EXPECT_GE(d.capacity(), 10);
+  EXPECT_EQ(d.size(), 10);
+
+  int64_t* out = nullptr;
+  EXPECT_TRUE(d.steal(out));
+  EXPECT_EQ(*out, 0);
+  EXPECT_TRUE(d.popBottom(out));
+  EXPECT_EQ(*out, 9);
+  EXPECT_TRUE(d.steal(out));
+  EXPECT_EQ(*out, 1);
+
+  int64_t n = 0;
+  while (d.popBottom(out)) {
+    n++;
+  }
+  EXPECT_EQ(n, 7);
+  EXPECT_TRUE(d.empty());
+  EXPECT_FALSE(d.steal(out));
+  EXPECT_FALSE(d.popBottom(out));
+}
+
+TEST_F(TestWorkStealingDeque, test_concurrent_steal) {
+  DequeType d{2};
+
+  int64_t const num_elms = 100000;
+  int const num_thieves = 3;
+
+  std::vector<int64_t> vals(num_elms);
+  std::atomic<int64_t> sum = {0};
+  std::atomic<int64_t> count = {0};
+  std::atomic<bool> done = {false};
+
+  std::vector<std::thread> thieves;
+  for (int i = 0; i < num_thieves; i++) {
+    thieves.emplace_back([&]{
+      int64_t* out = nullptr;
+      while (not done.load() or not d.empty()) {
+        if (d.steal(out)) {
+          sum += *out;
+          count++;
+        }
+      }
+    });
+  }
+
+  int64_t* out = nullptr;
+  for (int64_t i = 0; i < num_elms; i++) {
+    vals[i] = i;
+    d.pushBottom(&vals[i]);
+    if (i % 3 == 0 and d.popBottom(out)) {
+      sum += *out;
+      count++;
+    }
+  }
+  while (d.popBottom(out)) {
+    sum += *out;
+    count++;
+  }
+
+  done.store(true);
+  for (auto&& t : thieves) {
+    t.join();
+  }
+
+  // Every element must be consumed exactly once
+  EXPECT_EQ(count.load(), num_elms);
+  EXPECT_EQ(sum.load(), num_elms * (num_elms - 1) / 2);
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,316 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 lb_replay.cc
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019-2021 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+/*
+ * lb_replay: evaluate a load balancer offline against recorded LB statistics.
+ *
+ * Each rank reads its stats file (from --vt_lb_stats_dir_in and
+ * --vt_lb_stats_file_in), and the strategy selected with --vt_lb_name and
+ * --vt_lb_args is run over the recorded loads and communication graph for
+ * each phase without migrating anything. See the usage text below.
+ */
+
+#include <vt/transport.h>
+#include <vt/utils/json/json_reader.h>
+#include <vt/vrt/collection/balance/stats_data.h>
+#include <vt/vrt/collection/balance/lb_invoke/lb_manager.h>
+#include <vt/vrt/collection/balance/model/raw_data.h>
+#include <vt/vrt/collection/balance/model/naive_persistence.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vt::vrt::collection;
+
+using ReduceMsg = vt::collective::ReduceTMsg<double>;
+
+static double reduced_sum = 0.;
+
+static double sumOnRoot(double value) {
+  vt::runInEpochCollective([=]{
+    auto cb = vt::theCB()->makeFunc<ReduceMsg>(
+      vt::pipe::LifetimeEnum::Once,
+      [](ReduceMsg* msg) { reduced_sum = msg->getConstVal(); }
+    );
+    auto msg = vt::makeMessage<ReduceMsg>(value);
+    vt::theCollective()->global()->reduce<vt::collective::PlusOp<double>>(
+      0, msg.get(), cb
+    );
+  });
+  return reduced_sum;
+}
+
+/// The phase count, first phase, last phase and phase sum, each followed
+/// later in the array by its negation so one min-reduction yields the minimum
+/// and the maximum of every quantity across the ranks
+using PhaseSetType = std::array<int64_t, 8>;
+using PhaseSetMsg = vt::collective::ReduceTMsg<PhaseSetType>;
+
+static PhaseSetType reduced_phase_set = {};
+
+static PhaseSetType phaseSetOnRoot(std::vector<vt::PhaseType> const& phases) {
+  int64_t sum = 0;
+  for (auto phase : phases) {
+    sum += static_cast<int64_t>(phase);
+  }
+  auto const count = static_cast<int64_t>(phases.size());
+  auto const first = phases.empty() ? 0 : static_cast<int64_t>(phases.front());
+  auto const last = phases.empty() ? 0 : static_cast<int64_t>(phases.back());
+  PhaseSetType const value = {
+    count, first, last, sum, -count, -first, -last, -sum
+  };
+
+  vt::runInEpochCollective([=]{
+    auto cb = vt::theCB()->makeFunc<PhaseSetMsg>(
+      vt::pipe::LifetimeEnum::Once,
+      [](PhaseSetMsg* msg) { reduced_phase_set = msg->getConstVal(); }
+    );
+    auto msg = vt::makeMessage<PhaseSetMsg>(value);
+    vt::theCollective()->global()->reduce<vt::collective::MinOp<PhaseSetType>>(
+      0, msg.get(), cb
+    );
+  });
+  return reduced_phase_set;
+}
+
+static constexpr char const* usage = R"(
+usage: mpirun -n <P> ./lb_replay --vt_lb_name=<LB> [--vt_lb_args="..."]
+         --vt_lb_stats_dir_in=<dir> [--vt_lb_stats_file_in=<name>]
+         [first_phase [num_phases]]
+
+Replays a load balancer over LB statistics recorded with --vt_lb_stats.
+
+Limitation: each process reads exactly one stats file, the one for its own
+rank, so <P> must equal the number of ranks that recorded the statistics.
+Strategies are distributed and balance across ranks, so stats files cannot
+be combined into fewer processes. On a workstation, oversubscribe instead:
+
+  mpirun --oversubscribe -n 64 ./lb_replay \
+    --vt_lb_name=TemperedLB --vt_lb_args="knowledge=Log rollback=false" \
+    --vt_lb_stats_dir_in=stats
+)";
+
+/// The stats file name the given rank reads, matching --vt_lb_stats_file_in
+static std::string statsFileFor(vt::NodeType node) {
+  auto name = vt::theConfig()->vt_lb_stats_file_in;
+  auto const rank = name.find("%p");
+  if (rank == std::string::npos) {
+    name += std::to_string(node);
+  } else {
+    name.replace(rank, 2, std::to_string(node));
+  }
+  return vt::theConfig()->vt_lb_stats_dir_in + "/" + name;
+}
+
+static bool fileExists(std::string const& name) {
+  std::ifstream file{name};
+  return file.good();
+}
+
+static balance::LBType findLB(std::string const& name) {
+  for (auto&& elm : balance::get_lb_names()) {
+    if (elm.second == name) {
+      return elm.first;
+    }
+  }
+  return balance::LBType::NoLB;
+}
+
+int main(int argc, char** argv) {
+  vt::initialize(argc, argv);
+
+  auto const this_node = vt::theContext()->getNode();
+  auto const& lb_name = vt::theConfig()->vt_lb_name;
+  auto const lb_type = findLB(lb_name);
+
+  vtAbortIf(
+    lb_type == balance::LBType::NoLB or
+    lb_type == balance::LBType::StatsMapLB,
+    fmt::format(
+      "lb_replay: --vt_lb_name=\"{}\" cannot be replayed\n{}", lb_name, usage
+    )
+  );
+
+  auto const file_name = vt::theConfig()->getLBStatsFileIn();
+  vtAbortIf(
+    not fileExists(file_name),
+    fmt::format(
+      "lb_replay: rank {} has no stats file \"{}\"\n{}",
+      this_node, file_name, usage
+    )
+  );
+
+  // A stats file for rank P means the statistics were recorded on more ranks
+  // than this run has; replaying on fewer ranks is not supported
+  auto const num_nodes = vt::theContext()->getNumNodes();
+  if (this_node == 0) {
+    auto const extra_file = statsFileFor(num_nodes);
+    vtAbortIf(
+      fileExists(extra_file),
+      fmt::format(
+        "lb_replay: found \"{}\": the statistics were recorded on more than "
+        "{} ranks\n{}", extra_file, num_nodes, usage
+      )
+    );
+  }
+
+  vt::util::json::Reader reader{file_name};
+  auto json = reader.readFile();
+  auto data = std::make_unique<balance::StatsData>(*json);
+
+  auto raw = std::make_shared<balance::RawData>();
+  raw->setLoads(&data->node_data_, &data->node_comm_);
+  auto model = std::make_shared<balance::NaivePersistence>(raw);
+
+  std::vector<vt::PhaseType> phases;
+  for (auto&& elm : data->node_data_) {
+    phases.push_back(elm.first);
+  }
+  std::sort(phases.begin(), phases.end());
+
+  // Every phase below runs the strategy collectively, so all ranks must
+  // replay the same phases; a rank whose stats file recorded a different set
+  // would leave the others waiting in proposeLB
+  auto const phase_set = phaseSetOnRoot(phases);
+  if (this_node == 0) {
+    for (std::size_t i = 0; i < phase_set.size() / 2; i++) {
+      vtAbortIf(
+        phase_set[i] != -phase_set[i + phase_set.size() / 2],
+        fmt::format(
+          "lb_replay: the stats files record different phases on different "
+          "ranks ({} to {} phases, first phase {} to {}, last phase {} to {})",
+          phase_set[0], -phase_set[4], phase_set[1], -phase_set[5],
+          phase_set[2], -phase_set[6]
+        )
+      );
+    }
+  }
+
+  vt::PhaseType first_phase = phases.empty() ? 0 : phases.front();
+  std::size_t num_phases = phases.size();
+  if (argc > 1) {
+    first_phase = static_cast<vt::PhaseType>(std::atoll(argv[1]));
+  }
+  if (argc > 2) {
+    num_phases = static_cast<std::size_t>(std::atoll(argv[2]));
+  }
+
+  if (this_node == 0) {
+    fmt::print(
+      "lb_replay: lb={}, args=\"{}\", nodes={}, phases={}\n",
+      lb_name, vt::theConfig()->vt_lb_args, num_nodes, phases.size()
+    );
+    fmt::print(
+      "{:>8} {:>12} {:>12} {:>8} {:>12} {:>8} {:>10} {:>14} {:>12}\n",
+      "phase", "avg", "max_before", "imb", "max_after", "imb",
+      "migrations", "migrated_load", "lb_time"
+    );
+  }
+
+  using lb::Statistic;
+  using lb::StatisticQuantity;
+
+  double total_lb_time = 0.;
+  double total_migrated_load = 0.;
+  int64_t total_migrations = 0;
+  std::size_t replayed = 0;
+
+  for (auto phase : phases) {
+    if (phase < first_phase or replayed == num_phases) {
+      continue;
+    }
+
+    vt::elm::CommMapType empty_comm;
+    auto comm_iter = data->node_comm_.find(phase);
+    auto const& comm =
+      comm_iter != data->node_comm_.end() ? comm_iter->second : empty_comm;
+
+    auto proposal = vt::theLBManager()->proposeLB(phase, lb_type, model, comm);
+
+    // Load leaving this node under the proposed reassignment
+    double departing_load = 0.;
+    auto const& loads = data->node_data_[phase];
+    for (auto&& dep : proposal.reassignment_->depart_) {
+      auto iter = loads.find(dep.first);
+      if (iter != loads.end()) {
+        departing_load += iter->second.whole_phase_load;
+      }
+    }
+    auto const migrated_load = sumOnRoot(departing_load);
+
+    if (this_node == 0) {
+      auto& before = proposal.before_[Statistic::P_l];
+      auto& after = proposal.after_[Statistic::P_l];
+      auto const migrations = proposal.reassignment_->global_migration_count;
+      fmt::print(
+        "{:>8} {:>12.6f} {:>12.6f} {:>8.4f} {:>12.6f} {:>8.4f} {:>10} "
+        "{:>14.6f} {:>12.6f}\n",
+        phase, before[StatisticQuantity::avg], before[StatisticQuantity::max],
+        before[StatisticQuantity::imb], after[StatisticQuantity::max],
+        after[StatisticQuantity::imb], migrations, migrated_load,
+        proposal.strategy_time_
+      );
+      total_lb_time += proposal.strategy_time_;
+      total_migrated_load += migrated_load;
+      total_migrations += migrations;
+    }
+
+    replayed++;
+  }
+
+  if (this_node == 0) {
+    fmt::print(
+      "lb_replay: replayed {} phases, migrations={}, migrated_load={:.6f}, "
+      "lb_time={:.6f}s\n",
+      replayed, total_migrations, total_migrated_load, total_lb_time
+    );
+  }
+
+  vt::finalize();
+  return 0;
+}